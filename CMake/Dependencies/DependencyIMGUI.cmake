@@ -50,6 +50,17 @@ SET (IMGUI_SOURCE_FILES
 	${IMGUI_SOURCE_DIR}/imgui_demo.cpp	
 )
 
+# IMGUI reads the vertex layout and the index type from IrrIMGUIConfig.h, thus it must be included before imconfig.h
+IF (IRRIMGUI_IRRLICHT_VERTEX_LAYOUT OR IRRIMGUI_32BIT_INDICES)
+	IF (GCC_LIKE_COMPILER)
+		SET_SOURCE_FILES_PROPERTIES(${IMGUI_SOURCE_FILES} PROPERTIES COMPILE_FLAGS "-include \"${CMAKE_SOURCE_DIR}/includes/IrrIMGUI/IrrIMGUIConfig.h\"")
+	ELSEIF (MSVC_LIKE_COMPILER)
+		SET_SOURCE_FILES_PROPERTIES(${IMGUI_SOURCE_FILES} PROPERTIES COMPILE_FLAGS "/FI\"${CMAKE_SOURCE_DIR}/includes/IrrIMGUI/IrrIMGUIConfig.h\"")
+	ELSE ()
+		message(SEND_ERROR "The options IRRIMGUI_IRRLICHT_VERTEX_LAYOUT and IRRIMGUI_32BIT_INDICES are not supported for this compiler!")
+	ENDIF ()
+ENDIF ()
+
 SET (IMGUI_FONTFILES
 	${IMGUI_FONT_DIR}/Cousine-Regular.ttf
 	${IMGUI_FONT_DIR}/DroidSans.ttf
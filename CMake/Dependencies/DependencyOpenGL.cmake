@@ -35,6 +35,9 @@ if (OPENGL_FOUND)
 	${IRRIMGUI_DEPENDENCY_LIBRARIES}
 	${OPENGL_LIBRARIES}
 	)
+	ADD_DEFINITIONS(
+	-D_IRRIMGUI_OPENGL_BACKENDS_
+	)
 	
 else ()
 
@@ -43,5 +46,9 @@ else ()
 	else ()
 		MESSAGE(STATUS "OpenGL environment missing.")
 	endif ()
+
+	if (IRRIMGUI_NATIVE_OPENGL)
+		MESSAGE(WARNING "The native OpenGL render backends are not built without OpenGL, the Irrlicht render backend is used instead.")
+	endif ()
 	
 endif ()
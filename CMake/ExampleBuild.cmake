@@ -226,6 +226,10 @@ FUNCTION(BUILD_TOOL TOOL_NAME TOOL_SOURCE_FILES TOOL_HEADER_FILES TOOL_INSTALL_F
 	BUILD_APP_GENERIC("${TOOL_NAME}" "${TOOL_SOURCE_FILES}" "${TOOL_HEADER_FILES}" "${TOOL_INSTALL_FILES}" "${TOOL_INSTALL_DIRS}" FALSE "tools/${TOOL_NAME}" "" "" "" IRRIMGUI_INSTALL_EXAMPLE_SOURCE)
 ENDFUNCTION()
 
+FUNCTION(BUILD_BENCHMARK BENCHMARK_NAME BENCHMARK_SOURCE_FILES BENCHMARK_HEADER_FILES BENCHMARK_INSTALL_FILES BENCHMARK_INSTALL_DIRS BENCHMARK_INCLUDES)
+	BUILD_APP_GENERIC("${BENCHMARK_NAME}" "${BENCHMARK_SOURCE_FILES}" "${BENCHMARK_HEADER_FILES}" "${BENCHMARK_INSTALL_FILES}" "${BENCHMARK_INSTALL_DIRS}" FALSE "benchmarks/${BENCHMARK_NAME}" "${BENCHMARK_INCLUDES}" "" "" FALSE)
+ENDFUNCTION()
+
 FUNCTION(BUILD_UTEST TEST_NAME TEST_SOURCE_FILES TEST_HEADER_FILES TEST_INSTALL_FILES TEST_INSTALL_DIRS TEST_INCLUDES TEST_LIBRARIES TEST_INCLUDE_FILES)
 	BUILD_APP_GENERIC("${TEST_NAME}" "${TEST_SOURCE_FILES}" "${TEST_HEADER_FILES}" "${TEST_INSTALL_FILES}" "${TEST_INSTALL_DIRS}" FALSE "tests/${TEST_NAME}" "${TEST_INCLUDES}" "${TEST_LIBRARIES}" "${TEST_INCLUDE_FILES}" FALSE)
 ENDFUNCTION()
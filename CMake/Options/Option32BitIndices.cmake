@@ -0,0 +1,34 @@
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 Andr Netzeband
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+SET (IRRIMGUI_32BIT_INDICES OFF CACHE BOOL "Compiles IMGUI with 32 bit vertex indices (ImDrawIdx). Single windows can then contain more than 65536 vertices without splitting the draw calls (applications must be compiled with the same setting).")
+
+if (IRRIMGUI_32BIT_INDICES)
+	message(STATUS "Use 32 bit indices for IMGUI draw lists...")
+	ADD_DEFINITIONS(
+	-D_IRRIMGUI_32BIT_INDICES_
+	)
+else ()
+	message(STATUS "Use 16 bit indices for IMGUI draw lists...")
+endif ()
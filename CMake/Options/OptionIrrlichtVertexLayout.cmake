@@ -0,0 +1,34 @@
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 Andr Netzeband
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+SET (IRRIMGUI_IRRLICHT_VERTEX_LAYOUT OFF CACHE BOOL "Compiles IMGUI with a vertex type that has the same memory layout like the Irrlicht S3DVertex. The Irrlicht renderer can then draw the IMGUI vertices without copying them (applications must be compiled with the same setting).")
+
+if (IRRIMGUI_IRRLICHT_VERTEX_LAYOUT)
+	message(STATUS "Use Irrlicht vertex layout for IMGUI vertices...")
+	ADD_DEFINITIONS(
+	-D_IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+	)
+else ()
+	message(STATUS "Use IMGUI default vertex layout...")
+endif ()
@@ -22,16 +22,16 @@
 # SOFTWARE.
 #
 
-SET (IRRIMGUI_NATIVE_OPENGL OFF CACHE BOOL "Enables the native OpenGL Driver for IMGUI (ATTENTION: This is just a fallback solution!).")
+SET (IRRIMGUI_NATIVE_OPENGL OFF CACHE BOOL "Uses the native OpenGL Driver for IMGUI as default render backend (ATTENTION: This is just a fallback solution!). Both drivers can be selected at runtime.")
 
 if (IRRIMGUI_NATIVE_OPENGL)
-	message(WARNING "Use native OpenGL render driver (Fallback solution, do not use it for productive work!)...")
+	message(WARNING "Use native OpenGL render driver as default (Fallback solution, do not use it for productive work!)...")
 	ADD_DEFINITIONS(	
 	-D_IRRIMGUI_NATIVE_OPENGL_
 	)
 	SET (IRRIMGUI_FAST_OPENGL_TEXTURE_CREATION ON CACHE BOOL "Enables the fast OpenGL texture creation to translate a ITexture object to an OpenGL handle instead of creating a copy. This is a very instable hack. Disable this, when the example 7 (RenderWindow) fails.")	
 else ()
-	message(STATUS "Use Irrlicht based render driver...")
+	message(STATUS "Use Irrlicht based render driver as default...")
 endif ()
 
 if (IRRIMGUI_FAST_OPENGL_TEXTURE_CREATION)
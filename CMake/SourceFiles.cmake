@@ -29,6 +29,7 @@ INCLUDE_DIRECTORIES(
 SET (IRRIMGUI_PUBLIC_HEADER_FILES
 	includes/IrrIMGUI/Inject/IrrIMGUIInject.h
 	includes/IrrIMGUI/Tools/CBasicMemoryLeakDetection.h
+	includes/IrrIMGUI/Tools/CChromeTraceProfiler.h
 	includes/IrrIMGUI/UnitTest/IIMGUIHandleMock.h
 	includes/IrrIMGUI/UnitTest/IncludeCppUTest.h
 	includes/IrrIMGUI/UnitTest/MockHelper.h
@@ -41,20 +42,37 @@ SET (IRRIMGUI_PUBLIC_HEADER_FILES
 	includes/IrrIMGUI/IMGUIHelper.h
 	includes/IrrIMGUI/IncludeIMGUI.h
 	includes/IrrIMGUI/IncludeIrrlicht.h
+	includes/IrrIMGUI/IProfiler.h
 	includes/IrrIMGUI/IReferenceCounter.h
 	includes/IrrIMGUI/IrrIMGUI.h	
 	includes/IrrIMGUI/IrrIMGUIConfig.h
 	includes/IrrIMGUI/IrrIMGUIConstants.h
 	includes/IrrIMGUI/IrrIMGUIDebug.h
 	includes/IrrIMGUI/SIMGUISettings.h
+	includes/IrrIMGUI/SIMGUIStatistics.h
 )
 
 SET (IRRIMGUI_PRIVATE_HEADER_FILES
+	source/private/CCommandListCache.h
+	source/private/CCommandListCopy.h
+	source/private/CDrawDataPipeline.h
+	source/private/CGUILayer.h
 	source/private/CGUITexture.h
+	source/private/CPerformanceOverlay.h
+	source/private/CStagingBuffer.h
+	source/private/CStatisticsHistory.h
+	source/private/CTriangleClipper.h
+	source/private/CVertexConverter.h
+	source/private/CWorkerPool.h
 	source/private/IrrIMGUIDebug_priv.h
+	source/private/IrrIMGUIIndices_priv.h
 	source/private/IrrIMGUIInject_priv.h
+	source/private/IrrIMGUIOpenGL_priv.h
+	source/private/IrrIMGUIProfiler_priv.h
+	source/private/IrrIMGUISIMD_priv.h
 	source/CIMGUIHandle.h
 	source/CIrrlichtIMGUIDriver.h
+	source/COpenGL3IMGUIDriver.h
 	source/COpenGLIMGUIDriver.h
 	source/IIMGUIDriver.h
 )
@@ -62,15 +80,33 @@ SET (IRRIMGUI_PRIVATE_HEADER_FILES
 SET (IRRIMGUI_SOURCE_FILES
 	source/CBasicMemoryLeakDetection.cpp
 	source/CChannelBuffer.cpp
+	source/CCommandListCache.cpp
+	source/CCommandListCopy.cpp
 	source/CCharFifo.cpp
+	source/CChromeTraceProfiler.cpp
+	source/CDrawDataPipeline.cpp
+	source/CGUILayer.cpp
 	source/CGUITexture.cpp
 	source/CIMGUIEventReceiver.cpp
 	source/CIMGUIHandle.cpp
 	source/CIrrlichtIMGUIDriver.cpp
-	source/COpenGLIMGUIDriver.cpp
+	source/CPerformanceOverlay.cpp
+	source/CStatisticsHistory.cpp
+	source/CTriangleClipper.cpp
+	source/CVertexConverter.cpp
+	source/CWorkerPool.cpp
 	source/IIMGUIDriver.cpp
 	source/IMGUIHelper.cpp
+	source/IProfiler.cpp
 	source/IReferenceCounter.cpp
 	source/IrrIMGUIInject.cpp
+	source/IrrIMGUISIMD.cpp
 	source/UnitTest.cpp
 )
+
+# only compiled, when OpenGL has been found (see DependencyOpenGL)
+SET (IRRIMGUI_OPENGL_SOURCE_FILES
+	source/COpenGL3IMGUIDriver.cpp
+	source/COpenGLIMGUIDriver.cpp
+	source/IrrIMGUIOpenGL.cpp
+)
@@ -0,0 +1,123 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchCommandListCache.cpp
+ * @brief  Measures the command list cache against the conversion of all vertices.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <CCommandListCache.h>
+#include <IrrIMGUISIMD_priv.h>
+
+// module includes
+#include "Benchmark.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Measures the conversion and the cache lookup for a command list.
+  /// @param pName          Is the name of the benchmark.
+  /// @param NumberOfQuads  Is the number of quads in the command list.
+  void measureCommandListCache(char const * const pName, int const NumberOfQuads)
+  {
+    ImDrawList CommandList;
+    CommandList.VtxBuffer.resize(NumberOfQuads * 4);
+    CommandList.IdxBuffer.resize(NumberOfQuads * 6);
+    CommandList.CmdBuffer.resize(1);
+
+    for (int i = 0; i < CommandList.VtxBuffer.size(); i++)
+    {
+      CommandList.VtxBuffer[i].pos = ImVec2(static_cast<float>(i % 1920), static_cast<float>(i / 1920));
+      CommandList.VtxBuffer[i].uv  = ImVec2(static_cast<float>(i % 512) / 512.0f, 0.5f);
+      CommandList.VtxBuffer[i].col = 0xFF000000 | (i * 2654435761u >> 8);
+    }
+
+    for (int i = 0; i < CommandList.IdxBuffer.size(); i++)
+    {
+      CommandList.IdxBuffer[i] = static_cast<ImDrawIdx>((i / 6) * 4 + (i % 3));
+    }
+
+    ImDrawCmd &rCommand = CommandList.CmdBuffer[0];
+    rCommand.ElemCount        = NumberOfQuads * 6;
+    rCommand.ClipRect         = ImVec4(0.0f, 0.0f, 1920.0f, 1080.0f);
+    rCommand.TextureId        = nullptr;
+    rCommand.UserCallback     = nullptr;
+    rCommand.UserCallbackData = nullptr;
+
+    irr::u32 const             NumberOfVertices = CommandList.VtxBuffer.size();
+    irr::core::vector3df const Offset(-0.375f, -0.375f, 0.0f);
+    irr::u32 const             Repetitions = 2000000 / NumberOfVertices;
+
+    std::vector<irr::video::S3DVertex> ConvertedVertices(NumberOfVertices);
+    Private::CCommandListCache         Cache;
+    Cache.setMaxNumberOfVertices(NumberOfVertices);
+    irr::video::S3DVertex * const pVertices = Cache.addCommandList(&CommandList);
+
+    double const ConversionTime = Benchmark::measureNanoseconds(Repetitions, [&]()
+    {
+      Private::SIMD::convertVertices(CommandList.VtxBuffer.Data, pVertices, NumberOfVertices, Offset);
+      Benchmark::doNotOptimize(pVertices);
+    });
+    Benchmark::printResult(pName, "conversion", ConversionTime / NumberOfVertices, "ns/vertex");
+
+    double const HitTime = Benchmark::measureNanoseconds(Repetitions, [&]()
+    {
+      Benchmark::doNotOptimize(Cache.findVertices(&CommandList));
+    });
+    Benchmark::printResult(pName, "cache hit", HitTime / NumberOfVertices, "ns/vertex");
+
+    // the last vertex changes in every frame, thus the whole list is compared before the change is detected
+    double const MissTime = Benchmark::measureNanoseconds(Repetitions, [&]()
+    {
+      Cache.startFrame();
+      CommandList.VtxBuffer[NumberOfVertices - 1].col ^= 1;
+      if (Cache.findVertices(&CommandList) == nullptr)
+      {
+        irr::video::S3DVertex * pNewVertices = Cache.addCommandList(&CommandList);
+        if (pNewVertices == nullptr)
+        {
+          pNewVertices = ConvertedVertices.data();
+        }
+        Private::SIMD::convertVertices(CommandList.VtxBuffer.Data, pNewVertices, NumberOfVertices, Offset);
+        Benchmark::doNotOptimize(pNewVertices);
+      }
+    });
+    Benchmark::printResult(pName, "cache miss", MissTime / NumberOfVertices, "ns/vertex");
+
+    return;
+  }
+}
+
+BENCHMARK(CommandListCache)
+{
+  measureCommandListCache("4k vertices",   1024);
+  measureCommandListCache("128k vertices", 32768);
+
+  return;
+}
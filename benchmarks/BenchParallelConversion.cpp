@@ -0,0 +1,111 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchParallelConversion.cpp
+ * @brief  Measures the vertex conversion of several command lists with a different number of threads.
+ */
+
+// library includes
+#include <string>
+#include <thread>
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <CVertexConverter.h>
+
+// module includes
+#include "Benchmark.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Number of vertices of every command list (a typical window).
+  irr::u32 const NumberOfListVertices = 2048;
+
+  /// @brief Measures the conversion of command lists with 1, 2, 4 and one thread per core.
+  /// @param pName          Is the name of the benchmark.
+  /// @param NumberOfLists  Is the number of command lists.
+  void measureParallelConversion(char const * const pName, irr::u32 const NumberOfLists)
+  {
+    irr::u32 const                     NumberOfVertices = NumberOfLists * NumberOfListVertices;
+    std::vector<ImDrawVert>            GUIVertices(NumberOfVertices);
+    std::vector<irr::video::S3DVertex> IrrVertices(NumberOfVertices);
+    irr::core::vector3df const         Offset(-0.375f, -0.375f, 0.0f);
+    irr::u32 const                     Repetitions = 4194304 / NumberOfVertices;
+
+    for (irr::u32 i = 0; i < NumberOfVertices; i++)
+    {
+      GUIVertices[i].pos.x = static_cast<float>(i % 1920);
+      GUIVertices[i].pos.y = static_cast<float>(i / 1920);
+      GUIVertices[i].uv.x  = static_cast<float>(i % 512) / 512.0f;
+      GUIVertices[i].uv.y  = static_cast<float>(i % 256) / 256.0f;
+      GUIVertices[i].col   = 0xFF000000 | (i * 2654435761u >> 8);
+    }
+
+    irr::u32 const NumberOfCores  = std::thread::hardware_concurrency();
+    irr::u32 const ThreadCounts[]   = {1, 2, 4, 0};
+
+    for (irr::u32 const NumberOfThreads : ThreadCounts)
+    {
+      if ((NumberOfThreads != 0) && (NumberOfCores != 0) && (NumberOfThreads > NumberOfCores))
+      {
+        // more threads than cores would only measure the scheduler
+        continue;
+      }
+
+      Private::CVertexConverter Converter;
+      Converter.setNumberOfThreads(NumberOfThreads);
+
+      double const Time = Benchmark::measureNanoseconds(Repetitions, [&]()
+      {
+        for (irr::u32 List = 0; List < NumberOfLists; List++)
+        {
+          irr::u32 const FirstVertex = List * NumberOfListVertices;
+          Converter.addVertices(&GUIVertices[FirstVertex], &IrrVertices[FirstVertex], NumberOfListVertices);
+        }
+        Converter.convert(Offset);
+        Benchmark::doNotOptimize(IrrVertices.data());
+      });
+
+      std::string const Variant = (NumberOfThreads == 0) ?
+        std::string("one thread per core (") + std::to_string(Converter.getNumberOfThreads()) + ")" :
+        std::to_string(NumberOfThreads) + " thread(s)";
+      Benchmark::printResult(pName, Variant.c_str(), Time / NumberOfVertices, "ns/vertex");
+    }
+
+    return;
+  }
+}
+
+BENCHMARK(ParallelConversion)
+{
+  measureParallelConversion("1 list",     1);
+  measureParallelConversion("8 lists",    8);
+  measureParallelConversion("32 lists",  32);
+  measureParallelConversion("128 lists", 128);
+
+  return;
+}
@@ -0,0 +1,184 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchPixelConversion.cpp
+ * @brief  Measures the pixel conversion that is used when textures are created from raw data.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUISIMD_priv.h>
+
+// module includes
+#include "Benchmark.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Width of a 4k image.
+  irr::u32 const ImageWidth = 3840;
+
+  /// @brief Height of a 4k image.
+  irr::u32 const ImageHeight = 2160;
+
+  /// @brief Number of conversions in one measurement.
+  irr::u32 const Repetitions = 4;
+
+  /// @brief The R8G8B8A8 conversion of the Irrlicht driver in IrrIMGUI 0.3 (reference for the benchmark).
+  void convertRGBAToARGBLegacy(irr::u32 * const pImageData, irr::u32 const NumberOfPixels)
+  {
+    for (irr::u32 X = 0; X < NumberOfPixels; X++)
+    {
+      ImColor const Color(pImageData[X]);
+
+      irr::u8 const Red   = static_cast<irr::u8>(Color.Value.x * 255);
+      irr::u8 const Green = static_cast<irr::u8>(Color.Value.y * 255);
+      irr::u8 const Blue  = static_cast<irr::u8>(Color.Value.z * 255);
+      irr::u8 const Alpha = static_cast<irr::u8>(Color.Value.w * 255);
+
+      irr::video::SColor(Alpha, Red, Green, Blue).getData(&pImageData[X], irr::video::ECF_A8R8G8B8);
+    }
+  }
+
+  /// @brief The A8 conversion of the Irrlicht driver in IrrIMGUI 0.3 (reference for the benchmark).
+  void expandAlphaLegacy(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    for (irr::u32 X = 0; X < NumberOfPixels; X++)
+    {
+      irr::video::SColor const Color(pSource[X], 255, 255, 255);
+      Color.getData(&pDestination[X], irr::video::ECF_A8R8G8B8);
+    }
+  }
+
+  /// @brief The ARGB to RGBA conversion of the OpenGL driver in IrrIMGUI 0.3 (reference for the benchmark).
+  void convertARGBToRGBALegacy(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const Width, irr::u32 const Height)
+  {
+    for (irr::u32 X = 0; X < Width; X++)
+    {
+      for (irr::u32 Y = 0; Y < Height; Y++)
+      {
+        irr::video::SColor PixelColor;
+        PixelColor.setData(&pSource[X + Y * Width], irr::video::ECF_A8R8G8B8);
+        PixelColor.toOpenGLColor(reinterpret_cast<irr::u8 *>(&pDestination[X + Y * Width]));
+      }
+    }
+  }
+
+  /// @brief Prints the throughput of a conversion.
+  /// @param pName    Is the name of the benchmark.
+  /// @param pVariant Is the name of the measured variant.
+  /// @param Time     Is the duration of a single conversion in nanoseconds.
+  void printThroughput(char const * const pName, char const * const pVariant, double const Time)
+  {
+    // the throughput is measured in written bytes, one byte per nanosecond is one GB/s
+    double const BytesPerImage = static_cast<double>(ImageWidth) * ImageHeight * sizeof(irr::u32);
+    Benchmark::printResult(pName, pVariant, BytesPerImage / Time, "GB/s");
+    return;
+  }
+
+  /// @brief Measures a conversion function with every supported instruction set.
+  /// @param pName    Is the name of the benchmark.
+  /// @param Function Is the function (or lambda) that converts the image.
+  template <typename TFunction>
+  void measureAllInstructionSets(char const * const pName, TFunction Function)
+  {
+    Private::SIMD::EInstructionSet const OriginalInstructionSet = Private::SIMD::getInstructionSet();
+
+    for (int Set = Private::SIMD::EIS_SCALAR; Set < Private::SIMD::EIS_COUNT; Set++)
+    {
+      Private::SIMD::EInstructionSet const InstructionSet = static_cast<Private::SIMD::EInstructionSet>(Set);
+      if (!Private::SIMD::isInstructionSetSupported(InstructionSet))
+      {
+        continue;
+      }
+
+      Private::SIMD::setInstructionSet(InstructionSet);
+      printThroughput(pName, Private::SIMD::getInstructionSetName(InstructionSet), Benchmark::measureNanoseconds(Repetitions, Function));
+    }
+
+    Private::SIMD::setInstructionSet(OriginalInstructionSet);
+
+    return;
+  }
+}
+
+BENCHMARK(PixelConversion)
+{
+  irr::u32 const NumberOfPixels = ImageWidth * ImageHeight;
+
+  std::vector<irr::u32> SourcePixels(NumberOfPixels);
+  std::vector<irr::u32> DestinationPixels(NumberOfPixels);
+  std::vector<irr::u8>  AlphaValues(NumberOfPixels);
+
+  for (irr::u32 i = 0; i < NumberOfPixels; i++)
+  {
+    SourcePixels[i] = i * 2654435761u;
+    AlphaValues[i]  = static_cast<irr::u8>(i);
+  }
+
+  // R8G8B8A8 -> A8R8G8B8 in place (Irrlicht driver), the channels are swapped every run
+  printThroughput("RGBA to ARGB 4k", "Legacy (float color)", Benchmark::measureNanoseconds(Repetitions, [&]()
+  {
+    convertRGBAToARGBLegacy(SourcePixels.data(), NumberOfPixels);
+    Benchmark::doNotOptimize(SourcePixels.data());
+  }));
+
+  measureAllInstructionSets("RGBA to ARGB 4k", [&]()
+  {
+    Private::SIMD::convertColors(SourcePixels.data(), SourcePixels.data(), NumberOfPixels);
+    Benchmark::doNotOptimize(SourcePixels.data());
+  });
+
+  // A8 -> A8R8G8B8 (Irrlicht driver font texture)
+  printThroughput("A8 to ARGB 4k", "Legacy (SColor)", Benchmark::measureNanoseconds(Repetitions, [&]()
+  {
+    expandAlphaLegacy(AlphaValues.data(), DestinationPixels.data(), NumberOfPixels);
+    Benchmark::doNotOptimize(DestinationPixels.data());
+  }));
+
+  measureAllInstructionSets("A8 to ARGB 4k", [&]()
+  {
+    Private::SIMD::expandAlpha(AlphaValues.data(), DestinationPixels.data(), NumberOfPixels);
+    Benchmark::doNotOptimize(DestinationPixels.data());
+  });
+
+  // A8R8G8B8 -> R8G8B8A8 (OpenGL driver)
+  printThroughput("ARGB to RGBA 4k", "Legacy (SColor)", Benchmark::measureNanoseconds(Repetitions, [&]()
+  {
+    convertARGBToRGBALegacy(SourcePixels.data(), DestinationPixels.data(), ImageWidth, ImageHeight);
+    Benchmark::doNotOptimize(DestinationPixels.data());
+  }));
+
+  measureAllInstructionSets("ARGB to RGBA 4k", [&]()
+  {
+    Private::SIMD::convertColors(SourcePixels.data(), DestinationPixels.data(), NumberOfPixels);
+    Benchmark::doNotOptimize(DestinationPixels.data());
+  });
+
+  return;
+}
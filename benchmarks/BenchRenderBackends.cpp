@@ -0,0 +1,249 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+/**
+ * @file   BenchRenderBackends.cpp
+ * @brief  Measures the render backends with identical recorded GUI frames.
+ */
+
+// library includes
+#include <cstring>
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+
+// module includes
+#include "Benchmark.h"
+#include "BenchmarkGUI.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief A copy of the draw data of a GUI frame, that can be rendered again by every render backend.
+  class CRecordedFrame
+  {
+    public:
+      /// @brief Destructor.
+      ~CRecordedFrame(void)
+      {
+        for (ImDrawList * const pCommandList : mCommandLists)
+        {
+          delete(pCommandList);
+        }
+
+        return;
+      }
+
+      /// @brief Builds a GUI and records its draw data.
+      /// @param pGUI            Is a pointer to the GUI handle.
+      /// @param NumberOfWindows Is the number of windows to render (see buildGUI).
+      void record(IIMGUIHandle * const pGUI, irr::u32 const NumberOfWindows)
+      {
+        pGUI->startGUI();
+        Benchmark::buildGUI(NumberOfWindows);
+
+        // the draw data is only created and recorded, but not rendered
+        ImGuiIO &rGUIIO = ImGui::GetIO();
+        void (* const pRenderFunction)(ImDrawData *) = rGUIIO.RenderDrawListsFn;
+        mpRecordingFrame = this;
+        rGUIIO.RenderDrawListsFn = CRecordedFrame::recordDrawData;
+        ImGui::Render();
+        rGUIIO.RenderDrawListsFn = pRenderFunction;
+        mpRecordingFrame = nullptr;
+
+        return;
+      }
+
+      /// @brief Is called by ImGui::Render() instead of the render function and copies the draw data into the recording frame.
+      /// @param pDrawData Is the draw data of the frame.
+      static void recordDrawData(ImDrawData * const pDrawData)
+      {
+        for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+        {
+          ImDrawList const * const pSource = pDrawData->CmdLists[CommandListIndex];
+          ImDrawList * const pCommandList = new ImDrawList();
+
+          pCommandList->CmdBuffer.resize(pSource->CmdBuffer.size());
+          pCommandList->IdxBuffer.resize(pSource->IdxBuffer.size());
+          pCommandList->VtxBuffer.resize(pSource->VtxBuffer.size());
+          std::memcpy(pCommandList->CmdBuffer.Data, pSource->CmdBuffer.Data, pSource->CmdBuffer.size() * sizeof(ImDrawCmd));
+          std::memcpy(pCommandList->IdxBuffer.Data, pSource->IdxBuffer.Data, pSource->IdxBuffer.size() * sizeof(ImDrawIdx));
+
+          mpRecordingFrame->mCommandLists.push_back(pCommandList);
+          mpRecordingFrame->mVertices.push_back(std::vector<ImDrawVert>(pSource->VtxBuffer.Data, pSource->VtxBuffer.Data + pSource->VtxBuffer.size()));
+        }
+
+        return;
+      }
+
+      /// @brief Renders the recorded draw data with the render function of the current render backend.
+      /// @param pRenderFunction Is the render function, that IMGUI would call.
+      void replay(void (* const pRenderFunction)(ImDrawData *))
+      {
+        ImTextureID const FontTexture = ImGui::GetIO().Fonts->TexID;
+        int NumberOfVertices = 0;
+        int NumberOfIndices  = 0;
+
+        for (irr::u32 i = 0; i < mCommandLists.size(); i++)
+        {
+          ImDrawList * const pCommandList = mCommandLists[i];
+
+          // a backend may convert the vertices in place, thus every frame starts with the recorded vertices
+          std::memcpy(pCommandList->VtxBuffer.Data, mVertices[i].data(), mVertices[i].size() * sizeof(ImDrawVert));
+
+          // the benchmark GUI uses only the font texture, which is created again by every backend
+          for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
+          {
+            pCommandList->CmdBuffer[CommandIndex].TextureId = FontTexture;
+          }
+
+          NumberOfVertices += pCommandList->VtxBuffer.size();
+          NumberOfIndices  += pCommandList->IdxBuffer.size();
+        }
+
+        ImDrawData DrawData;
+        DrawData.CmdLists      = mCommandLists.data();
+        DrawData.CmdListsCount = static_cast<int>(mCommandLists.size());
+        DrawData.TotalVtxCount = NumberOfVertices;
+        DrawData.TotalIdxCount = NumberOfIndices;
+
+        pRenderFunction(&DrawData);
+
+        return;
+      }
+
+    private:
+      /// @brief The frame that is recorded at the moment (see recordDrawData).
+      static CRecordedFrame * mpRecordingFrame;
+
+      std::vector<ImDrawList *>            mCommandLists;
+      std::vector<std::vector<ImDrawVert>> mVertices;
+  };
+
+  CRecordedFrame * CRecordedFrame::mpRecordingFrame = nullptr;
+
+  /// @brief A render function, that renders nothing (to measure the overhead of the replay).
+  void renderNothing(ImDrawData * const pDrawData)
+  {
+    Benchmark::doNotOptimize(pDrawData);
+    return;
+  }
+
+  /// @brief Measures the rendering of a recorded frame.
+  /// @param pDevice         Is a pointer to the Irrlicht device.
+  /// @param rFrame          Is the recorded frame.
+  /// @param pRenderFunction Is the render function of the render backend.
+  /// @return Returns the fastest duration of a single frame in milliseconds.
+  double measureReplay(irr::IrrlichtDevice * const pDevice, CRecordedFrame &rFrame, void (* const pRenderFunction)(ImDrawData *))
+  {
+    irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+
+    double const Time = Benchmark::measureNanoseconds(200, [&]()
+    {
+      pDevice->run();
+      pDriver->beginScene(true, true, irr::video::SColor(255, 100, 101, 140));
+      rFrame.replay(pRenderFunction);
+      pDriver->endScene();
+    });
+
+    return Time / 1000000.0;
+  }
+
+  /// @brief Records a GUI frame and renders it with every render backend.
+  /// @param pDevice         Is a pointer to the Irrlicht device.
+  /// @param pName           Is the name of the benchmark.
+  /// @param NumberOfWindows Is the number of windows to render.
+  void measureRenderBackends(irr::IrrlichtDevice * const pDevice, char const * const pName, irr::u32 const NumberOfWindows)
+  {
+    CRecordedFrame Frame;
+
+    // the recorded frame outlives the GUI handles, thus its IMGUI memory is not tracked
+    SIMGUISettings Settings;
+    Settings.mIsIMGUIMemoryAllocationTrackingEnabled = false;
+
+    {
+      IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+      Frame.record(pGUI, NumberOfWindows);
+      Benchmark::printResult(pName, "replay overhead", measureReplay(pDevice, Frame, renderNothing), "ms/frame");
+      pGUI->drop();
+    }
+
+    struct SBackend
+    {
+      ERenderBackend mBackend;
+      bool           mIsBufferObjectStreamingEnabled;
+      char const   * mpName;
+    };
+
+    // the OpenGL backend uses client memory without buffer object streaming (like on OpenGL 1.x contexts)
+    SBackend const Backends[] =
+    {
+      {ERB_IRRLICHT, false, "Irrlicht backend"},
+      {ERB_OPENGL,   false, "OpenGL backend (client arrays)"},
+      {ERB_OPENGL,   true,  "OpenGL backend (buffer objects)"},
+      {ERB_OPENGL3,  true,  "OpenGL 3.3 backend"}
+    };
+
+    for (SBackend const &rBackend : Backends)
+    {
+      Settings.mRenderBackend                  = rBackend.mBackend;
+      Settings.mIsBufferObjectStreamingEnabled = rBackend.mIsBufferObjectStreamingEnabled;
+      IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+      if (pGUI->getRenderBackend() != rBackend.mBackend)
+      {
+        // e.g. the OpenGL backend with a software video driver or the OpenGL 3.3 backend without an OpenGL 3.3 context
+        Benchmark::printResult(pName, rBackend.mpName, 0.0, "(not available)");
+      }
+      else
+      {
+        Benchmark::printResult(pName, rBackend.mpName, measureReplay(pDevice, Frame, ImGui::GetIO().RenderDrawListsFn), "ms/frame");
+      }
+
+      pGUI->drop();
+    }
+
+    return;
+  }
+}
+
+BENCHMARK(RenderBackends)
+{
+  irr::IrrlichtDevice * const pDevice = Benchmark::createRenderDevice();
+  if (pDevice == nullptr)
+  {
+    Benchmark::printResult("skipped", "no render device", 0.0, "");
+    return;
+  }
+
+  measureRenderBackends(pDevice, "4 windows",  4);
+  measureRenderBackends(pDevice, "16 windows", 16);
+  measureRenderBackends(pDevice, "64 windows", 64);
+
+  pDevice->drop();
+
+  return;
+}
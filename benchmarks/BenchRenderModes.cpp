@@ -0,0 +1,148 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchRenderModes.cpp
+ * @brief  Measures the render modes of the GUI drivers.
+ */
+
+// library includes
+#include <IrrIMGUI/IrrIMGUI.h>
+
+// module includes
+#include "Benchmark.h"
+#include "BenchmarkGUI.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Measures all render modes for a GUI.
+  /// @param pDevice         Is a pointer to the Irrlicht device.
+  /// @param pGUI            Is a pointer to the GUI handle.
+  /// @param pName           Is the name of the benchmark.
+  /// @param NumberOfWindows Is the number of windows to render.
+  void measureRenderModes(irr::IrrlichtDevice * const pDevice, IIMGUIHandle * const pGUI, char const * const pName, irr::u32 const NumberOfWindows)
+  {
+    SIMGUISettings Settings = pGUI->getSettings();
+
+    Settings.mIsMeshBufferStreamingEnabled = false;
+    pGUI->setSettings(Settings);
+    double const ClientMemoryTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "client memory", ClientMemoryTime, "ms/frame");
+
+    SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+    Benchmark::printResult(pName, "clip planes draw calls", rStatistics.mNumberOfDrawCalls, "calls/frame");
+
+    Settings.mIsPerformanceOverlayEnabled = true;
+    pGUI->setSettings(Settings);
+    double const OverlayTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "performance overlay costs", OverlayTime - ClientMemoryTime, "ms/frame");
+
+    Settings.mIsPerformanceOverlayEnabled = false;
+
+    Settings.mIsMeshBufferStreamingEnabled = true;
+    pGUI->setSettings(Settings);
+    double const StreamTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "stream mesh buffers", StreamTime, "ms/frame");
+
+    Settings.mIsMeshBufferStreamingEnabled = false;
+    Settings.mIsGUILayerEnabled            = true;
+    pGUI->setSettings(Settings);
+    double const LayerTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "GUI layer (static GUI)", LayerTime, "ms/frame");
+
+    irr::u32 const NumberOfLayerFrames = rStatistics.mNumberOfCachedLayerFrames + rStatistics.mNumberOfRenderedLayerFrames;
+    Benchmark::printResult(pName, "GUI layer cached frames", (100.0 * rStatistics.mNumberOfCachedLayerFrames) / NumberOfLayerFrames, "%");
+
+    Settings.mIsGUILayerEnabled           = false;
+    Settings.mIsPipelinedRenderingEnabled = true;
+    pGUI->setSettings(Settings);
+    double const PipelineTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "pipelined", PipelineTime, "ms/frame");
+    Benchmark::printResult(pName, "pipelined added latency", rStatistics.mPipelineLatency, "ms");
+    Benchmark::printResult(pName, "pipelined wait for worker", rStatistics.mPipelineWaitTime, "ms");
+
+    Settings.mIsPipelinedRenderingEnabled = false;
+    pGUI->setSettings(Settings);
+
+    Settings.mClippingMode = ECM_VIEWPORT;
+    pGUI->setSettings(Settings);
+    double const ViewPortTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "clipping with viewport", ViewPortTime, "ms/frame");
+
+    Settings.mClippingMode = ECM_SCISSOR;
+    pGUI->setSettings(Settings);
+    double const ScissorTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "clipping with scissor", ScissorTime, "ms/frame");
+
+    Settings.mClippingMode = ECM_CPU;
+    pGUI->setSettings(Settings);
+    double const CPUClippingTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "clipping on CPU", CPUClippingTime, "ms/frame");
+    Benchmark::printResult(pName, "clipping on CPU draw calls", rStatistics.mNumberOfDrawCalls, "calls/frame");
+    Benchmark::printResult(pName, "clipping on CPU cut triangles", rStatistics.mNumberOfCutTriangles, "triangles/frame");
+
+    Settings.mClippingMode = ECM_CLIP_PLANES;
+    Settings.mIsFrameMergingEnabled = true;
+    pGUI->setSettings(Settings);
+    double const FrameMergingTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "merged frame", FrameMergingTime, "ms/frame");
+    Benchmark::printResult(pName, "merged frame calls", rStatistics.mNumberOfDrawCalls, "calls/frame");
+
+    Settings.mClippingMode = ECM_CPU;
+    pGUI->setSettings(Settings);
+    double const FrameMergingCPUClippingTime = Benchmark::measureGUIFrame(pDevice, pGUI, NumberOfWindows, 200);
+    Benchmark::printResult(pName, "merged + CPU clipping", FrameMergingCPUClippingTime, "ms/frame");
+    Benchmark::printResult(pName, "merged + CPU clip calls", rStatistics.mNumberOfDrawCalls, "calls/frame");
+
+    Settings.mClippingMode = ECM_CLIP_PLANES;
+    Settings.mIsFrameMergingEnabled = false;
+    pGUI->setSettings(Settings);
+
+    return;
+  }
+}
+
+BENCHMARK(RenderModes)
+{
+  irr::IrrlichtDevice * const pDevice = Benchmark::createRenderDevice();
+  if (pDevice == nullptr)
+  {
+    Benchmark::printResult("skipped", "no render device", 0.0, "");
+    return;
+  }
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  measureRenderModes(pDevice, pGUI, "4 windows",  4);
+  measureRenderModes(pDevice, pGUI, "16 windows", 16);
+  measureRenderModes(pDevice, pGUI, "64 windows", 64);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
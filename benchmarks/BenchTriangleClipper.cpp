@@ -0,0 +1,105 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+/**
+ * @file   BenchTriangleClipper.cpp
+ * @brief  Measures the clipping of GUI triangles on the CPU.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <CTriangleClipper.h>
+
+// module includes
+#include "Benchmark.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Number of quads of the benchmark (about the size of a text heavy window).
+  irr::u32 const NumberOfQuads = 8192;
+
+  /// @brief Size of a quad in pixel (about the size of a glyph).
+  irr::f32 const QuadSize = 8.0f;
+
+  /// @brief Measures the clipping of quads, that are placed in a grid.
+  /// @param pName         Is the name of the benchmark.
+  /// @param rClippingRect Is the clipping rectangle for all quads.
+  void measureClipping(char const * const pName, ImVec4 const &rClippingRect)
+  {
+    irr::u32 const QuadsPerRow = 128;
+    std::vector<irr::video::S3DVertex> Vertices(NumberOfQuads * 4);
+    std::vector<irr::u16>              Indices;
+    Indices.reserve(NumberOfQuads * 6);
+
+    for (irr::u32 i = 0; i < NumberOfQuads; i++)
+    {
+      irr::f32 const X = static_cast<irr::f32>(i % QuadsPerRow) * QuadSize;
+      irr::f32 const Y = static_cast<irr::f32>(i / QuadsPerRow) * QuadSize;
+
+      Vertices[i * 4 + 0].Pos = irr::core::vector3df(X,            Y,            0.0f);
+      Vertices[i * 4 + 1].Pos = irr::core::vector3df(X + QuadSize, Y,            0.0f);
+      Vertices[i * 4 + 2].Pos = irr::core::vector3df(X + QuadSize, Y + QuadSize, 0.0f);
+      Vertices[i * 4 + 3].Pos = irr::core::vector3df(X,            Y + QuadSize, 0.0f);
+
+      irr::u16 const FirstIndex = static_cast<irr::u16>(i * 4);
+      irr::u16 const QuadIndices[] = {0, 1, 2, 0, 2, 3};
+      for (irr::u16 const Index : QuadIndices)
+      {
+        Indices.push_back(static_cast<irr::u16>(FirstIndex + Index));
+      }
+    }
+
+    Private::CTriangleClipper Clipper;
+
+    double const Time = Benchmark::measureNanoseconds(200, [&]()
+    {
+      Clipper.begin(Vertices.data(), Vertices.size(), irr::core::vector3df(0.0f, 0.0f, 0.0f));
+      Clipper.addTriangles(Indices.data(), Indices.size(), rClippingRect);
+      Benchmark::doNotOptimize(Clipper.getIndices());
+    });
+
+    Benchmark::printResult(pName, "clip triangles", Time / (NumberOfQuads * 2), "ns/triangle");
+    Benchmark::printResult(pName, "cut triangles", (100.0 * Clipper.getNumberOfCutTriangles()) / (NumberOfQuads * 2), "%");
+    Benchmark::printResult(pName, "removed triangles", (100.0 * Clipper.getNumberOfRemovedTriangles()) / (NumberOfQuads * 2), "%");
+
+    return;
+  }
+}
+
+BENCHMARK(TriangleClipper)
+{
+  irr::f32 const Width  = 128.0f * QuadSize;
+  irr::f32 const Height = static_cast<irr::f32>(NumberOfQuads / 128) * QuadSize;
+
+  measureClipping("all inside",      ImVec4(0.0f, 0.0f, Width, Height));
+  measureClipping("half visible",    ImVec4(0.0f, 0.0f, Width, Height / 2.0f));
+  measureClipping("border on quads", ImVec4(QuadSize / 2.0f, QuadSize / 2.0f, Width - QuadSize / 2.0f, Height - QuadSize / 2.0f));
+
+  return;
+}
@@ -0,0 +1,134 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchVertexConversion.cpp
+ * @brief  Measures the conversion of IMGUI vertices to Irrlicht vertices.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUISIMD_priv.h>
+
+// module includes
+#include "Benchmark.h"
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Number of vertices of a typical window (fits into the L1/L2 cache).
+  irr::u32 const NumberOfSmallListVertices = 4096;
+
+  /// @brief Number of vertices of a huge draw list (does not fit into the cache).
+  irr::u32 const NumberOfHugeListVertices = 131072;
+
+  /// @brief The color conversion of IrrIMGUI 0.3 (reference for the benchmark).
+  irr::video::SColor getColorFromImGuiColorLegacy(irr::u32 const ImGuiColor)
+  {
+    ImColor const Color(ImGuiColor);
+
+    irr::u8 const Red   = static_cast<irr::u8>(Color.Value.x * 255);
+    irr::u8 const Green = static_cast<irr::u8>(Color.Value.y * 255);
+    irr::u8 const Blue  = static_cast<irr::u8>(Color.Value.z * 255);
+    irr::u8 const Alpha = static_cast<irr::u8>(Color.Value.w * 255);
+
+    return irr::video::SColor(Alpha, Red, Green, Blue);
+  }
+
+  /// @brief The vertex conversion of IrrIMGUI 0.3 (reference for the benchmark).
+  void copyImGuiVertices2IrrlichtVerticesLegacy(ImDrawVert const * const pSource, irr::video::S3DVertex * const pIrrlichtVertex, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    for (irr::u32 i = 0; i < NumberOfVertex; i++)
+    {
+      ImDrawVert const &rImGUIVertex = pSource[i];
+
+      pIrrlichtVertex[i].Pos     = irr::core::vector3df(static_cast<irr::f32>(rImGUIVertex.pos.x), static_cast<irr::f32>(rImGUIVertex.pos.y), 0.0) + rOffset;
+      pIrrlichtVertex[i].Normal  = irr::core::vector3df(0.0, 0.0, 1.0);
+      pIrrlichtVertex[i].Color   = getColorFromImGuiColorLegacy(rImGUIVertex.col);
+      pIrrlichtVertex[i].TCoords = irr::core::vector2df(static_cast<irr::f32>(rImGUIVertex.uv.x), static_cast<irr::f32>(rImGUIVertex.uv.y));
+    }
+  }
+
+  /// @brief Measures all conversion functions for a draw list.
+  /// @param pName            Is the name of the benchmark.
+  /// @param NumberOfVertices Is the number of vertices of the draw list.
+  void measureVertexConversion(char const * const pName, irr::u32 const NumberOfVertices)
+  {
+    std::vector<ImDrawVert>            GUIVertices(NumberOfVertices);
+    std::vector<irr::video::S3DVertex> IrrVertices(NumberOfVertices);
+    irr::core::vector3df const         Offset(-0.375f, -0.375f, 0.0f);
+    irr::u32 const                     Repetitions = (NumberOfHugeListVertices / NumberOfVertices) * 20;
+
+    for (irr::u32 i = 0; i < NumberOfVertices; i++)
+    {
+      GUIVertices[i].pos.x = static_cast<float>(i % 1920);
+      GUIVertices[i].pos.y = static_cast<float>(i / 1920);
+      GUIVertices[i].uv.x  = static_cast<float>(i % 512) / 512.0f;
+      GUIVertices[i].uv.y  = static_cast<float>(i % 256) / 256.0f;
+      GUIVertices[i].col   = 0xFF000000 | (i * 2654435761u >> 8);
+    }
+
+    double const LegacyTime = Benchmark::measureNanoseconds(Repetitions, [&]()
+    {
+      copyImGuiVertices2IrrlichtVerticesLegacy(GUIVertices.data(), IrrVertices.data(), NumberOfVertices, Offset);
+      Benchmark::doNotOptimize(IrrVertices.data());
+    });
+    Benchmark::printResult(pName, "Legacy (float color)", LegacyTime / NumberOfVertices, "ns/vertex");
+
+    Private::SIMD::EInstructionSet const OriginalInstructionSet = Private::SIMD::getInstructionSet();
+
+    for (int Set = Private::SIMD::EIS_SCALAR; Set < Private::SIMD::EIS_COUNT; Set++)
+    {
+      Private::SIMD::EInstructionSet const InstructionSet = static_cast<Private::SIMD::EInstructionSet>(Set);
+      if (!Private::SIMD::isInstructionSetSupported(InstructionSet))
+      {
+        continue;
+      }
+
+      Private::SIMD::setInstructionSet(InstructionSet);
+
+      double const Time = Benchmark::measureNanoseconds(Repetitions, [&]()
+      {
+        Private::SIMD::convertVertices(GUIVertices.data(), IrrVertices.data(), NumberOfVertices, Offset);
+        Benchmark::doNotOptimize(IrrVertices.data());
+      });
+      Benchmark::printResult(pName, Private::SIMD::getInstructionSetName(InstructionSet), Time / NumberOfVertices, "ns/vertex");
+    }
+
+    Private::SIMD::setInstructionSet(OriginalInstructionSet);
+
+    return;
+  }
+}
+
+BENCHMARK(VertexConversion)
+{
+  measureVertexConversion("4k vertices",   NumberOfSmallListVertices);
+  measureVertexConversion("128k vertices", NumberOfHugeListVertices);
+
+  return;
+}
@@ -0,0 +1,118 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   Benchmark.cpp
+ * @brief  Contains a minimal benchmark framework for IrrIMGUI.
+ */
+
+// library includes
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// module includes
+#include "Benchmark.h"
+
+namespace IrrIMGUI
+{
+namespace Benchmark
+{
+
+  /// @brief A single entry of the benchmark registry.
+  struct SBenchmarkEntry
+  {
+    char const *      mpName;
+    BenchmarkFunction mpFunction;
+  };
+
+  /// @return Returns the list of registered benchmarks (created at first use, to be independent from static initialization order).
+  static std::vector<SBenchmarkEntry> &getBenchmarks(void)
+  {
+    static std::vector<SBenchmarkEntry> Benchmarks;
+    return Benchmarks;
+  }
+
+  void CBenchmarkRegistry::addBenchmark(char const * const pName, BenchmarkFunction const pFunction)
+  {
+    SBenchmarkEntry const Entry = {pName, pFunction};
+    getBenchmarks().push_back(Entry);
+
+    return;
+  }
+
+  irr::u32 CBenchmarkRegistry::runBenchmarks(char const * const pFilter)
+  {
+    irr::u32 NumberOfBenchmarks = 0;
+
+    for (SBenchmarkEntry const &rEntry : getBenchmarks())
+    {
+      if ((pFilter != nullptr) && (std::strstr(rEntry.mpName, pFilter) == nullptr))
+      {
+        continue;
+      }
+
+      std::cout << "[" << rEntry.mpName << "]" << std::endl;
+      rEntry.mpFunction();
+      std::cout << std::endl;
+
+      NumberOfBenchmarks++;
+    }
+
+    return NumberOfBenchmarks;
+  }
+
+  void CBenchmarkRegistry::listBenchmarks(void)
+  {
+    for (SBenchmarkEntry const &rEntry : getBenchmarks())
+    {
+      std::cout << "  " << rEntry.mpName << std::endl;
+    }
+
+    return;
+  }
+
+  void printResult(char const * const pBenchmark, char const * const pVariant, double const Value, char const * const pUnit)
+  {
+    std::cout << "  " << std::left << std::setw(28) << pBenchmark
+              << " " << std::setw(24) << pVariant
+              << " " << std::right << std::setw(12) << std::fixed << std::setprecision(3) << Value
+              << " " << pUnit << std::endl;
+
+    return;
+  }
+
+  void doNotOptimize(void const * const pData)
+  {
+    // the compiler cannot know, what happens with the pointer here
+    static void const * volatile pSink = nullptr;
+    pSink = pData;
+
+    return;
+  }
+
+}
+}
@@ -0,0 +1,132 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   Benchmark.h
+ * @brief  Contains a minimal benchmark framework for IrrIMGUI.
+ */
+
+#ifndef IRRIMGUI_BENCHMARKS_BENCHMARK_H_
+#define IRRIMGUI_BENCHMARKS_BENCHMARK_H_
+
+// library includes
+#include <chrono>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+namespace IrrIMGUI
+{
+/// @brief Contains the benchmark framework.
+namespace Benchmark
+{
+
+  /// @brief A function that executes a benchmark and prints the results.
+  typedef void (*BenchmarkFunction)(void);
+
+  /// @brief Stores all benchmarks of the executable.
+  class CBenchmarkRegistry
+  {
+    public:
+      /// @brief Adds a benchmark to the registry.
+      /// @param pName     Is the name of the benchmark.
+      /// @param pFunction Is the benchmark function.
+      static void addBenchmark(char const * pName, BenchmarkFunction pFunction);
+
+      /// @brief Runs all benchmarks, where the name contains a filter string.
+      /// @param pFilter Is the filter string. When it is nullptr, all benchmarks are executed.
+      /// @return Returns the number of executed benchmarks.
+      static irr::u32 runBenchmarks(char const * pFilter);
+
+      /// @brief Prints the names of all benchmarks.
+      static void listBenchmarks(void);
+  };
+
+  /// @brief Helper class to register a benchmark before main() is called.
+  class CBenchmarkRegistration
+  {
+    public:
+      /// @brief Constructor.
+      /// @param pName     Is the name of the benchmark.
+      /// @param pFunction Is the benchmark function.
+      CBenchmarkRegistration(char const * pName, BenchmarkFunction pFunction)
+      {
+        CBenchmarkRegistry::addBenchmark(pName, pFunction);
+      }
+  };
+
+  /// @brief Measures the duration of a function.
+  /// @param Repetitions Is the number of calls in one measurement.
+  /// @param Function    Is the function (or lambda) to measure.
+  /// @return Returns the fastest duration of a single call in nanoseconds (best of 5 measurements).
+  template <typename TFunction>
+  double measureNanoseconds(irr::u32 const Repetitions, TFunction Function)
+  {
+    double BestTime = 0.0;
+
+    // warm up caches and the branch prediction
+    Function();
+
+    for (irr::u32 Measurement = 0; Measurement < 5; Measurement++)
+    {
+      std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+
+      for (irr::u32 i = 0; i < Repetitions; i++)
+      {
+        Function();
+      }
+
+      std::chrono::high_resolution_clock::time_point const End = std::chrono::high_resolution_clock::now();
+      double const Time = std::chrono::duration<double, std::nano>(End - Start).count() / Repetitions;
+
+      if ((Measurement == 0) || (Time < BestTime))
+      {
+        BestTime = Time;
+      }
+    }
+
+    return BestTime;
+  }
+
+  /// @brief Prints a single result line.
+  /// @param pBenchmark Is the name of the benchmark.
+  /// @param pVariant   Is the name of the measured variant.
+  /// @param Value      Is the measured value.
+  /// @param pUnit      Is the unit of the value.
+  void printResult(char const * pBenchmark, char const * pVariant, double Value, char const * pUnit);
+
+  /// @brief Prevents the compiler from removing a calculation, which result is not used.
+  /// @param pData Is a pointer to the result.
+  void doNotOptimize(void const * pData);
+
+}
+}
+
+/// @brief Defines and registers a benchmark function.
+/// @param Name Is the name of the benchmark.
+#define BENCHMARK(Name) \
+  static void Benchmark##Name(void); \
+  static IrrIMGUI::Benchmark::CBenchmarkRegistration BenchmarkRegistration##Name(#Name, Benchmark##Name); \
+  static void Benchmark##Name(void)
+
+#endif /* IRRIMGUI_BENCHMARKS_BENCHMARK_H_ */
@@ -0,0 +1,142 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchmarkGUI.cpp
+ * @brief  Contains helper functions for benchmarks, that render a complete GUI.
+ */
+
+// library includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+// module includes
+#include "Benchmark.h"
+#include "BenchmarkGUI.h"
+
+namespace IrrIMGUI
+{
+namespace Benchmark
+{
+
+  /// @return Returns the video driver, that is selected with the environment variable IRRIMGUI_BENCHMARK_DRIVER.
+  static irr::video::E_DRIVER_TYPE getRenderDriverType(void)
+  {
+    char const * const pDriverName = std::getenv("IRRIMGUI_BENCHMARK_DRIVER");
+
+    if (pDriverName == nullptr)
+    {
+      return irr::video::EDT_OPENGL;
+    }
+    else if (std::strcmp(pDriverName, "burnings") == 0)
+    {
+      return irr::video::EDT_BURNINGSVIDEO;
+    }
+    else if (std::strcmp(pDriverName, "software") == 0)
+    {
+      return irr::video::EDT_SOFTWARE;
+    }
+    else if (std::strcmp(pDriverName, "null") == 0)
+    {
+      return irr::video::EDT_NULL;
+    }
+
+    return irr::video::EDT_OPENGL;
+  }
+
+  irr::IrrlichtDevice * createRenderDevice(void)
+  {
+    irr::SIrrlichtCreationParameters IrrlichtParams;
+    IrrlichtParams.DriverType = getRenderDriverType();
+    IrrlichtParams.WindowSize = irr::core::dimension2d<irr::u32>(1280, 720);
+    IrrlichtParams.Bits       = 32;
+    IrrlichtParams.Fullscreen = false;
+    IrrlichtParams.Vsync      = false;
+
+    return irr::createDeviceEx(IrrlichtParams);
+  }
+
+  void buildGUI(irr::u32 const NumberOfWindows)
+  {
+    static bool  IsChecked   = true;
+    static float SliderValue = 0.5f;
+    static float PlotValues[64];
+
+    for (int i = 0; i < 64; i++)
+    {
+      PlotValues[i] = static_cast<float>((i * 37) % 64) / 64.0f;
+    }
+
+    for (irr::u32 Window = 0; Window < NumberOfWindows; Window++)
+    {
+      char WindowName[32];
+      std::snprintf(WindowName, sizeof(WindowName), "Window %u", Window);
+
+      ImGui::SetNextWindowPos(ImVec2(10.0f + static_cast<float>(Window % 4) * 315.0f, 10.0f + static_cast<float>((Window / 4) % 4) * 175.0f));
+      ImGui::SetNextWindowSize(ImVec2(305.0f, 165.0f));
+
+      ImGui::Begin(WindowName, nullptr, ImGuiWindowFlags_ShowBorders | ImGuiWindowFlags_NoSavedSettings);
+      ImGui::Text("Statistics of window %u", Window);
+      ImGui::Button("Apply");
+      ImGui::SameLine();
+      ImGui::Checkbox("Enabled", &IsChecked);
+      ImGui::SliderFloat("Value", &SliderValue, 0.0f, 1.0f);
+      ImGui::PlotLines("Plot", PlotValues, 64);
+      ImGui::Separator();
+
+      for (int Line = 0; Line < 8; Line++)
+      {
+        ImGui::Text("Line %d: The quick brown fox jumps over the lazy dog.", Line);
+      }
+
+      ImGui::End();
+    }
+
+    return;
+  }
+
+  double measureGUIFrame(irr::IrrlichtDevice * const pDevice, IIMGUIHandle * const pGUI, irr::u32 const NumberOfWindows, irr::u32 const NumberOfFrames)
+  {
+    irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+
+    double const Time = measureNanoseconds(NumberOfFrames, [&]()
+    {
+      pDevice->run();
+      pDriver->beginScene(true, true, irr::video::SColor(255, 100, 101, 140));
+
+      pGUI->startGUI();
+      buildGUI(NumberOfWindows);
+      pGUI->drawAll();
+
+      pDriver->endScene();
+    });
+
+    return Time / 1000000.0;
+  }
+
+}
+}
@@ -0,0 +1,65 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchmarkGUI.h
+ * @brief  Contains helper functions for benchmarks, that render a complete GUI.
+ */
+
+#ifndef IRRIMGUI_BENCHMARKS_BENCHMARKGUI_H_
+#define IRRIMGUI_BENCHMARKS_BENCHMARKGUI_H_
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+
+namespace IrrIMGUI
+{
+namespace Benchmark
+{
+
+  /// @brief Creates an Irrlicht device for render benchmarks.
+  /// @details The video driver is selected with the environment variable IRRIMGUI_BENCHMARK_DRIVER
+  ///          ("opengl" (default), "burnings", "software" or "null"). To measure with a software
+  ///          OpenGL implementation like Mesa llvmpipe, start the benchmark with LIBGL_ALWAYS_SOFTWARE=1.
+  /// @return Returns the device or nullptr, when the video driver is not available (e.g. without a display).
+  irr::IrrlichtDevice * createRenderDevice(void);
+
+  /// @brief Builds a GUI with several tool windows (must be called between startGUI and drawAll).
+  /// @param NumberOfWindows Is the number of windows with text, widgets and plots.
+  void buildGUI(irr::u32 NumberOfWindows);
+
+  /// @brief Measures the time to build and render a complete GUI frame.
+  /// @param pDevice         Is a pointer to the Irrlicht device.
+  /// @param pGUI            Is a pointer to the GUI handle.
+  /// @param NumberOfWindows Is the number of windows to render (see buildGUI).
+  /// @param NumberOfFrames  Is the number of frames in one measurement.
+  /// @return Returns the fastest duration of a single frame in milliseconds.
+  double measureGUIFrame(irr::IrrlichtDevice * pDevice, IIMGUIHandle * pGUI, irr::u32 NumberOfWindows, irr::u32 NumberOfFrames);
+
+}
+}
+
+#endif /* IRRIMGUI_BENCHMARKS_BENCHMARKGUI_H_ */
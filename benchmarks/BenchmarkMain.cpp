@@ -0,0 +1,68 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file   BenchmarkMain.cpp
+ * @brief  Main function of the benchmark executable.
+ * @details Usage: Benchmarks [--list] [Filter]
+ *          Without arguments all benchmarks are executed. With a filter only benchmarks
+ *          are executed, where the name contains the filter string.
+ *          Render benchmarks select the video driver with the environment variable
+ *          IRRIMGUI_BENCHMARK_DRIVER (see BenchmarkGUI.h).
+ */
+
+// library includes
+#include <cstring>
+#include <iostream>
+
+// module includes
+#include "Benchmark.h"
+
+int main(int ArgumentCount, char * Arguments[])
+{
+  char const * pFilter = nullptr;
+
+  if (ArgumentCount > 1)
+  {
+    if (std::strcmp(Arguments[1], "--list") == 0)
+    {
+      std::cout << "Available benchmarks:" << std::endl;
+      IrrIMGUI::Benchmark::CBenchmarkRegistry::listBenchmarks();
+      return 0;
+    }
+
+    pFilter = Arguments[1];
+  }
+
+  irr::u32 const NumberOfBenchmarks = IrrIMGUI::Benchmark::CBenchmarkRegistry::runBenchmarks(pFilter);
+
+  if (NumberOfBenchmarks == 0)
+  {
+    std::cout << "No benchmark found for filter '" << (pFilter ? pFilter : "") << "'. Use --list to show all benchmarks." << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
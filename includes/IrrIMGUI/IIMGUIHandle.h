@@ -35,6 +35,7 @@
 #include "IGUITexture.h"
 #include "IReferenceCounter.h"
 #include "SIMGUISettings.h"
+#include "SIMGUIStatistics.h"
 
 /**
  * @addtogroup IrrIMGUI
@@ -60,6 +61,22 @@ namespace IrrIMGUI
       /// @brief Call this function after "startGUI()" and after you draw your GUI elements. It will render all elements to the screen (do not call it before rendering the 3D Scene!).
       virtual void drawAll(void) = 0;
 
+      /// @brief Forces the GUI to be rendered again into the GUI layer texture in the next frame.
+      /// @note  Call this function when the content of an Irrlicht texture used by the GUI has been changed without updateTexture(...).
+      ///        It has only an effect, when the GUI layer is enabled in the settings.
+      virtual void invalidateGUILayer(void) = 0;
+
+      /// @brief Sets the render target, that is bound when "drawAll()" is called (nullptr is the frame buffer, which is the default).
+      /// @note  Irrlicht cannot return the current render target, thus the GUI layer binds this render target again after it
+      ///        has rendered the GUI into its own texture. It has only an effect, when the GUI layer is enabled in the settings.
+      /// @param pRenderTarget Is the render target texture or nullptr. It must not be removed while it is set.
+      virtual void setRenderTarget(irr::video::ITexture * pRenderTarget) = 0;
+
+      /// @brief Tells the OpenGL renderers, that the application has changed the OpenGL state since the last GUI frame.
+      ///        The state, that is changed by the GUI, is read again from OpenGL in the next frame.
+      /// @note  Call this function only when SIMGUISettings::mIsOpenGLHostStatePersistent is true. The Irrlicht renderer ignores it.
+      virtual void invalidateOpenGLState(void) = 0;
+
       /// @}
 
       /// @{
@@ -72,6 +89,26 @@ namespace IrrIMGUI
       /// @note  The settings are applied to all GUI handles at the same time, since IMGUI uses internally a single instance.
       virtual void setSettings(SIMGUISettings const &rSettings) = 0;
 
+      /// @return Returns the render backend, that draws the GUI. It is selected with SIMGUISettings::mRenderBackend, when the first GUI handle is created.
+      virtual ERenderBackend getRenderBackend(void) const = 0;
+
+      /// @}
+
+      /// @{
+      /// @name GUI statistics
+
+      /// @return Returns a constant reference to the render statistics of the last GUI frame.
+      virtual SIMGUIStatistics const &getStatistics(void) const = 0;
+
+      /// @return Returns a constant reference to the averages and percentiles of the render statistics over the last
+      ///         SIMGUISettings::mNumberOfStatisticFrames GUI frames.
+      virtual SIMGUIStatisticsSummary const &getStatisticsSummary(void) const = 0;
+
+      /// @brief Shows a small window in the upper left corner with graphs of the frame time and the GUI time and the render statistics.
+      ///        Call it every frame between "startGUI()" and "drawAll()", or enable SIMGUISettings::mIsPerformanceOverlayEnabled instead.
+      ///        The overlay itself is not counted by the render statistics.
+      virtual void drawPerformanceOverlay(void) = 0;
+
       /// @}
 
       /// @{
@@ -176,6 +213,15 @@ namespace IrrIMGUI
       /// @return Returns an GUI texture object.
       virtual IGUITexture *createTexture(irr::video::IImage * pImage) = 0;
 
+      /// @brief Creates a GUI texture object out of an Irrlicht image, that can be marked for streaming.
+      /// @details Streaming textures are updated in place by updateTexture(pGUITexture, pImage), as long as the image
+      ///          has the same size. Thus images, that change every frame (like videos), do not allocate a new GPU texture
+      ///          with every update (see SIMGUIStatistics::mNumberOfTextureAllocations).
+      /// @param pImage      Is a pointer to an Irrlicht image object.
+      /// @param IsStreaming Is true, when the texture should be updated in place.
+      /// @return Returns an GUI texture object.
+      virtual IGUITexture *createTexture(irr::video::IImage * pImage, bool IsStreaming) = 0;
+
       /// @brief Creates a GUI texture object out of an Irrlicht texture.
       /// @param pTexture Is a pointer to an Irrlicht texture object.
       /// @return Returns an GUI texture object.
@@ -191,6 +237,20 @@ namespace IrrIMGUI
       /// @param pTexture    Is a pointer to an Irrlicht image object.
       virtual void updateTexture(IGUITexture * pGUITexture, irr::video::ITexture * pTexture) = 0;
 
+      /// @brief Writes raw pixel data into a rectangle of a GUI texture.
+      /// @details Only the rectangle is copied into the existing texture, thus it is much faster than updateTexture(...)
+      ///          for small changing regions of large textures. The size of the texture does not change.
+      /// @param pGUITexture Is a pointer to the GUI texture object.
+      /// @param ColorFormat Is the Irrlicht color format of the pixel data.
+      /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+      /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+      /// @param X           Is the left border of the rectangle inside the texture.
+      /// @param Y           Is the upper border of the rectangle inside the texture.
+      /// @param Width       Is the number of Pixels in X direction.
+      /// @param Height      Is the number of Pixels in Y direction.
+      /// @note  When the rectangle is not completely inside the texture, nothing is updated.
+      virtual void updateTextureRegion(IGUITexture * pGUITexture, irr::video::ECOLOR_FORMAT ColorFormat, void const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height) = 0;
+
       /**
        * @brief Deletes an texture from graphic memory.
        * @param pGUITexture Is a pointer to the texture to delete. Do not use it afterwards!
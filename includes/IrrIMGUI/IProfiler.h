@@ -0,0 +1,100 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IProfiler.h
+ * @author Andre Netzeband
+ * @brief  Contains an interface to measure the frame phases of IrrIMGUI with an own profiler.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_IPROFILER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_IPROFILER_H_
+
+// module includes
+#include "IrrIMGUIConfig.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+
+  /// @brief The zones, that are reported to a profiler.
+  enum EProfilerZone
+  {
+    /// @brief IIMGUIHandle::startGUI(), contains EPZ_UPDATE_FRAME_VALUES and EPZ_NEW_FRAME.
+    EPZ_START_GUI,
+    /// @brief Passes the time and the input events of the frame to IMGUI.
+    EPZ_UPDATE_FRAME_VALUES,
+    /// @brief ImGui::NewFrame().
+    EPZ_NEW_FRAME,
+    /// @brief IIMGUIHandle::drawAll(), contains EPZ_RENDER, EPZ_CONVERSION and EPZ_SUBMISSION.
+    EPZ_DRAW_ALL,
+    /// @brief ImGui::Render(), which creates the draw data of the frame.
+    EPZ_RENDER,
+    /// @brief The conversion of the draw data by the renderer (with pipelined rendering on the worker thread).
+    EPZ_CONVERSION,
+    /// @brief The submission of the draw data to the render driver.
+    EPZ_SUBMISSION,
+    /// @brief The creation of a GUI texture.
+    EPZ_CREATE_TEXTURE,
+    /// @brief The update of a GUI texture.
+    EPZ_UPDATE_TEXTURE,
+    /// @brief The deletion of a GUI texture.
+    EPZ_DELETE_TEXTURE,
+    /// @brief The number of zones.
+    EPZ_COUNT
+  };
+
+  /// @param Zone Is a profiler zone.
+  /// @return Returns a readable name of the zone (e.g. "NewFrame").
+  IRRIMGUI_DLL_API char const * getProfilerZoneName(EProfilerZone Zone);
+
+  /// @brief Interface for a profiler, that receives the begin and the end of every IrrIMGUI zone (see Inject::setProfiler(...)).
+  /// @details The methods are called from the render thread and, with pipelined rendering, from the worker thread of the
+  ///          render pipeline. Thus they must be thread safe. Zones of the same thread are always properly nested.
+  class IRRIMGUI_DLL_API IProfiler
+  {
+    public:
+      /// @brief Destructor.
+      virtual ~IProfiler(void) {}
+
+      /// @brief Is called, when a zone begins.
+      /// @param Zone Is the zone.
+      virtual void beginZone(EProfilerZone Zone) = 0;
+
+      /// @brief Is called, when a zone ends.
+      /// @param Zone Is the zone.
+      virtual void endZone(EProfilerZone Zone) = 0;
+  };
+
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_IPROFILER_H_ */
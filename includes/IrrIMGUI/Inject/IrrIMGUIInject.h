@@ -33,6 +33,7 @@
 
 // module includes
 #include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IProfiler.h>
 
 /**
  * @defgroup IrrIMGUIInject Inject
@@ -63,6 +64,14 @@ namespace Inject
   /// @return Returns the current factory function pointer for creating an IMGUI handle instance.
   IRRIMGUI_DLL_API IMGUIFactory * getIMGUIFactory(void);
 
+  /// @param pProfiler Is a pointer to the profiler, that receives the zones of IrrIMGUI (e.g. Tools::CChromeTraceProfiler).
+  ///        If it is NULL, no zones are reported. The profiler must exist, until it is removed again.
+  /// @note  Remove the profiler only, when no GUI is rendered, since the worker thread of the render pipeline might still report a zone.
+  IRRIMGUI_DLL_API void setProfiler(IProfiler * pProfiler = nullptr);
+
+  /// @return Returns the current profiler or NULL, when no profiler is set.
+  IRRIMGUI_DLL_API IProfiler * getProfiler(void);
+
   /**
    * @}
    */
@@ -51,15 +51,30 @@
 /// @brief If this is defined during compilation, it will include irrlicht library from with <Irrlicht/irrlicht.h> instead of <irrlicht.h>
 #define _IRRIMGUI_SUBDIR_IRRLICHT_INCLUDE_
 
-/// @brief If this is defined during compilation, it will use the native OpenGL renderer for IMGUI instead of the Irrlicht renderer.
-/// @attention This is only a fallback solution for testing. It is not officially supported by this lib!
+/// @brief If this is defined during compilation, the native OpenGL renderer is the default render backend (ERB_DEFAULT) instead of the Irrlicht renderer.
+///        When the OpenGL renderers are part of the library (see _IRRIMGUI_OPENGL_BACKENDS_), both can be selected at runtime with SIMGUISettings::mRenderBackend.
+/// @attention The OpenGL renderer is only a fallback solution for testing. It is not officially supported by this lib!
 #define _IRRIMGUI_NATIVE_OPENGL_
 
+/// @brief If this is defined during compilation, the native OpenGL renderers (ERB_OPENGL and ERB_OPENGL3) are compiled into the library,
+///        which must be linked with OpenGL then. CMake defines it, when OpenGL has been found. Without it, the Irrlicht renderer is always used.
+#define _IRRIMGUI_OPENGL_BACKENDS_
+
 /// @brief If this define is during compilation the OpenGL driver will assume the memory location where the OpenGL texture ID is stored
 ///        inside an ITexture object. This is very fast, but with new Irrlicht versions this method could fail.
 ///        Disable it, when the Example 6 (RenderWindow) does not work correctly.
 #define _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
 
+/// @brief If this is defined during compilation, the IMGUI vertex type (ImDrawVert) gets the same memory layout like irr::video::S3DVertex.
+///        The Irrlicht renderer can then use the IMGUI vertices directly, instead of copying them into an own buffer.
+/// @attention IMGUI and every application that uses IrrIMGUI must be compiled with the same setting!
+#define _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+/// @brief If this is defined during compilation, IMGUI uses 32 bit vertex indices (ImDrawIdx) instead of 16 bit indices.
+///        Without this define, draw lists with more than 65536 vertices are split into several draw calls by the renderer.
+/// @attention IMGUI and every application that uses IrrIMGUI must be compiled with the same setting!
+#define _IRRIMGUI_32BIT_INDICES_
+
 /// @}
 
 /// @{
@@ -200,6 +215,17 @@
 #define IMGUI_API IRRIMGUI_DLL_API
 #endif
 
+// IMGUI vertex layout
+#if defined(_IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// same memory layout like irr::video::S3DVertex (Pos, Normal, Color, TCoords), the fields z and normal are not touched by IMGUI
+#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT struct ImDrawVert { ImVec2 pos; float z; float normal[3]; ImU32 col; ImVec2 uv; }
+#endif
+
+// IMGUI index type
+#if defined(_IRRIMGUI_32BIT_INDICES_) && !defined(ImDrawIdx)
+#define ImDrawIdx unsigned int
+#endif
+
 /**
  * @}
  */
@@ -33,6 +33,7 @@
 
 // module includes
 #include "IrrIMGUIConfig.h"
+#include "IncludeIrrlicht.h"
 
 /**
  * @addtogroup IrrIMGUI
@@ -42,6 +43,41 @@
 namespace IrrIMGUI
 {
 
+  /// @brief The render backends, that can draw the GUI.
+  enum ERenderBackend
+  {
+    /// @brief The backend, that has been selected at compile time: ERB_OPENGL when _IRRIMGUI_NATIVE_OPENGL_ is defined, otherwise ERB_IRRLICHT.
+    ERB_DEFAULT,
+
+    /// @brief The GUI is drawn with the primitive drawing functions of Irrlicht. This works with all Irrlicht video drivers.
+    ERB_IRRLICHT,
+
+    /// @brief The GUI is drawn with native OpenGL functions. This needs the Irrlicht OpenGL video driver and a library, that has been
+    ///        built with OpenGL (_IRRIMGUI_OPENGL_BACKENDS_), otherwise ERB_IRRLICHT is used instead.
+    ERB_OPENGL,
+
+    /// @brief The GUI is drawn with an OpenGL 3.3 shader pipeline, which streams all draw lists of a frame through a single buffer.
+    ///        Without an OpenGL 3.3 context ERB_OPENGL is used instead.
+    ERB_OPENGL3
+  };
+
+  /// @brief The methods, that the Irrlicht renderer can use to clip the GUI at the clipping rectangles of IMGUI.
+  enum EClippingMode
+  {
+    /// @brief Four user clip planes are enabled for every clipping rectangle. This works with all render drivers.
+    ECM_CLIP_PLANES,
+
+    /// @brief The viewport is set to the clipping rectangle and the projection is adjusted to it. The GUI is drawn in 3D mode then.
+    ECM_VIEWPORT,
+
+    /// @brief The native scissor test of OpenGL is used. Other render drivers use ECM_VIEWPORT instead.
+    ECM_SCISSOR,
+
+    /// @brief The triangles are clipped on the CPU. Thus no clipping state is needed and draw commands with
+    ///        different clipping rectangles but the same texture are drawn with a single draw call.
+    ECM_CPU
+  };
+
   /// @brief Stores the settings of the IMGUI.
   struct IRRIMGUI_DLL_API SIMGUISettings
   {
@@ -50,7 +86,22 @@ namespace IrrIMGUI
       /// @brief Constructor to set the standard settings.
       SIMGUISettings(void):
         mIsGUIMouseCursorEnabled(true),
-        mIsIMGUIMemoryAllocationTrackingEnabled(true)
+        mIsIMGUIMemoryAllocationTrackingEnabled(true),
+        mIsDrawCommandMergingEnabled(true),
+        mIsMeshBufferStreamingEnabled(false),
+        mIsCommandListCacheEnabled(true),
+        mMaxCachedVertices(131072),
+        mIsGUILayerEnabled(false),
+        mNumberOfConversionThreads(1),
+        mIsPipelinedRenderingEnabled(false),
+        mClippingMode(ECM_CLIP_PLANES),
+        mIsFrameMergingEnabled(false),
+        mRenderBackend(ERB_DEFAULT),
+        mIsBufferObjectStreamingEnabled(true),
+        mIsOpenGLHostStatePersistent(true),
+        mIsOpenGLStateValidationEnabled(false),
+        mNumberOfStatisticFrames(120),
+        mIsPerformanceOverlayEnabled(false)
       {}
 
       /// @{
@@ -63,6 +114,81 @@ namespace IrrIMGUI
       ///        there is difference between both, IrrIMGUI will throw an assertion during shutdown.
       bool mIsIMGUIMemoryAllocationTrackingEnabled;
 
+      /// @brief When this is true, the Irrlicht renderer draws adjacent IMGUI draw commands with the same texture and clipping rectangle
+      ///        with a single draw call (default: true).
+      bool mIsDrawCommandMergingEnabled;
+
+      /// @brief When this is true, the Irrlicht renderer copies the GUI geometry into mesh buffers with the hardware mapping hint EHM_STREAM
+      ///        and draws them with drawMeshBuffer. Thus render drivers with hardware buffer support can upload the geometry into vertex
+      ///        buffer objects instead of drawing it from client memory (default: false).
+      bool mIsMeshBufferStreamingEnabled;
+
+      /// @brief When this is true, the Irrlicht renderer keeps the converted vertices of every IMGUI command list and reuses them
+      ///        as long as the command list does not change (default: true).
+      bool mIsCommandListCacheEnabled;
+
+      /// @brief The maximum number of vertices, that are kept by the command list cache. Every vertex needs 56 bytes plus
+      ///        the memory for the indices (default: 131072).
+      irr::u32 mMaxCachedVertices;
+
+      /// @brief When this is true, the GUI is rendered into a render target texture, which is drawn over the scene with a single quad.
+      ///        The GUI is only rendered again, when the draw data has changed since the last frame or when a texture has been updated
+      ///        with updateTexture(...). GUI images that show a render target texture are updated in every frame (default: false).
+      /// @note  Call IIMGUIHandle::invalidateGUILayer() after changing the content of other Irrlicht textures used by the GUI.
+      ///        When the render driver does not support render targets, the GUI is rendered like without this setting.
+      bool mIsGUILayerEnabled;
+
+      /// @brief The number of threads, that convert the IMGUI vertices to Irrlicht vertices (including the render thread).
+      ///        The value 0 starts one thread per CPU core. Only GUIs with many vertices are converted in parallel,
+      ///        the draw calls are always submitted by the render thread (default: 1).
+      irr::u32 mNumberOfConversionThreads;
+
+      /// @brief When this is true, the GUI of a frame is copied and prepared for rendering (e.g. the vertices are converted) by a worker
+      ///        thread, while the render thread submits the GUI of the frame before. This shortens the render thread, but the GUI
+      ///        is shown one frame later (see SIMGUIStatistics::mPipelineLatency). Only the Irrlicht renderer supports this,
+      ///        the OpenGL renderer ignores this setting. It can be changed at any time (default: false).
+      bool mIsPipelinedRenderingEnabled;
+
+      /// @brief The method, that the Irrlicht renderer uses to clip the GUI at the clipping rectangles of IMGUI. User clip planes are
+      ///        slow on fixed function pipelines and software renderers, thus ECM_VIEWPORT or ECM_SCISSOR are usually faster.
+      ///        ECM_CPU needs the fewest draw calls, since it merges draw commands with different clipping rectangles.
+      ///        The OpenGL renderer uses always the scissor test (default: ECM_CLIP_PLANES).
+      EClippingMode mClippingMode;
+
+      /// @brief When this is true, the Irrlicht renderer concatenates the geometry of all IMGUI command lists of a frame into a single
+      ///        vertex and index stream and draws it like a single command list. Thus draw commands of different windows can be merged
+      ///        and GUIs with many small windows need fewer draw calls. Frames with user callbacks are drawn list by list (default: false).
+      bool mIsFrameMergingEnabled;
+
+      /// @brief The render backend, that draws the GUI. It is only used, when the first GUI handle is created with createIMGUI(...)
+      ///        and cannot be changed afterwards. Use IIMGUIHandle::getRenderBackend() to get the backend, that is really used (default: ERB_DEFAULT).
+      ERenderBackend mRenderBackend;
+
+      /// @brief When this is true, the OpenGL renderer uploads the geometry of a frame once into a vertex and an index buffer object
+      ///        and draws every command with an offset into these buffers. When the OpenGL context does not support buffer objects
+      ///        (OpenGL 1.x without ARB_vertex_buffer_object), the geometry is drawn from client memory like without this setting.
+      ///        The Irrlicht renderer ignores this setting, see mIsMeshBufferStreamingEnabled instead (default: true).
+      bool mIsBufferObjectStreamingEnabled;
+
+      /// @brief The OpenGL renderer shadows the OpenGL state, that it changes, and restores only this state after the GUI has been drawn.
+      ///        When this is true, the state values, that have been read from OpenGL in the first frame, are reused in all following frames.
+      ///        Thus no OpenGL query stalls the render pipeline, but the application must call IIMGUIHandle::invalidateOpenGLState(), when it
+      ///        has changed this state (e.g. blending, depth test, culling, the bound texture or the matrix mode) since the last GUI frame.
+      ///        When this is false, the changed state is read again in every frame (default: true).
+      bool mIsOpenGLHostStatePersistent;
+
+      /// @brief When this is true, the OpenGL renderer compares its shadowed state with the real OpenGL state before and after every GUI frame.
+      ///        Differences are logged and counted in SIMGUIStatistics::mNumberOfStateMismatches. This is a debug mode and very slow (default: false).
+      bool mIsOpenGLStateValidationEnabled;
+
+      /// @brief The number of frames, that are used for the averages and percentiles of IIMGUIHandle::getStatisticsSummary().
+      ///        The value 0 disables the summary (default: 120).
+      irr::u32 mNumberOfStatisticFrames;
+
+      /// @brief When this is true, a small window in the upper left corner shows graphs of the frame time and the GUI time
+      ///        and the render statistics (see IIMGUIHandle::drawPerformanceOverlay()). The overlay is not counted by the statistics (default: false).
+      bool mIsPerformanceOverlayEnabled;
+
       /// @}
 
       bool operator==(SIMGUISettings const &rCompareSettings)
@@ -70,6 +196,21 @@ namespace IrrIMGUI
         bool AreAllSettingsEqual = true;
 
         AreAllSettingsEqual = AreAllSettingsEqual && (mIsGUIMouseCursorEnabled == rCompareSettings.mIsGUIMouseCursorEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsDrawCommandMergingEnabled == rCompareSettings.mIsDrawCommandMergingEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsMeshBufferStreamingEnabled == rCompareSettings.mIsMeshBufferStreamingEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsCommandListCacheEnabled == rCompareSettings.mIsCommandListCacheEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mMaxCachedVertices == rCompareSettings.mMaxCachedVertices);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsGUILayerEnabled == rCompareSettings.mIsGUILayerEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mNumberOfConversionThreads == rCompareSettings.mNumberOfConversionThreads);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsPipelinedRenderingEnabled == rCompareSettings.mIsPipelinedRenderingEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mClippingMode == rCompareSettings.mClippingMode);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsFrameMergingEnabled == rCompareSettings.mIsFrameMergingEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mRenderBackend == rCompareSettings.mRenderBackend);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsBufferObjectStreamingEnabled == rCompareSettings.mIsBufferObjectStreamingEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsOpenGLHostStatePersistent == rCompareSettings.mIsOpenGLHostStatePersistent);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsOpenGLStateValidationEnabled == rCompareSettings.mIsOpenGLStateValidationEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mNumberOfStatisticFrames == rCompareSettings.mNumberOfStatisticFrames);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsPerformanceOverlayEnabled == rCompareSettings.mIsPerformanceOverlayEnabled);
 
         return AreAllSettingsEqual;
       }
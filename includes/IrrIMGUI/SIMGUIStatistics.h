@@ -0,0 +1,324 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file       SIMGUIStatistics.h
+ * @author     Andre Netzeband
+ * @brief      A storage for the render statistics of the IMGUI.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_SIMGUISTATISTICS_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_SIMGUISTATISTICS_H_
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+
+  /// @brief Stores the render statistics of the last GUI frame.
+  struct IRRIMGUI_DLL_API SIMGUIStatistics
+  {
+    public:
+
+      /// @brief Constructor to reset all values.
+      SIMGUIStatistics(void)
+      {
+        reset();
+      }
+
+      /// @brief Sets all values to zero.
+      void reset(void)
+      {
+        mNumberOfCommandLists          = 0;
+        mNumberOfVertices              = 0;
+        mNumberOfIndices               = 0;
+        mNumberOfDrawCommands          = 0;
+        mNumberOfDrawCalls             = 0;
+        mNumberOfMergedDrawCommands    = 0;
+        mNumberOfSubmittedVertices     = 0;
+        mNumberOfMaterialSwitches      = 0;
+        mNumberOfSavedMaterialSwitches = 0;
+        mNumberOfClipChanges           = 0;
+        mNumberOfConvertedBytes        = 0;
+        mTextureMemory                 = 0;
+        mNumberOfTextureAllocations    = 0;
+        mNumberOfTextureUploads        = 0;
+        mNumberOfCutTriangles          = 0;
+        mNumberOfRemovedTriangles      = 0;
+        mNumberOfMergedCommandLists    = 0;
+        mNumberOfStreamedBytes         = 0;
+        mNumberOfStateQueries          = 0;
+        mNumberOfStateMismatches       = 0;
+        mNumberOfCacheHits             = 0;
+        mNumberOfCacheMisses           = 0;
+        mNumberOfCachedVertices        = 0;
+        mNumberOfCachedLayerFrames     = 0;
+        mNumberOfRenderedLayerFrames   = 0;
+        mPipelineLatency               = 0.0f;
+        mPipelineWaitTime              = 0.0f;
+        mNewFrameTime                  = 0.0f;
+        mRenderTime                    = 0.0f;
+        mConversionTime                = 0.0f;
+        mSubmissionTime                = 0.0f;
+        return;
+      }
+
+      /// @{
+      /// @name Render statistics
+
+      /// @brief The number of IMGUI command lists in the last frame.
+      irr::u32 mNumberOfCommandLists;
+
+      /// @brief The number of IMGUI vertices in all command lists of the last frame.
+      irr::u32 mNumberOfVertices;
+
+      /// @brief The number of IMGUI indices in all command lists of the last frame.
+      irr::u32 mNumberOfIndices;
+
+      /// @brief The number of IMGUI draw commands in the last frame.
+      irr::u32 mNumberOfDrawCommands;
+
+      /// @brief The number of draw calls that have been submitted to the render driver in the last frame.
+      irr::u32 mNumberOfDrawCalls;
+
+      /// @brief The number of draw commands in the last frame, that have been merged into the draw call of the command before.
+      irr::u32 mNumberOfMergedDrawCommands;
+
+      /// @brief The number of vertices that have been submitted with all draw calls of the last frame.
+      irr::u32 mNumberOfSubmittedVertices;
+
+      /// @brief The number of materials (and textures) that have been applied to the render driver in the last frame.
+      irr::u32 mNumberOfMaterialSwitches;
+
+      /// @brief The number of draw commands in the last frame, that could reuse the material of the command before.
+      irr::u32 mNumberOfSavedMaterialSwitches;
+
+      /// @brief The number of clipping rectangles, that have been applied to the render driver in the last frame.
+      irr::u32 mNumberOfClipChanges;
+
+      /// @brief The number of bytes, that have been written by the conversion of vertices and indices in the last frame
+      ///        (e.g. the Irrlicht vertices of the Irrlicht renderer or the restored 32 bit indices of the OpenGL renderer).
+      irr::u32 mNumberOfConvertedBytes;
+
+      /// @brief The estimated memory in bytes of all GUI textures (with 4 bytes per pixel).
+      irr::u32 mTextureMemory;
+
+      /// @brief The number of GPU textures, that have been allocated since the frame before (by creating textures or by updates, that recreate a texture).
+      ///        With streaming textures (see IIMGUIHandle::createTexture) it stays 0, as long as the size of the updated images does not change.
+      irr::u32 mNumberOfTextureAllocations;
+
+      /// @brief The number of texture updates since the frame before, that have been written into an existing GPU texture
+      ///        (updates of streaming textures and IIMGUIHandle::updateTextureRegion).
+      irr::u32 mNumberOfTextureUploads;
+
+      /// @brief The number of triangles in the last frame, that have been cut at their clipping rectangle (only with clipping mode ECM_CPU).
+      irr::u32 mNumberOfCutTriangles;
+
+      /// @brief The number of triangles in the last frame, that have been removed outside of their clipping rectangle (only with clipping mode ECM_CPU).
+      irr::u32 mNumberOfRemovedTriangles;
+
+      /// @brief The number of command lists in the last frame, that have been drawn as a single vertex and index stream (only with frame merging).
+      irr::u32 mNumberOfMergedCommandLists;
+
+      /// @brief The number of bytes, that have been uploaded into the vertex and index buffer objects in the last frame (only with the OpenGL renderer and buffer object streaming).
+      irr::u32 mNumberOfStreamedBytes;
+
+      /// @brief The number of OpenGL state values, that have been read from OpenGL in the last frame (only with the OpenGL renderer).
+      irr::u32 mNumberOfStateQueries;
+
+      /// @brief The number of shadowed OpenGL state values in the last frame, that have been different from the real OpenGL state
+      ///        (only with the OpenGL renderer and SIMGUISettings::mIsOpenGLStateValidationEnabled).
+      irr::u32 mNumberOfStateMismatches;
+
+      /// @}
+
+      /// @{
+      /// @name Command list cache statistics
+
+      /// @brief The number of command lists in the last frame, which converted vertices have been reused from the frame before.
+      irr::u32 mNumberOfCacheHits;
+
+      /// @brief The number of command lists in the last frame, which vertices have been converted.
+      irr::u32 mNumberOfCacheMisses;
+
+      /// @brief The number of vertices, that are stored in the command list cache after the last frame.
+      irr::u32 mNumberOfCachedVertices;
+
+      /// @}
+
+      /// @{
+      /// @name GUI layer statistics (counted over all frames since the GUI layer has been enabled)
+
+      /// @brief The number of frames, where the GUI has been drawn from the GUI layer texture without rendering the GUI.
+      irr::u32 mNumberOfCachedLayerFrames;
+
+      /// @brief The number of frames, where the GUI has been rendered, because it has changed since the frame before.
+      irr::u32 mNumberOfRenderedLayerFrames;
+
+      /// @}
+
+      /// @{
+      /// @name Render pipeline statistics (only used with pipelined rendering)
+
+      /// @brief The time in milliseconds between the creation of the rendered GUI frame and its rendering.
+      ///        This is the latency, that is added by the pipeline (usually the duration of one frame).
+      irr::f32 mPipelineLatency;
+
+      /// @brief The time in milliseconds, the render thread has waited in the last frame for the worker thread of the pipeline.
+      irr::f32 mPipelineWaitTime;
+
+      /// @}
+
+      /// @{
+      /// @name Time statistics (in milliseconds)
+
+      /// @brief The time of ImGui::NewFrame() in IIMGUIHandle::startGUI().
+      irr::f32 mNewFrameTime;
+
+      /// @brief The time of ImGui::Render() in IIMGUIHandle::drawAll(), which creates the draw data of the frame.
+      irr::f32 mRenderTime;
+
+      /// @brief The time, that the renderer has needed to convert the draw data (with pipelined rendering the time of the worker thread).
+      ///        The OpenGL renderers draw the IMGUI vertices directly, thus this time is always 0 for them.
+      irr::f32 mConversionTime;
+
+      /// @brief The time, that the renderer has needed to submit the draw data to the render driver (without the conversion).
+      irr::f32 mSubmissionTime;
+
+      /// @}
+  };
+
+  /// @brief Contains the average and the percentiles of a statistic value over the last frames.
+  struct IRRIMGUI_DLL_API SIMGUIStatisticValue
+  {
+    public:
+
+      /// @brief Constructor to reset all values.
+      SIMGUIStatisticValue(void)
+      {
+        reset();
+      }
+
+      /// @brief Sets all values to zero.
+      void reset(void)
+      {
+        mAverage      = 0.0f;
+        mMedian       = 0.0f;
+        mPercentile95 = 0.0f;
+        mPercentile99 = 0.0f;
+        mMaximum      = 0.0f;
+        return;
+      }
+
+      /// @brief The average value.
+      irr::f32 mAverage;
+
+      /// @brief The value, that is not exceeded by 50% of the frames.
+      irr::f32 mMedian;
+
+      /// @brief The value, that is not exceeded by 95% of the frames.
+      irr::f32 mPercentile95;
+
+      /// @brief The value, that is not exceeded by 99% of the frames.
+      irr::f32 mPercentile99;
+
+      /// @brief The maximum value.
+      irr::f32 mMaximum;
+  };
+
+  /// @brief Stores the rolling averages and percentiles of the render statistics over the last frames (see SIMGUISettings::mNumberOfStatisticFrames).
+  struct IRRIMGUI_DLL_API SIMGUIStatisticsSummary
+  {
+    public:
+
+      /// @brief Constructor to reset all values.
+      SIMGUIStatisticsSummary(void)
+      {
+        reset();
+      }
+
+      /// @brief Sets all values to zero.
+      void reset(void)
+      {
+        mNumberOfFrames = 0;
+        mNumberOfCommandLists.reset();
+        mNumberOfVertices.reset();
+        mNumberOfIndices.reset();
+        mNumberOfDrawCommands.reset();
+        mNumberOfDrawCalls.reset();
+        mNumberOfMaterialSwitches.reset();
+        mNumberOfClipChanges.reset();
+        mNumberOfConvertedBytes.reset();
+        mNewFrameTime.reset();
+        mRenderTime.reset();
+        mConversionTime.reset();
+        mSubmissionTime.reset();
+        mTotalTime.reset();
+        return;
+      }
+
+      /// @brief The number of frames, that are contained in this summary.
+      irr::u32 mNumberOfFrames;
+
+      /// @{
+      /// @name Render statistics (see SIMGUIStatistics)
+
+      SIMGUIStatisticValue mNumberOfCommandLists;
+      SIMGUIStatisticValue mNumberOfVertices;
+      SIMGUIStatisticValue mNumberOfIndices;
+      SIMGUIStatisticValue mNumberOfDrawCommands;
+      SIMGUIStatisticValue mNumberOfDrawCalls;
+      SIMGUIStatisticValue mNumberOfMaterialSwitches;
+      SIMGUIStatisticValue mNumberOfClipChanges;
+      SIMGUIStatisticValue mNumberOfConvertedBytes;
+
+      /// @}
+
+      /// @{
+      /// @name Time statistics in milliseconds (see SIMGUIStatistics)
+
+      SIMGUIStatisticValue mNewFrameTime;
+      SIMGUIStatisticValue mRenderTime;
+      SIMGUIStatisticValue mConversionTime;
+      SIMGUIStatisticValue mSubmissionTime;
+
+      /// @brief The sum of all times of a frame.
+      SIMGUIStatisticValue mTotalTime;
+
+      /// @}
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_SIMGUISTATISTICS_H_ */
@@ -0,0 +1,164 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CChromeTraceProfiler.h
+ * @author Andre Netzeband
+ * @brief  Contains a profiler, that writes the zones of IrrIMGUI into a Chrome trace event file.
+ * @addtogroup IrrIMGUITools
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_TOOLS_CCHROMETRACEPROFILER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_TOOLS_CCHROMETRACEPROFILER_H_
+
+// library includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// module includes
+#include <IrrIMGUI/IrrIMGUIConfig.h>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IProfiler.h>
+
+/**
+ * @addtogroup IrrIMGUITools
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Tools
+{
+
+  /**
+   * @brief A profiler, that records the zones of IrrIMGUI in memory and writes them into a Chrome trace event file.
+   *
+   * @details The events are stored into a buffer, that is allocated by the constructor. Recording an event needs only
+   *   a single atomic increment, thus the render thread and the worker thread of the render pipeline never wait for each other.
+   *   When the buffer is full, further events are dropped. The file can be opened with "chrome://tracing" or other
+   *   tools, that read the trace event format.
+   *
+   * @code
+
+   IrrIMGUI::Tools::CChromeTraceProfiler Profiler;
+   IrrIMGUI::Inject::setProfiler(&Profiler);
+
+   // ... render some frames ...
+
+   IrrIMGUI::Inject::setProfiler(nullptr);
+   Profiler.writeToFile("IrrIMGUI.json");
+
+   @endcode
+   */
+  class IRRIMGUI_DLL_API CChromeTraceProfiler : public IProfiler
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      /// @param MaxNumberOfEvents Is the number of events, that fit into the buffer (every zone needs two events).
+      CChromeTraceProfiler(irr::u32 MaxNumberOfEvents = 262144);
+
+      /// @brief Destructor.
+      virtual ~CChromeTraceProfiler(void);
+
+      /// @}
+
+      /// @{
+      /// @name Profiler methods
+
+      /// @brief Records the begin of a zone.
+      /// @param Zone Is the zone.
+      virtual void beginZone(EProfilerZone Zone);
+
+      /// @brief Records the end of a zone.
+      /// @param Zone Is the zone.
+      virtual void endZone(EProfilerZone Zone);
+
+      /// @}
+
+      /// @{
+      /// @name Trace methods
+
+      /// @brief Writes all recorded events as Chrome trace event JSON into a file.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the file could not be written.
+      bool writeToFile(char const * pFileName) const;
+
+      /// @brief Removes all recorded events.
+      /// @note  Do not call it, while zones are recorded.
+      void clear(void);
+
+      /// @return Returns the number of recorded events.
+      irr::u32 getNumberOfEvents(void) const;
+
+      /// @return Returns the number of events, that have been dropped, since the buffer was full.
+      irr::u32 getNumberOfDroppedEvents(void) const;
+
+      /// @}
+
+    private:
+      /// @brief A recorded event.
+      struct SEvent
+      {
+        /// @brief The time in nanoseconds since the construction of the profiler.
+        std::uint64_t        mTime;
+
+        /// @brief The ID of the thread, that has recorded the event.
+        irr::u32             mThreadID;
+
+        /// @brief The zone.
+        irr::u32             mZone;
+
+        /// @brief 'B' for the begin and 'E' for the end of a zone. It is 0, as long as the event is written.
+        std::atomic<char>    mPhase;
+      };
+
+      /// @brief Records an event.
+      /// @param Zone  Is the zone.
+      /// @param Phase Is 'B' for the begin and 'E' for the end of the zone.
+      void recordEvent(EProfilerZone Zone, char Phase);
+
+      /// @brief This class can not be copied.
+      CChromeTraceProfiler(CChromeTraceProfiler const &) = delete;
+
+      /// @brief This class can not be copied.
+      CChromeTraceProfiler &operator=(CChromeTraceProfiler const &) = delete;
+
+      SEvent                              * mpEvents;
+      irr::u32                        const mMaxNumberOfEvents;
+      std::atomic<irr::u32>                 mNextEvent;
+      std::atomic<irr::u32>                 mNumberOfDroppedEvents;
+      std::chrono::steady_clock::time_point mStartTime;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_TOOLS_CCHROMETRACEPROFILER_H_ */
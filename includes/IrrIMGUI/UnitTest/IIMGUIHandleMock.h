@@ -109,6 +109,24 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return;
     }
 
+    virtual void invalidateGUILayer(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::invalidateGUILayer");
+      return;
+    }
+
+    virtual void setRenderTarget(irr::video::ITexture * pRenderTarget)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::setRenderTarget").MOCK_ARG(pRenderTarget);
+      return;
+    }
+
+    virtual void invalidateOpenGLState(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::invalidateOpenGLState");
+      return;
+    }
+
     virtual IrrIMGUI::SIMGUISettings const &getSettings(void) const
     {
       MOCK_FUNC("IIMGUIHandleMock::getSettings");
@@ -125,6 +143,35 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return;
     }
 
+    virtual IrrIMGUI::ERenderBackend getRenderBackend(void) const
+    {
+      MOCK_FUNC("IIMGUIHandleMock::getRenderBackend");
+
+      return static_cast<IrrIMGUI::ERenderBackend>(mock().returnIntValueOrDefault(IrrIMGUI::ERB_IRRLICHT));
+    }
+
+    virtual IrrIMGUI::SIMGUIStatistics const &getStatistics(void) const
+    {
+      MOCK_FUNC("IIMGUIHandleMock::getStatistics");
+
+      IrrIMGUI::SIMGUIStatistics const * const pReturnStatistics = static_cast<IrrIMGUI::SIMGUIStatistics const *>(mock().returnConstPointerValueOrDefault(reinterpret_cast<void const *>(&mDefaultStatistics)));
+      return *pReturnStatistics;
+    }
+
+    virtual IrrIMGUI::SIMGUIStatisticsSummary const &getStatisticsSummary(void) const
+    {
+      MOCK_FUNC("IIMGUIHandleMock::getStatisticsSummary");
+
+      IrrIMGUI::SIMGUIStatisticsSummary const * const pReturnSummary = static_cast<IrrIMGUI::SIMGUIStatisticsSummary const *>(mock().returnConstPointerValueOrDefault(reinterpret_cast<void const *>(&mDefaultStatisticsSummary)));
+      return *pReturnSummary;
+    }
+
+    virtual void drawPerformanceOverlay(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::drawPerformanceOverlay");
+      return;
+    }
+
     virtual ImFont * addFont(ImFontConfig const * pFontConfig)
     {
       MOCK_FUNC("IIMGUIHandleMock::addFont").MOCK_ARG(pFontConfig);
@@ -251,6 +298,13 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return (static_cast<IrrIMGUI::IGUITexture*>(mock().returnPointerValueOrDefault(getDummyTexture())));
     }
 
+    virtual IrrIMGUI::IGUITexture *createTexture(irr::video::IImage * pImage, bool IsStreaming)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::createTexture").MOCK_ARG(pImage).MOCK_ARG(IsStreaming);
+
+      return (static_cast<IrrIMGUI::IGUITexture*>(mock().returnPointerValueOrDefault(getDummyTexture())));
+    }
+
     virtual IrrIMGUI::IGUITexture *createTexture(irr::video::ITexture * pTexture)
     {
       MOCK_FUNC("IIMGUIHandleMock::createTexture").MOCK_ARG(pTexture);
@@ -272,6 +326,13 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return;
     }
 
+    virtual void updateTextureRegion(IrrIMGUI::IGUITexture * pGUITexture, irr::video::ECOLOR_FORMAT ColorFormat, void const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::updateTextureRegion").MOCK_ARG(pGUITexture).MOCK_ARG(ColorFormat).MOCK_ARG(pPixelData).MOCK_ARG(Pitch).MOCK_ARG(X).MOCK_ARG(Y).MOCK_ARG(Width).MOCK_ARG(Height);
+
+      return;
+    }
+
     virtual void deleteTexture(IrrIMGUI::IGUITexture * pGUITexture)
     {
       MOCK_FUNC("IIMGUIHandleMock::deleteTexture").MOCK_ARG(pGUITexture);
@@ -318,6 +379,12 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
     /// @brief A dummy object for storing default settings.
     IrrIMGUI::SIMGUISettings             mDefaultSettings;
 
+    /// @brief A dummy object for storing default statistics.
+    IrrIMGUI::SIMGUIStatistics           mDefaultStatistics;
+
+    /// @brief A dummy object for storing a default statistics summary.
+    IrrIMGUI::SIMGUIStatisticsSummary    mDefaultStatisticsSummary;
+
     /// @brief Stores the Irrlicht device pointer.
     irr::IrrlichtDevice          * const mpDevice;
 
@@ -0,0 +1,179 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CChromeTraceProfiler.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a profiler, that writes the zones of IrrIMGUI into a Chrome trace event file.
+ * @addtogroup IrrIMGUITools
+ */
+
+// library includes
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <thread>
+#include <IrrIMGUI/Tools/CChromeTraceProfiler.h>
+
+// module includes
+#include "private/IrrIMGUIDebug_priv.h"
+
+namespace IrrIMGUI
+{
+namespace Tools
+{
+namespace
+{
+  /// @return Returns an ID of the current thread, that can be used as "tid" of the trace event format.
+  irr::u32 getCurrentThreadID(void)
+  {
+    return static_cast<irr::u32>(std::hash<std::thread::id>()(std::this_thread::get_id()) & 0x7FFFFFFF);
+  }
+}
+
+  CChromeTraceProfiler::CChromeTraceProfiler(irr::u32 const MaxNumberOfEvents):
+    mpEvents(new SEvent[MaxNumberOfEvents]),
+    mMaxNumberOfEvents(MaxNumberOfEvents),
+    mNextEvent(0),
+    mNumberOfDroppedEvents(0),
+    mStartTime(std::chrono::steady_clock::now())
+  {
+    for (irr::u32 i = 0; i < mMaxNumberOfEvents; i++)
+    {
+      mpEvents[i].mPhase.store(0, std::memory_order_relaxed);
+    }
+
+    return;
+  }
+
+  CChromeTraceProfiler::~CChromeTraceProfiler(void)
+  {
+    delete[](mpEvents);
+    return;
+  }
+
+  void CChromeTraceProfiler::beginZone(EProfilerZone const Zone)
+  {
+    recordEvent(Zone, 'B');
+    return;
+  }
+
+  void CChromeTraceProfiler::endZone(EProfilerZone const Zone)
+  {
+    recordEvent(Zone, 'E');
+    return;
+  }
+
+  void CChromeTraceProfiler::recordEvent(EProfilerZone const Zone, char const Phase)
+  {
+    std::chrono::steady_clock::duration const Time = std::chrono::steady_clock::now() - mStartTime;
+
+    // the index is only checked before the increment, thus the counter can not overflow when the buffer is full for a long time
+    if (mNextEvent.load(std::memory_order_relaxed) >= mMaxNumberOfEvents)
+    {
+      mNumberOfDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    irr::u32 const Index = mNextEvent.fetch_add(1, std::memory_order_relaxed);
+    if (Index >= mMaxNumberOfEvents)
+    {
+      mNumberOfDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    SEvent &rEvent = mpEvents[Index];
+    rEvent.mTime     = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Time).count());
+    rEvent.mThreadID = getCurrentThreadID();
+    rEvent.mZone     = static_cast<irr::u32>(Zone);
+    rEvent.mPhase.store(Phase, std::memory_order_release);
+
+    return;
+  }
+
+  bool CChromeTraceProfiler::writeToFile(char const * const pFileName) const
+  {
+    std::ofstream File(pFileName, std::ios::out | std::ios::trunc);
+
+    if (!File.is_open())
+    {
+      LOG_ERROR("{IrrIMGUI} Cannot open the trace file " << pFileName << "!\n");
+      return false;
+    }
+
+    File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    File << std::fixed << std::setprecision(3);
+
+    irr::u32 const NumberOfEvents = getNumberOfEvents();
+    bool IsFirstEvent = true;
+
+    for (irr::u32 i = 0; i < NumberOfEvents; i++)
+    {
+      SEvent const &rEvent = mpEvents[i];
+      char const Phase = rEvent.mPhase.load(std::memory_order_acquire);
+
+      // the event is still written by another thread
+      if (Phase == 0)
+      {
+        continue;
+      }
+
+      File << (IsFirstEvent ? "\n" : ",\n");
+      File << "{\"name\":\"" << getProfilerZoneName(static_cast<EProfilerZone>(rEvent.mZone)) << "\",\"cat\":\"IrrIMGUI\",\"ph\":\"" << Phase << "\"";
+      File << ",\"ts\":" << (static_cast<double>(rEvent.mTime) / 1000.0) << ",\"pid\":1,\"tid\":" << rEvent.mThreadID << "}";
+      IsFirstEvent = false;
+    }
+
+    File << "\n]}\n";
+
+    return File.good();
+  }
+
+  void CChromeTraceProfiler::clear(void)
+  {
+    irr::u32 const NumberOfEvents = getNumberOfEvents();
+
+    for (irr::u32 i = 0; i < NumberOfEvents; i++)
+    {
+      mpEvents[i].mPhase.store(0, std::memory_order_relaxed);
+    }
+
+    mNextEvent.store(0, std::memory_order_relaxed);
+    mNumberOfDroppedEvents.store(0, std::memory_order_relaxed);
+
+    return;
+  }
+
+  irr::u32 CChromeTraceProfiler::getNumberOfEvents(void) const
+  {
+    irr::u32 const NextEvent = mNextEvent.load(std::memory_order_relaxed);
+    return (NextEvent < mMaxNumberOfEvents) ? NextEvent : mMaxNumberOfEvents;
+  }
+
+  irr::u32 CChromeTraceProfiler::getNumberOfDroppedEvents(void) const
+  {
+    return mNumberOfDroppedEvents.load(std::memory_order_relaxed);
+  }
+
+}
+}
@@ -0,0 +1,246 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CCommandListCache.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a cache for the converted vertices of IMGUI command lists.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "private/CCommandListCache.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @brief Command lists, that have not been drawn for this number of frames, are removed from the cache.
+  irr::u32 const MaxUnusedFrames = 60;
+
+  /// @brief Command lists, that have changed in this number of frames one after another, are not cached anymore.
+  irr::u32 const MaxChangedFrames = 3;
+
+  /// @brief Command lists, that are not cached anymore, are checked again in this interval of frames.
+  irr::u32 const ChangedListProbeInterval = 16;
+}
+
+  CCommandListCache::CCommandListCache(void):
+    mMaxNumberOfVertices(0),
+    mNumberOfVertices(0),
+    mFrame(0)
+  {
+    return;
+  }
+
+  CCommandListCache::~CCommandListCache(void)
+  {
+    clear();
+    return;
+  }
+
+  irr::video::S3DVertex * CCommandListCache::findVertices(ImDrawList const * const pCommandList)
+  {
+    size_t const Index = findEntry(pCommandList);
+
+    if ((Index == mEntries.size()) || isSkipped(*mEntries[Index]) || (!mEntries[Index]->mSource.isEqual(pCommandList)))
+    {
+      return nullptr;
+    }
+
+    SEntry * const pEntry = mEntries[Index];
+    pEntry->mLastUsedFrame   = mFrame;
+    pEntry->mNumberOfChanges = 0;
+
+    return pEntry->mVertices.data();
+  }
+
+  irr::video::S3DVertex * CCommandListCache::addCommandList(ImDrawList const * const pCommandList)
+  {
+    irr::u32 const NumberOfVertices = pCommandList->VtxBuffer.size();
+    size_t const   Index            = findEntry(pCommandList);
+    SEntry *       pEntry           = nullptr;
+
+    if (Index < mEntries.size())
+    {
+      if (NumberOfVertices > mMaxNumberOfVertices)
+      {
+        removeEntry(Index);
+        return nullptr;
+      }
+
+      pEntry = mEntries[Index];
+
+      // a command list, that changes in every frame, would only waste time for comparing and copying
+      if (isSkipped(*pEntry))
+      {
+        pEntry->mLastUsedFrame = mFrame;
+        return nullptr;
+      }
+
+      // the old content is replaced, but the memory of the entry is reused
+      mNumberOfVertices -= pEntry->mVertices.size();
+      pEntry->mVertices.clear();
+      pEntry->mNumberOfChanges++;
+    }
+    else
+    {
+      if (NumberOfVertices > mMaxNumberOfVertices)
+      {
+        return nullptr;
+      }
+
+      pEntry = new SEntry();
+      pEntry->mpCommandList    = pCommandList;
+      pEntry->mNumberOfChanges = 0;
+      mEntries.push_back(pEntry);
+    }
+
+    while ((mNumberOfVertices + NumberOfVertices) > mMaxNumberOfVertices)
+    {
+      removeOldestEntry(pEntry);
+    }
+
+    pEntry->mLastUsedFrame = mFrame;
+    pEntry->mSource.assign(pCommandList);
+    pEntry->mVertices.resize(NumberOfVertices);
+    mNumberOfVertices += NumberOfVertices;
+
+    return pEntry->mVertices.data();
+  }
+
+  void CCommandListCache::startFrame(void)
+  {
+    mFrame++;
+
+    size_t Index = 0;
+    while (Index < mEntries.size())
+    {
+      if ((mFrame - mEntries[Index]->mLastUsedFrame) > MaxUnusedFrames)
+      {
+        removeEntry(Index);
+      }
+      else
+      {
+        Index++;
+      }
+    }
+
+    return;
+  }
+
+  void CCommandListCache::setMaxNumberOfVertices(irr::u32 const MaxNumberOfVertices)
+  {
+    mMaxNumberOfVertices = MaxNumberOfVertices;
+
+    while (mNumberOfVertices > mMaxNumberOfVertices)
+    {
+      removeOldestEntry(nullptr);
+    }
+
+    return;
+  }
+
+  irr::u32 CCommandListCache::getNumberOfVertices(void) const
+  {
+    return mNumberOfVertices;
+  }
+
+  irr::u32 CCommandListCache::getNumberOfCommandLists(void) const
+  {
+    return mEntries.size();
+  }
+
+  void CCommandListCache::clear(void)
+  {
+    while (!mEntries.empty())
+    {
+      removeEntry(mEntries.size() - 1);
+    }
+
+    return;
+  }
+
+  size_t CCommandListCache::findEntry(ImDrawList const * const pCommandList) const
+  {
+    for (size_t i = 0; i < mEntries.size(); i++)
+    {
+      if (mEntries[i]->mpCommandList == pCommandList)
+      {
+        return i;
+      }
+    }
+
+    return mEntries.size();
+  }
+
+  bool CCommandListCache::removeOldestEntry(SEntry const * const pKeptEntry)
+  {
+    size_t OldestIndex = mEntries.size();
+
+    for (size_t i = 0; i < mEntries.size(); i++)
+    {
+      if (mEntries[i] == pKeptEntry)
+      {
+        continue;
+      }
+
+      if ((OldestIndex == mEntries.size()) || (mEntries[i]->mLastUsedFrame < mEntries[OldestIndex]->mLastUsedFrame))
+      {
+        OldestIndex = i;
+      }
+    }
+
+    if (OldestIndex == mEntries.size())
+    {
+      return false;
+    }
+
+    removeEntry(OldestIndex);
+
+    return true;
+  }
+
+  void CCommandListCache::removeEntry(size_t const Index)
+  {
+    SEntry * const pEntry = mEntries[Index];
+
+    mNumberOfVertices -= pEntry->mVertices.size();
+    delete pEntry;
+
+    mEntries[Index] = mEntries.back();
+    mEntries.pop_back();
+
+    return;
+  }
+
+  bool CCommandListCache::isSkipped(SEntry const &rEntry) const
+  {
+    return (rEntry.mNumberOfChanges >= MaxChangedFrames) && ((mFrame % ChangedListProbeInterval) != 0);
+  }
+
+}
+}
@@ -0,0 +1,99 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CCommandListCopy.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a copy of an IMGUI command list, that is used to detect changes from frame to frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstring>
+
+// module includes
+#include "private/CCommandListCopy.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  void CCommandListCopy::assign(ImDrawList const * const pCommandList)
+  {
+    mVertices.assign(pCommandList->VtxBuffer.Data, pCommandList->VtxBuffer.Data + pCommandList->VtxBuffer.size());
+    mIndices.assign(pCommandList->IdxBuffer.Data, pCommandList->IdxBuffer.Data + pCommandList->IdxBuffer.size());
+    mCommands.assign(pCommandList->CmdBuffer.Data, pCommandList->CmdBuffer.Data + pCommandList->CmdBuffer.size());
+
+    return;
+  }
+
+  bool CCommandListCopy::isEqual(ImDrawList const * const pCommandList) const
+  {
+    if ((mVertices.size() != static_cast<size_t>(pCommandList->VtxBuffer.size())) ||
+        (mIndices.size()  != static_cast<size_t>(pCommandList->IdxBuffer.size())) ||
+        (mCommands.size() != static_cast<size_t>(pCommandList->CmdBuffer.size())))
+    {
+      return false;
+    }
+
+    // the commands are compared element by element, since they contain padding bytes with undefined content
+    for (size_t i = 0; i < mCommands.size(); i++)
+    {
+      ImDrawCmd const &rCopiedCommand = mCommands[i];
+      ImDrawCmd const &rCommand       = pCommandList->CmdBuffer[static_cast<int>(i)];
+
+      if ((rCopiedCommand.ElemCount        != rCommand.ElemCount)        ||
+          (rCopiedCommand.ClipRect.x       != rCommand.ClipRect.x)       ||
+          (rCopiedCommand.ClipRect.y       != rCommand.ClipRect.y)       ||
+          (rCopiedCommand.ClipRect.z       != rCommand.ClipRect.z)       ||
+          (rCopiedCommand.ClipRect.w       != rCommand.ClipRect.w)       ||
+          (rCopiedCommand.TextureId        != rCommand.TextureId)        ||
+          (rCopiedCommand.UserCallback     != rCommand.UserCallback)     ||
+          (rCopiedCommand.UserCallbackData != rCommand.UserCallbackData))
+      {
+        return false;
+      }
+    }
+
+    return (std::memcmp(mIndices.data(),  pCommandList->IdxBuffer.Data, mIndices.size()  * sizeof(ImDrawIdx))  == 0) &&
+           (std::memcmp(mVertices.data(), pCommandList->VtxBuffer.Data, mVertices.size() * sizeof(ImDrawVert)) == 0);
+  }
+
+  irr::u32 CCommandListCopy::getNumberOfVertices(void) const
+  {
+    return mVertices.size();
+  }
+
+  void CCommandListCopy::clear(void)
+  {
+    std::vector<ImDrawVert>().swap(mVertices);
+    std::vector<ImDrawIdx>().swap(mIndices);
+    std::vector<ImDrawCmd>().swap(mCommands);
+
+    return;
+  }
+
+}
+}
@@ -0,0 +1,248 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CDrawDataPipeline.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a double buffered copy of the IMGUI draw data, that is prepared for rendering by a worker thread.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstring>
+
+// module includes
+#include "private/CDrawDataPipeline.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUIProfiler_priv.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @return Returns the time in milliseconds since a point in time.
+  irr::f32 getMillisecondsSince(std::chrono::steady_clock::time_point const &rStart)
+  {
+    return std::chrono::duration<irr::f32, std::milli>(std::chrono::steady_clock::now() - rStart).count();
+  }
+
+  /// @brief Copies the content of an IMGUI vector into another one.
+  template <typename T>
+  void copyVector(ImVector<T> const &rSource, ImVector<T> &rDestination)
+  {
+    rDestination.resize(rSource.size());
+    if (rSource.size() > 0)
+    {
+      std::memcpy(rDestination.Data, rSource.Data, rSource.size() * sizeof(T));
+    }
+    return;
+  }
+}
+
+  CDrawDataPipeline::CDrawDataPipeline(PrepareFunction const pPrepareFunction):
+    mpPrepareFunction(pPrepareFunction),
+    mpPendingFrame(nullptr),
+    mpPreparedFrame(nullptr),
+    mLatency(0.0f),
+    mWaitTime(0.0f),
+    mIsStopped(false)
+  {
+    for (SFrame &rFrame : mFrames)
+    {
+      rFrame.mDrawData.CmdLists      = nullptr;
+      rFrame.mDrawData.CmdListsCount = 0;
+      rFrame.mDrawData.TotalVtxCount = 0;
+      rFrame.mDrawData.TotalIdxCount = 0;
+      rFrame.mConversionTime         = 0.0f;
+      rFrame.mNumberOfConvertedBytes = 0;
+    }
+
+    LOG_NOTE("{IrrIMGUI} Start pipelined GUI rendering.\n");
+    mWorker = std::thread(&CDrawDataPipeline::runWorker, this);
+
+    return;
+  }
+
+  CDrawDataPipeline::~CDrawDataPipeline(void)
+  {
+    {
+      std::lock_guard<std::mutex> Lock(mMutex);
+      mIsStopped = true;
+    }
+    mWorkStarted.notify_all();
+    mWorker.join();
+
+    for (SFrame &rFrame : mFrames)
+    {
+      clearFrame(rFrame);
+    }
+
+    return;
+  }
+
+  CDrawDataPipeline::SFrame * CDrawDataPipeline::push(ImDrawData * const pDrawData)
+  {
+    std::chrono::steady_clock::time_point const WaitStart = std::chrono::steady_clock::now();
+    waitForWorker();
+    mWaitTime = getMillisecondsSince(WaitStart);
+
+    // the pending frame is rendered now, thus the other frame is free for the current draw data
+    SFrame * const pNewFrame = (mpPendingFrame == &mFrames[0]) ? &mFrames[1] : &mFrames[0];
+    copyDrawData(pDrawData, *pNewFrame);
+    pNewFrame->mCreationTime = std::chrono::steady_clock::now();
+
+    {
+      std::lock_guard<std::mutex> Lock(mMutex);
+      mpPreparedFrame = pNewFrame;
+    }
+    mWorkStarted.notify_one();
+
+    SFrame * pRenderFrame = mpPendingFrame;
+    if (pRenderFrame == nullptr)
+    {
+      // the pipeline is empty: render the current frame now and again in the next frame
+      std::chrono::steady_clock::time_point const FillStart = std::chrono::steady_clock::now();
+      waitForWorker();
+      mWaitTime += getMillisecondsSince(FillStart);
+      pRenderFrame = pNewFrame;
+    }
+
+    mpPendingFrame = pNewFrame;
+    mLatency       = getMillisecondsSince(pRenderFrame->mCreationTime);
+
+    return pRenderFrame;
+  }
+
+  void CDrawDataPipeline::flush(void)
+  {
+    waitForWorker();
+    mpPendingFrame = nullptr;
+    return;
+  }
+
+  irr::f32 CDrawDataPipeline::getLatency(void) const
+  {
+    return mLatency;
+  }
+
+  irr::f32 CDrawDataPipeline::getWaitTime(void) const
+  {
+    return mWaitTime;
+  }
+
+  void CDrawDataPipeline::runWorker(void)
+  {
+    while (true)
+    {
+      SFrame * pFrame = nullptr;
+
+      {
+        std::unique_lock<std::mutex> Lock(mMutex);
+        mWorkStarted.wait(Lock, [this]() { return mIsStopped || (mpPreparedFrame != nullptr); });
+
+        if (mIsStopped)
+        {
+          return;
+        }
+
+        pFrame = mpPreparedFrame;
+      }
+
+      if (mpPrepareFunction != nullptr)
+      {
+        CProfilerZone const Zone(EPZ_CONVERSION);
+        std::chrono::steady_clock::time_point const PrepareStart = std::chrono::steady_clock::now();
+        mpPrepareFunction(*pFrame);
+        pFrame->mConversionTime = getMillisecondsSince(PrepareStart);
+      }
+
+      {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mpPreparedFrame = nullptr;
+      }
+      mWorkFinished.notify_all();
+    }
+  }
+
+  void CDrawDataPipeline::waitForWorker(void)
+  {
+    std::unique_lock<std::mutex> Lock(mMutex);
+    mWorkFinished.wait(Lock, [this]() { return mpPreparedFrame == nullptr; });
+    return;
+  }
+
+  void CDrawDataPipeline::copyDrawData(ImDrawData const * const pDrawData, SFrame &rFrame)
+  {
+    irr::u32 const NumberOfCommandLists = static_cast<irr::u32>(pDrawData->CmdListsCount);
+
+    // the command lists of the frame are reused, thus their memory is only allocated when the GUI grows
+    while (rFrame.mCommandLists.size() > NumberOfCommandLists)
+    {
+      delete(rFrame.mCommandLists.back());
+      rFrame.mCommandLists.pop_back();
+    }
+
+    while (rFrame.mCommandLists.size() < NumberOfCommandLists)
+    {
+      rFrame.mCommandLists.push_back(new ImDrawList());
+    }
+
+    for (irr::u32 i = 0; i < NumberOfCommandLists; i++)
+    {
+      ImDrawList const * const pSource      = pDrawData->CmdLists[i];
+      ImDrawList       * const pDestination = rFrame.mCommandLists[i];
+
+      copyVector(pSource->CmdBuffer, pDestination->CmdBuffer);
+      copyVector(pSource->IdxBuffer, pDestination->IdxBuffer);
+      copyVector(pSource->VtxBuffer, pDestination->VtxBuffer);
+    }
+
+    rFrame.mDrawData.CmdLists      = rFrame.mCommandLists.empty() ? nullptr : rFrame.mCommandLists.data();
+    rFrame.mDrawData.CmdListsCount = pDrawData->CmdListsCount;
+    rFrame.mDrawData.TotalVtxCount = pDrawData->TotalVtxCount;
+    rFrame.mDrawData.TotalIdxCount = pDrawData->TotalIdxCount;
+    rFrame.mConversionTime         = 0.0f;
+    rFrame.mNumberOfConvertedBytes = 0;
+
+    return;
+  }
+
+  void CDrawDataPipeline::clearFrame(SFrame &rFrame)
+  {
+    for (ImDrawList * const pCommandList : rFrame.mCommandLists)
+    {
+      delete(pCommandList);
+    }
+
+    rFrame.mCommandLists.clear();
+    rFrame.mDrawData.CmdLists      = nullptr;
+    rFrame.mDrawData.CmdListsCount = 0;
+
+    return;
+  }
+
+}
+}
@@ -0,0 +1,261 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CGUILayer.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a render target texture, that keeps the rendered GUI as long as it does not change.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "private/CGUILayer.h"
+#include "private/CGUITexture.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "IIMGUIDriver.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  CGUILayer::CGUILayer(IIMGUIDriver * const pDriver):
+    mpDriver(pDriver),
+    mpTexture(nullptr),
+    mpGUITexture(nullptr),
+    mIsInvalid(true)
+  {
+    FASSERT(pDriver);
+    return;
+  }
+
+  CGUILayer::~CGUILayer(void)
+  {
+    removeTexture();
+    return;
+  }
+
+  bool CGUILayer::draw(ImDrawData * const pDrawData, RenderFunction const pRenderFunction)
+  {
+    ImGuiIO const &rGUIIO = ImGui::GetIO();
+    bool const HasDrawData = (pDrawData != nullptr) && (pDrawData->CmdListsCount > 0);
+
+    if (!updateTexture(static_cast<irr::u32>(rGUIIO.DisplaySize.x), static_cast<irr::u32>(rGUIIO.DisplaySize.y)))
+    {
+      // without render target support the GUI is rendered like without GUI layer
+      if (HasDrawData)
+      {
+        pRenderFunction(pDrawData);
+      }
+
+      return false;
+    }
+
+    bool const HasChanged = hasChanged(HasDrawData ? pDrawData : nullptr);
+    bool const IsCached   = !(HasChanged || mIsInvalid);
+
+    if (!IsCached)
+    {
+      irr::video::IVideoDriver * const pIrrDriver = mpDriver->getIrrDevice()->getVideoDriver();
+
+      pIrrDriver->setRenderTarget(mpTexture, true, true, irr::video::SColor(0, 0, 0, 0));
+
+      if (HasDrawData)
+      {
+        // the colors are blended like on the screen, which results in premultiplied colors inside the texture,
+        // but the alpha values must be accumulated by a second pass to get the coverage of the GUI. Thus the first
+        // pass keeps the cleared alpha channel and the second pass reuses its vertices, since some drivers convert them in place.
+        IIMGUIDriver::setBlendMode(EBM_COLOR_ONLY);
+        pRenderFunction(pDrawData);
+        IIMGUIDriver::setBlendMode(EBM_ACCUMULATE_ALPHA);
+        IIMGUIDriver::setDrawDataRepeated(true);
+        pRenderFunction(pDrawData);
+        IIMGUIDriver::setDrawDataRepeated(false);
+        IIMGUIDriver::setBlendMode(EBM_STANDARD);
+      }
+
+      // Irrlicht cannot return the render target before, thus the application tells it with IIMGUIHandle::setRenderTarget(...)
+      pIrrDriver->setRenderTarget(IIMGUIDriver::getRenderTarget(), false, false);
+
+      // drivers that copy the texture content into an own texture must update it
+      mpDriver->updateTexture(mpGUITexture, mpTexture);
+      mIsInvalid = false;
+    }
+
+    drawTexture(pRenderFunction);
+
+    return IsCached;
+  }
+
+  void CGUILayer::invalidate(void)
+  {
+    mIsInvalid = true;
+    return;
+  }
+
+  bool CGUILayer::hasChanged(ImDrawData const * const pDrawData)
+  {
+    size_t const NumberOfCommandLists = (pDrawData != nullptr) ? static_cast<size_t>(pDrawData->CmdListsCount) : 0;
+    bool HasChanged = (NumberOfCommandLists != mCommandLists.size());
+
+    mCommandLists.resize(NumberOfCommandLists);
+
+    for (size_t i = 0; i < NumberOfCommandLists; i++)
+    {
+      ImDrawList const * const pCommandList = pDrawData->CmdLists[i];
+
+      if (HasChanged || !mCommandLists[i].isEqual(pCommandList))
+      {
+        mCommandLists[i].assign(pCommandList);
+        HasChanged = true;
+      }
+
+      // the content of render target textures changes without any change of the draw data
+      for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
+      {
+        CGUITexture const * const pGUITexture = static_cast<CGUITexture const *>(pCommandList->CmdBuffer[CommandIndex].TextureId);
+
+        if ((pGUITexture != nullptr) &&
+            (pGUITexture->mSourceType == ETST_TEXTURE) &&
+            (pGUITexture->mSource.TextureID->isRenderTarget()))
+        {
+          HasChanged = true;
+        }
+      }
+    }
+
+    return HasChanged;
+  }
+
+  bool CGUILayer::updateTexture(irr::u32 const Width, irr::u32 const Height)
+  {
+    if (mpTexture != nullptr)
+    {
+      irr::core::dimension2d<irr::u32> const &rSize = mpTexture->getOriginalSize();
+
+      if ((rSize.Width == Width) && (rSize.Height == Height))
+      {
+        return true;
+      }
+
+      removeTexture();
+    }
+
+    irr::video::IVideoDriver * const pIrrDriver = mpDriver->getIrrDevice()->getVideoDriver();
+
+    if ((Width == 0) || (Height == 0) || (!pIrrDriver->queryFeature(irr::video::EVDF_RENDER_TO_TARGET)))
+    {
+      return false;
+    }
+
+    mpTexture = pIrrDriver->addRenderTargetTexture(irr::core::dimension2d<irr::u32>(Width, Height), "IrrIMGUI-GUILayer", irr::video::ECF_A8R8G8B8);
+
+    if (mpTexture == nullptr)
+    {
+      return false;
+    }
+
+    LOG_NOTE("{IrrIMGUI} Create GUI layer texture with " << std::dec << Width << "x" << Height << " pixels.\n");
+
+    mpGUITexture = mpDriver->createTexture(mpTexture);
+    mIsInvalid   = true;
+
+    return true;
+  }
+
+  void CGUILayer::removeTexture(void)
+  {
+    if (mpGUITexture != nullptr)
+    {
+      mpDriver->deleteTexture(mpGUITexture);
+      mpGUITexture = nullptr;
+    }
+
+    if (mpTexture != nullptr)
+    {
+      mpDriver->getIrrDevice()->getVideoDriver()->removeTexture(mpTexture);
+      mpTexture = nullptr;
+    }
+
+    return;
+  }
+
+  void CGUILayer::drawTexture(RenderFunction const pRenderFunction)
+  {
+    ImGuiIO const &rGUIIO = ImGui::GetIO();
+    float const Width  = rGUIIO.DisplaySize.x;
+    float const Height = rGUIIO.DisplaySize.y;
+
+    // some render drivers enlarge the texture (for example to a power of two)
+    irr::core::dimension2d<irr::u32> const &rOriginalSize = mpTexture->getOriginalSize();
+    irr::core::dimension2d<irr::u32> const &rSize         = mpTexture->getSize();
+    float const MaxU = static_cast<float>(rOriginalSize.Width)  / static_cast<float>(rSize.Width);
+    float const MaxV = static_cast<float>(rOriginalSize.Height) / static_cast<float>(rSize.Height);
+
+    mQuad.VtxBuffer.resize(4);
+    mQuad.VtxBuffer[0].pos = ImVec2(0.0f,  0.0f);
+    mQuad.VtxBuffer[0].uv  = ImVec2(0.0f,  0.0f);
+    mQuad.VtxBuffer[1].pos = ImVec2(Width, 0.0f);
+    mQuad.VtxBuffer[1].uv  = ImVec2(MaxU,  0.0f);
+    mQuad.VtxBuffer[2].pos = ImVec2(Width, Height);
+    mQuad.VtxBuffer[2].uv  = ImVec2(MaxU,  MaxV);
+    mQuad.VtxBuffer[3].pos = ImVec2(0.0f,  Height);
+    mQuad.VtxBuffer[3].uv  = ImVec2(0.0f,  MaxV);
+
+    for (int i = 0; i < mQuad.VtxBuffer.size(); i++)
+    {
+      mQuad.VtxBuffer[i].col = 0xFFFFFFFF;
+    }
+
+    ImDrawIdx const pIndices[] = {0, 1, 2, 0, 2, 3};
+    mQuad.IdxBuffer.resize(6);
+    for (int i = 0; i < mQuad.IdxBuffer.size(); i++)
+    {
+      mQuad.IdxBuffer[i] = pIndices[i];
+    }
+
+    mQuad.CmdBuffer.resize(1);
+    ImDrawCmd &rCommand = mQuad.CmdBuffer[0];
+    rCommand.ElemCount        = 6;
+    rCommand.ClipRect         = ImVec4(0.0f, 0.0f, Width, Height);
+    rCommand.TextureId        = *mpGUITexture;
+    rCommand.UserCallback     = nullptr;
+    rCommand.UserCallbackData = nullptr;
+
+    ImDrawList * pQuad = &mQuad;
+    ImDrawData   QuadData;
+    QuadData.CmdLists      = &pQuad;
+    QuadData.CmdListsCount = 1;
+    QuadData.TotalVtxCount = mQuad.VtxBuffer.size();
+    QuadData.TotalIdxCount = mQuad.IdxBuffer.size();
+
+    IIMGUIDriver::setBlendMode(EBM_PREMULTIPLIED_ALPHA);
+    pRenderFunction(&QuadData);
+    IIMGUIDriver::setBlendMode(EBM_STANDARD);
+
+    return;
+  }
+
+}
+}
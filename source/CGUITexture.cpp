@@ -40,7 +40,11 @@ namespace Private
     mIsUsingOwnMemory(false),
     mSourceType(ETST_UNKNOWN),
     mIsValid(true),
-    mGPUTextureID(nullptr)
+    mGPUTextureID(nullptr),
+    mSizeInBytes(0),
+    mWidth(0),
+    mHeight(0),
+    mIsStreaming(false)
   {
     return;
   }
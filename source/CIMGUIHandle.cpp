@@ -29,11 +29,14 @@
  */
 
 // library includes
+#include <chrono>
 #include <IrrIMGUI/IrrIMGUI.h>
 #include "CIMGUIHandle.h"
 #include "IIMGUIDriver.h"
 #include <IrrIMGUI/IMGUIHelper.h>
+#include "private/CGUITexture.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUIProfiler_priv.h"
 
 /**
  * @addtogroup IrrIMGUIPrivate
@@ -54,7 +57,7 @@ namespace Private
 
   CIMGUIHandle::CIMGUIHandle(irr::IrrlichtDevice * const pDevice, CIMGUIEventStorage * const pEventStorage, SIMGUISettings const * const pSettings)
   {
-    mpGUIDriver = IIMGUIDriver::getInstance(pDevice);
+    mpGUIDriver = IIMGUIDriver::getInstance(pDevice, pSettings);
     mLastTime    = static_cast<float>(pDevice->getTimer()->getTime()) / 1000.0f;
     mpEventStorage = pEventStorage;
     mHandleInstances++;
@@ -90,18 +93,45 @@ namespace Private
 
   void CIMGUIHandle::drawAll(void)
   {
+    CProfilerZone const Zone(EPZ_DRAW_ALL);
+    mpGUIDriver->drawGUI();
+    return;
+  }
+
+  void CIMGUIHandle::invalidateGUILayer(void)
+  {
+    mpGUIDriver->invalidateGUILayer();
+    return;
+  }
 
-    ImGui::Render();
+  void CIMGUIHandle::setRenderTarget(irr::video::ITexture * const pRenderTarget)
+  {
+    mpGUIDriver->setRenderTarget(pRenderTarget);
+    return;
+  }
+
+  void CIMGUIHandle::invalidateOpenGLState(void)
+  {
+    mpGUIDriver->invalidateHostState();
     return;
   }
 
   void CIMGUIHandle::startGUI(void)
   {
+    CProfilerZone const Zone(EPZ_START_GUI);
 
-    updateIMGUIFrameValues(mpGUIDriver->getIrrDevice(), mpEventStorage, &mLastTime);
+    {
+      CProfilerZone const UpdateZone(EPZ_UPDATE_FRAME_VALUES);
+      updateIMGUIFrameValues(mpGUIDriver->getIrrDevice(), mpEventStorage, &mLastTime);
+    }
 
     // start new GUI frame
-    ImGui::NewFrame();
+    {
+      CProfilerZone const NewFrameZone(EPZ_NEW_FRAME);
+      std::chrono::steady_clock::time_point const NewFrameStart = std::chrono::steady_clock::now();
+      ImGui::NewFrame();
+      mpGUIDriver->setNewFrameTime(IIMGUIDriver::getMillisecondsSince(NewFrameStart));
+    }
 
     return;
   }
@@ -116,6 +146,27 @@ namespace Private
     mpGUIDriver->setSettings(rSettings);
   }
 
+  ERenderBackend CIMGUIHandle::getRenderBackend(void) const
+  {
+    return mpGUIDriver->getRenderBackend();
+  }
+
+  SIMGUIStatistics const &CIMGUIHandle::getStatistics(void) const
+  {
+    return mpGUIDriver->getStatistics();
+  }
+
+  SIMGUIStatisticsSummary const &CIMGUIHandle::getStatisticsSummary(void) const
+  {
+    return mpGUIDriver->getStatisticsSummary();
+  }
+
+  void CIMGUIHandle::drawPerformanceOverlay(void)
+  {
+    mpGUIDriver->drawPerformanceOverlay();
+    return;
+  }
+
   ImFont * CIMGUIHandle::addFont(ImFontConfig const * const pFontConfig)
   {
     return ImGui::GetIO().Fonts->AddFont(pFontConfig);
@@ -148,7 +199,9 @@ namespace Private
 
   void CIMGUIHandle::compileFonts(void)
   {
+    mpGUIDriver->flushPipeline();
     mpGUIDriver->compileFonts();
+    mpGUIDriver->invalidateGUILayer();
     return;
   }
 
@@ -156,7 +209,9 @@ namespace Private
   {
     ImGui::GetIO().Fonts->Clear();
     addDefaultFont();
+    mpGUIDriver->flushPipeline();
     mpGUIDriver->compileFonts();
+    mpGUIDriver->invalidateGUILayer();
     return;
   }
 
@@ -182,29 +237,106 @@ namespace Private
 
   IGUITexture * CIMGUIHandle::createTexture(irr::video::IImage * pImage)
   {
-    return mpGUIDriver->createTexture(pImage);
+    CProfilerZone const Zone(EPZ_CREATE_TEXTURE);
+    IGUITexture * const pGUITexture = mpGUIDriver->createTexture(pImage);
+    mpGUIDriver->setTextureSize(pGUITexture, pImage->getDimension().Width, pImage->getDimension().Height);
+    return pGUITexture;
+  }
+
+  IGUITexture * CIMGUIHandle::createTexture(irr::video::IImage * pImage, bool IsStreaming)
+  {
+    IGUITexture * const pGUITexture = createTexture(pImage);
+    CGUITexture * const pRealTexture = dynamic_cast<CGUITexture *>(pGUITexture);
+
+    FASSERT(pRealTexture);
+    pRealTexture->mIsStreaming = IsStreaming;
+
+    return pGUITexture;
   }
 
   IGUITexture * CIMGUIHandle::createTexture(irr::video::ITexture * pTexture)
   {
-    return mpGUIDriver->createTexture(pTexture);
+    CProfilerZone const Zone(EPZ_CREATE_TEXTURE);
+    IGUITexture * const pGUITexture = mpGUIDriver->createTexture(pTexture);
+    mpGUIDriver->setTextureSize(pGUITexture, pTexture->getSize().Width, pTexture->getSize().Height);
+    return pGUITexture;
   }
 
   void CIMGUIHandle::updateTexture(IGUITexture * pGUITexture, irr::video::IImage * pImage)
   {
+    CProfilerZone const Zone(EPZ_UPDATE_TEXTURE);
     mpGUIDriver->updateTexture(pGUITexture, pImage);
+    mpGUIDriver->setTextureSize(pGUITexture, pImage->getDimension().Width, pImage->getDimension().Height);
+    mpGUIDriver->invalidateGUILayer();
     return;
   }
 
   void CIMGUIHandle::updateTexture(IGUITexture * pGUITexture, irr::video::ITexture * pTexture)
   {
+    CProfilerZone const Zone(EPZ_UPDATE_TEXTURE);
     mpGUIDriver->updateTexture(pGUITexture, pTexture);
+    mpGUIDriver->setTextureSize(pGUITexture, pTexture->getSize().Width, pTexture->getSize().Height);
+    mpGUIDriver->invalidateGUILayer();
+    return;
+  }
+
+  void CIMGUIHandle::updateTextureRegion(IGUITexture * pGUITexture, irr::video::ECOLOR_FORMAT ColorFormat, void const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height)
+  {
+    CProfilerZone const Zone(EPZ_UPDATE_TEXTURE);
+    CGUITexture * const pRealTexture = dynamic_cast<CGUITexture *>(pGUITexture);
+
+    FASSERT(pRealTexture);
+
+    // the sums X + Width and Y + Height may overflow
+    if ((X > pRealTexture->mWidth) || (Width > pRealTexture->mWidth - X) || (Y > pRealTexture->mHeight) || (Height > pRealTexture->mHeight - Y))
+    {
+      LOG_ERROR("{IrrIMGUI} The region " << X << "," << Y << " " << Width << "x" << Height << " is outside of the texture!\n");
+      return;
+    }
+
+    if ((Width == 0) || (Height == 0))
+    {
+      return;
+    }
+
+    irr::u8 const * const pSourceData = static_cast<irr::u8 const *>(pPixelData);
+
+    if (ColorFormat == irr::video::ECF_A8R8G8B8)
+    {
+      mpGUIDriver->updateTextureRegion(pGUITexture, ECF_A8R8G8B8, pSourceData, Pitch, X, Y, Width, Height);
+    }
+    else
+    {
+      // other Irrlicht formats are translated to ARGB words first
+      irr::u32 const SourceBytes = irr::video::IImage::getBitsPerPixelFromFormat(ColorFormat) / 8;
+      irr::u32 * const pRegionData = mRegionBuffer.getBuffer(Width * Height);
+
+      for (irr::u32 Row = 0; Row < Height; Row++)
+      {
+        for (irr::u32 Column = 0; Column < Width; Column++)
+        {
+          irr::video::SColor Color;
+          Color.setData(pSourceData + (Row * Pitch) + (Column * SourceBytes), ColorFormat);
+          pRegionData[Column + Row * Width] = Color.color;
+        }
+      }
+
+      mpGUIDriver->updateTextureRegion(pGUITexture, ECF_A8R8G8B8, reinterpret_cast<irr::u8 const *>(pRegionData), Width * 4, X, Y, Width, Height);
+    }
+
+    mpGUIDriver->invalidateGUILayer();
     return;
   }
 
   void CIMGUIHandle::deleteTexture(IGUITexture * pGUITexture)
   {
+    CProfilerZone const Zone(EPZ_DELETE_TEXTURE);
+
+    // the frame inside the render pipeline might still use the texture
+    mpGUIDriver->flushPipeline();
+    mpGUIDriver->setTextureSize(pGUITexture, 0, 0);
     mpGUIDriver->deleteTexture(pGUITexture);
+    mpGUIDriver->invalidateGUILayer();
     return;
   }
 
@@ -33,6 +33,9 @@
  */
 
 // library includes
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #ifdef _IRRIMGUI_WINDOWS_
 #include <windows.h>
@@ -43,6 +46,9 @@
 #include "CIrrlichtIMGUIDriver.h"
 #include "private/CGUITexture.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUIIndices_priv.h"
+#include "private/IrrIMGUIProfiler_priv.h"
+#include "private/IrrIMGUISIMD_priv.h"
 
 /**
 * @addtogroup IrrIMGUIPrivate
@@ -69,21 +75,14 @@ namespace IrrlichtHelper
   /// @brief Indicates, if trilinear filter should be enabled for textures.
   static bool IsTrilinearFilterEnabled = false;
 
-  /// @brief Translates an IMGUI Color to an Irrlicht Color.
-  /// @param ImGuiColor is the u32 Color value from IMGUI.
-  /// @return Returns a SColor object for Irrlicht.
-  irr::video::SColor getColorFromImGuiColor(irr::u32 ImGuiColor);
-
-  /// @brief Copies a list of IMGUI vertices to a list of Irrlicht Vertices.
-  /// @param rIMGUIVertexBuffer Is an IMGUI Vertex-Buffer object.
-  /// @param pIrrlichtVertex    Is a pointer to an Irrlicht Vertex Array.
-  /// @param rOffset            Is an offset that is applied to every vertex.
-  void copyImGuiVertices2IrrlichtVertices(ImVector<ImDrawVert> &rIMGUIVertexBuffer, irr::video::S3DVertex * pIrrlichtVertex, irr::core::vector3df const &rOffset);
+  /// @brief After this number of frames the staging buffers are shrunk to the size needed in this period.
+  static irr::u32 const FramesPerStagingBufferShrink = 600;
 
   /// @brief Creates a Texture object from the currently loaded Fonts.
-  /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
+  /// @param pIrrDriver   Is a pointer to the Irrlicht driver object.
+  /// @param rImageBuffer Is a buffer for the expanded pixels of the font, which is reused for every texture.
   /// @return Returns ITexture object as IMGUI Texture ID.
-  ImTextureID copyTextureIDFromGUIFont(irr::video::IVideoDriver * pIrrDriver);
+  ImTextureID copyTextureIDFromGUIFont(irr::video::IVideoDriver * pIrrDriver, CStagingBuffer<irr::u32> &rImageBuffer);
 
   /// @brief Created a Texture object from raw data.
   /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
@@ -91,7 +90,8 @@ namespace IrrlichtHelper
   /// @param pPixelData  Is a pointer to the pixel array.
   /// @param Width       Is the number of Pixels in X direction.
   /// @param Height      Is the number of Pixels in Y direction.
-  ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver * pIrrDriver, EColorFormat ColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height);
+  /// @param rImageBuffer Is a buffer for the expanded pixels of alpha textures, which is reused for every texture.
+  ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver * pIrrDriver, EColorFormat ColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height, CStagingBuffer<irr::u32> &rImageBuffer);
 
   /// @brief Creates a Texture object from the currently loaded Fonts.
   /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
@@ -99,6 +99,22 @@ namespace IrrlichtHelper
   /// @return Returns ITexture object as IMGUI Texture ID.
   ImTextureID copyTextureIDFromImage(irr::video::IVideoDriver * pIrrDriver, irr::video::IImage * pImage);
 
+  /// @brief Writes raw data into a rectangle of an existing texture object.
+  /// @param pTexture    Is a pointer to the Irrlicht texture object.
+  /// @param ColorFormat Is the format of the Color of every Pixel.
+  /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+  /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+  /// @param X           Is the left border of the rectangle inside the texture.
+  /// @param Y           Is the upper border of the rectangle inside the texture.
+  /// @param Width       Is the number of Pixels in X direction.
+  /// @param Height      Is the number of Pixels in Y direction.
+  void copyRawDataIntoTexture(irr::video::ITexture * pTexture, EColorFormat ColorFormat, irr::u8 const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height);
+
+  /// @brief Writes the content of an image into an existing texture object with the same size.
+  /// @param pTexture    Is a pointer to the Irrlicht texture object.
+  /// @param pImage      Is a pointer to the Irrlicht image object.
+  void copyImageIntoTexture(irr::video::ITexture * pTexture, irr::video::IImage * pImage);
+
   /// @brief Deleted the memory from this texture ID.
   /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
   /// @param pGUITexture is a pointer to the texture object.
@@ -113,17 +129,116 @@ namespace IrrlichtHelper
   /// @param pTexture  Is the texture, that should be used.
   void setupStandardGUIMaterial(irr::video::SMaterial &rMaterial, irr::video::ITexture * pTexture);
 
-  /// @brief Apples a clipping rectangle. Outside of this rectangle nothing is rendered.
+  /// @brief Sets the blend function and the color mask of the GUI material.
+  /// @param rMaterial Is a reference to the material where the settings should be applied to.
+  /// @param BlendMode Is the blend mode to apply.
+  void setupBlendMode(irr::video::SMaterial &rMaterial, EBlendMode BlendMode);
+
+  /// @brief Apples a clipping rectangle with four clip planes. Outside of this rectangle nothing is rendered.
   /// @param pIrrDriver    Is a pointer to the Irrlicht driver object.
   /// @param rClippingRect Is the IMGUI clipping rect to apply.
-  void applyClippingRect(irr::video::IVideoDriver * pIrrDriver, ImVec4 &rClippingRect);
+  void applyClippingRect(irr::video::IVideoDriver * pIrrDriver, ImVec4 const &rClippingRect);
 
-  /// @brief Disables the clipping rectangle.
+  /// @brief Disables the clip planes of the clipping rectangle.
   /// @param pIrrDriver    Is a pointer to the Irrlicht driver object.
   void disableClippingRect(irr::video::IVideoDriver * pIrrDriver);
+
+  /// @brief Sets the viewport to a clipping rectangle and adjusts the projection, thus the GUI keeps its position on the screen.
+  /// @param pIrrDriver    Is a pointer to the Irrlicht driver object.
+  /// @param rViewPort     Is the clipping rectangle in pixel (must be inside the render target).
+  void applyClippingViewPort(irr::video::IVideoDriver * pIrrDriver, irr::core::rect<irr::s32> const &rViewPort);
+
+  /// @brief Sets the OpenGL scissor rectangle to a clipping rectangle.
+  /// @param rScissor           Is the clipping rectangle in pixel (must be inside the render target).
+  /// @param RenderTargetHeight Is the height of the render target.
+  void applyClippingScissor(irr::core::rect<irr::s32> const &rScissor, irr::u32 RenderTargetHeight);
+
+  /// @param pIrrDriver Is a pointer to the Irrlicht driver object.
+  /// @return Returns the orthogonal projection, that maps the pixels of the whole render target.
+  irr::core::matrix4 getGUIProjection(irr::video::IVideoDriver * pIrrDriver);
+
+  /// @brief Returns the indices of a batch as 16 bit indices relative to the first vertex used by the batch.
+  /// @param pIndices        Is a pointer to the first index of the batch.
+  /// @param NumberOfIndices Is the number of indices of the batch.
+  /// @param BaseIndex       Is the smallest index of the batch.
+  /// @param rIndexBuffer    Is a buffer for the rebased indices, which is used when the indices cannot be drawn directly.
+  /// @return Returns a pointer to the indices to draw.
+  irr::u16 const * prepareBatchIndices(irr::u16 const * const pIndices, irr::u32 const NumberOfIndices, irr::u32 const BaseIndex, CStagingBuffer<irr::u16> &rIndexBuffer)
+  {
+    if (BaseIndex == 0)
+    {
+      return pIndices;
+    }
+
+    irr::u16 * const pRebasedIndices = rIndexBuffer.getBuffer(NumberOfIndices);
+    Indices::rebaseIndices(pIndices, pRebasedIndices, NumberOfIndices, BaseIndex);
+
+    return pRebasedIndices;
+  }
+
+  /// @copydoc prepareBatchIndices
+  irr::u16 const * prepareBatchIndices(irr::u32 const * const pIndices, irr::u32 const NumberOfIndices, irr::u32 const BaseIndex, CStagingBuffer<irr::u16> &rIndexBuffer)
+  {
+    irr::u16 * const pRebasedIndices = rIndexBuffer.getBuffer(NumberOfIndices);
+    Indices::rebaseIndices(pIndices, pRebasedIndices, NumberOfIndices, BaseIndex);
+
+    return pRebasedIndices;
+  }
+
+  /// @param rCommand     Is the draw command that is drawn.
+  /// @param rNextCommand Is the draw command that follows directly after rCommand.
+  /// @return Returns true, if both commands can be drawn with a single draw call.
+  bool canDrawCommandsBeMerged(ImDrawCmd const &rCommand, ImDrawCmd const &rNextCommand);
+
+  /// @brief Helper Class to setup the Irrlicht transformations for GUI rendering with mesh buffers and to restore them afterwards.
+  /// @details Mesh buffers are drawn in 3D mode, thus the orthogonal projection of the 2D mode must be set by hand.
+  class CTransformationState
+  {
+    public:
+      /// @brief The Constructor stores the transformations and sets up the GUI transformations.
+      /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
+      /// @param IsEnabled   When this is false, the transformations are not touched at all.
+      /// @param rOffset     Is the pixel offset that has been applied to every vertex.
+      CTransformationState(irr::video::IVideoDriver * pIrrDriver, bool IsEnabled, irr::core::vector3df const &rOffset);
+
+      /// @brief The Destructor restores the transformations.
+      ~CTransformationState(void);
+
+    private:
+      irr::video::IVideoDriver * const mpIrrDriver;
+      bool const                       mIsEnabled;
+      irr::core::matrix4               mOldProjection;
+      irr::core::matrix4               mOldView;
+      irr::core::matrix4               mOldWorld;
+  };
 }
 
-  irr::core::vector3df CIrrlichtIMGUIDriver::mOffset(0.0f, 0.0f, 0.0f);
+  irr::core::vector3df                  CIrrlichtIMGUIDriver::mOffset(0.0f, 0.0f, 0.0f);
+  CStagingBuffer<irr::video::S3DVertex> CIrrlichtIMGUIDriver::mVertexBuffer;
+  CStagingBuffer<irr::u16>              CIrrlichtIMGUIDriver::mIndexBuffer;
+  CStagingBuffer<irr::u32>              CIrrlichtIMGUIDriver::mUnwrappedIndexBuffer;
+  CStagingBuffer<irr::u32>              CIrrlichtIMGUIDriver::mImageBuffer;
+  CCommandListCache                     CIrrlichtIMGUIDriver::mCommandListCache;
+  CVertexConverter                      CIrrlichtIMGUIDriver::mVertexConverter;
+  std::vector<irr::video::S3DVertex*>   CIrrlichtIMGUIDriver::mVertexArrays;
+  CTriangleClipper                      CIrrlichtIMGUIDriver::mTriangleClipper;
+  CStagingBuffer<irr::video::S3DVertex> CIrrlichtIMGUIDriver::mFrameVertexBuffer;
+  CStagingBuffer<irr::u32>              CIrrlichtIMGUIDriver::mFrameIndexBuffer;
+  std::vector<ImDrawCmd>                CIrrlichtIMGUIDriver::mFrameCommands;
+  irr::u32                              CIrrlichtIMGUIDriver::mFramesSinceShrink = 0;
+  irr::video::SMaterial                 CIrrlichtIMGUIDriver::mMaterial;
+  irr::video::ITexture                * CIrrlichtIMGUIDriver::mpLastTexture = nullptr;
+  bool                                  CIrrlichtIMGUIDriver::mIsMaterialApplied = false;
+  EBlendMode                            CIrrlichtIMGUIDriver::mMaterialBlendMode = EBM_STANDARD;
+  bool                                  CIrrlichtIMGUIDriver::mIsMeshBufferUsed = false;
+  bool                                  CIrrlichtIMGUIDriver::mIsTransformationUsed = false;
+  EClippingMode                         CIrrlichtIMGUIDriver::mClippingMode = ECM_CLIP_PLANES;
+  ImVec4                                CIrrlichtIMGUIDriver::mClippingRect;
+  bool                                  CIrrlichtIMGUIDriver::mIsClippingEnabled = false;
+  bool                                  CIrrlichtIMGUIDriver::mIsClippingRectApplied = false;
+  irr::core::rect<irr::s32>             CIrrlichtIMGUIDriver::mOldViewPort;
+  std::vector<irr::scene::SMeshBuffer*> CIrrlichtIMGUIDriver::mMeshBuffers;
+  irr::u32                              CIrrlichtIMGUIDriver::mNumberOfUsedMeshBuffers = 0;
 
   CIrrlichtIMGUIDriver::CIrrlichtIMGUIDriver(irr::IrrlichtDevice * const pDevice):
     IIMGUIDriver(pDevice)
@@ -159,12 +274,35 @@ namespace IrrlichtHelper
         break;
     }
 
+    IrrlichtHelper::setupStandardGUIMaterial(mMaterial, nullptr);
 
     return;
   }
 
   CIrrlichtIMGUIDriver::~CIrrlichtIMGUIDriver(void)
   {
+    mVertexBuffer.clear();
+    mIndexBuffer.clear();
+    mUnwrappedIndexBuffer.clear();
+    mImageBuffer.clear();
+    mFrameVertexBuffer.clear();
+    mFrameIndexBuffer.clear();
+    std::vector<ImDrawCmd>().swap(mFrameCommands);
+    mCommandListCache.clear();
+    mVertexConverter.setNumberOfThreads(1);
+    std::vector<irr::video::S3DVertex*>().swap(mVertexArrays);
+    mFramesSinceShrink = 0;
+    mMaterial.setTexture(0, nullptr);
+    mpLastTexture      = nullptr;
+    mIsMaterialApplied = false;
+    mMaterialBlendMode = EBM_STANDARD;
+    mIsMeshBufferUsed  = false;
+    mIsTransformationUsed = false;
+    mIsClippingEnabled = false;
+    mIsClippingRectApplied = false;
+    mNumberOfUsedMeshBuffers = 0;
+    releaseMeshBuffers(0);
+
     return;
   }
 
@@ -173,6 +311,7 @@ namespace IrrlichtHelper
     ImGuiIO &rGUIIO  = ImGui::GetIO();
 
     rGUIIO.RenderDrawListsFn = CIrrlichtIMGUIDriver::drawGUIList;
+    mpPrepareFunction        = CIrrlichtIMGUIDriver::preparePipelineFrame;
 
     return;
   }
@@ -185,80 +324,758 @@ namespace IrrlichtHelper
     irr::video::SMaterial const CurrentMaterial = pIrrDriver->getMaterial2D();
     pIrrDriver->enableMaterial2D(true);
 
-    IrrlichtHelper::applyMovingClippingPlaneWorkaround(pIrrDriver);
+    // give back memory after a spike of vertices (e.g. a huge window that has been closed),
+    // but not before a repeated drawing, which uses the vertices inside the staging buffers again
+    if (!isDrawDataRepeated())
+    {
+      mFramesSinceShrink++;
+      if (mFramesSinceShrink >= IrrlichtHelper::FramesPerStagingBufferShrink)
+      {
+        mVertexBuffer.shrink();
+        mIndexBuffer.shrink();
+        mUnwrappedIndexBuffer.shrink();
+        mImageBuffer.shrink();
+        mFrameVertexBuffer.shrink();
+        mFrameIndexBuffer.shrink();
+        releaseMeshBuffers(mNumberOfUsedMeshBuffers);
+        mFramesSinceShrink = 0;
+      }
+    }
 
-    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    // the material might have been changed since the last frame
+    mIsMaterialApplied = false;
+    mNumberOfUsedMeshBuffers = 0;
+
+    EBlendMode const BlendMode = getBlendMode();
+    if (BlendMode != mMaterialBlendMode)
     {
-      drawCommandList(pDrawData->CmdLists[CommandListIndex]);
+      IrrlichtHelper::setupBlendMode(mMaterial, BlendMode);
+      mMaterialBlendMode = BlendMode;
+    }
+
+    // the 2D render mode of Irrlicht uses always the standard blend function
+    mIsMeshBufferUsed = getSettings().mIsMeshBufferStreamingEnabled || (BlendMode != EBM_STANDARD);
+
+    // Irrlicht has no scissor interface, thus the scissor test is only available, when the render driver uses OpenGL
+    mClippingMode = getSettings().mClippingMode;
+    if ((mClippingMode == ECM_SCISSOR) && (pIrrDriver->getDriverType() != irr::video::EDT_OPENGL))
+    {
+      mClippingMode = ECM_VIEWPORT;
+    }
+
+    // the viewport clipping adjusts the projection, which is not possible in the 2D mode of Irrlicht
+    mIsTransformationUsed = mIsMeshBufferUsed || (mClippingMode == ECM_VIEWPORT);
+    mOldViewPort          = pIrrDriver->getViewPort();
+    mIsClippingEnabled    = false;
+
+    if (mClippingMode == ECM_CLIP_PLANES)
+    {
+      IrrlichtHelper::applyMovingClippingPlaneWorkaround(pIrrDriver);
+    }
+
+    // a repeated drawing uses the cached vertices of the call before, thus they must not age
+    if (!isDrawDataRepeated())
+    {
+      if (getSettings().mIsCommandListCacheEnabled)
+      {
+        mCommandListCache.setMaxNumberOfVertices(getSettings().mMaxCachedVertices);
+        mCommandListCache.startFrame();
+      }
+      else
+      {
+        mCommandListCache.clear();
+      }
+    }
+
+    CDrawDataPipeline::SFrame const * const pPipelineFrame = getPipelineFrame();
+    if (isDrawDataRepeated())
+    {
+      // the vertices of the call before are drawn again, a conversion in place would apply the offset and color swizzle twice
+      FASSERT(mVertexArrays.size() == static_cast<size_t>(pDrawData->CmdListsCount));
+    }
+    else if ((pPipelineFrame != nullptr) && (&pPipelineFrame->mDrawData == pDrawData))
+    {
+      // the vertices have already been converted by the worker thread of the render pipeline
+      mVertexArrays = pPipelineFrame->mVertexArrays;
+      mStatistics.mConversionTime         += pPipelineFrame->mConversionTime;
+      mStatistics.mNumberOfConvertedBytes += pPipelineFrame->mNumberOfConvertedBytes;
+    }
+    else
+    {
+      // the vertices of all command lists are converted before drawing, thus they can be converted in parallel
+      CProfilerZone const Zone(EPZ_CONVERSION);
+      std::chrono::steady_clock::time_point const ConversionStart = std::chrono::steady_clock::now();
+      convertCommandLists(pDrawData);
+      mStatistics.mConversionTime += getMillisecondsSince(ConversionStart);
+    }
+
+    {
+      IrrlichtHelper::CTransformationState const TransformationState(pIrrDriver, mIsTransformationUsed, mOffset);
+
+      if (getSettings().mIsFrameMergingEnabled && canFrameBeMerged(pDrawData))
+      {
+        drawMergedFrame(pDrawData);
+      }
+      else
+      {
+        for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+        {
+          drawCommandList(pDrawData->CmdLists[CommandListIndex], mVertexArrays[CommandListIndex]);
+        }
+      }
+
+      disableClipping();
     }
 
     pIrrDriver->enableMaterial2D(false);
     pIrrDriver->getMaterial2D() = CurrentMaterial;
 
+    mStatistics.mNumberOfCachedVertices = mCommandListCache.getNumberOfVertices();
+
     return;
   }
 
-  void CIrrlichtIMGUIDriver::drawCommandList(ImDrawList * pCommandList)
+  void CIrrlichtIMGUIDriver::drawCommandList(ImDrawList * pCommandList, irr::video::S3DVertex * const pVertexArray)
   {
-    irr::u16 * const pIndices = &(pCommandList->IdxBuffer.front());
+    ImDrawIdx const * const pIndices = &(pCommandList->IdxBuffer.front());
+    ImDrawCmd const * const pCommands = &(pCommandList->CmdBuffer.front());
+    irr::u32 const NumberOfCommands = pCommandList->CmdBuffer.size();
+    irr::u32 const NumberOfVertices = pCommandList->VtxBuffer.size();
+
+#ifndef _IRRIMGUI_32BIT_INDICES_
+    // the 16 bit indices of lists with more than 65536 vertices have overflown, thus the real indices are restored
+    // and drawElements splits the commands into several draw calls
+    if (NumberOfVertices > (Indices::MaxBatchIndexRange + 1))
+    {
+      irr::u32 const NumberOfIndices = pCommandList->IdxBuffer.size();
+      irr::u32 * const pIndexArray = mUnwrappedIndexBuffer.getBuffer(NumberOfIndices);
+      Indices::unwrapIndices(pIndices, pIndexArray, NumberOfIndices);
+      mStatistics.mNumberOfConvertedBytes += NumberOfIndices * sizeof(irr::u32);
+      drawCommands(pCommandList, pCommands, NumberOfCommands, pVertexArray, NumberOfVertices, static_cast<irr::u32 const *>(pIndexArray));
+      return;
+    }
+#endif // _IRRIMGUI_32BIT_INDICES_
 
-    irr::u32 LastUsedIndex = 0;
-    irr::u32 const NumberOfVertex = pCommandList->VtxBuffer.size();
+    drawCommands(pCommandList, pCommands, NumberOfCommands, pVertexArray, NumberOfVertices, pIndices);
+
+    return;
+  }
 
-    // TODO: Workaround for incompatible Vertex datatype in IMGUI.
-    //       This costs a lot of performance... nevertheless it seems
-    //       that the Irrlicht driver is still faster than the
-    //       native OpenGL driver.
-    irr::video::S3DVertex * const pVertexArray = new irr::video::S3DVertex[NumberOfVertex];
-    IrrlichtHelper::copyImGuiVertices2IrrlichtVertices(pCommandList->VtxBuffer, pVertexArray, mOffset);
+  template <typename TIndex>
+  void CIrrlichtIMGUIDriver::drawCommands(ImDrawList * const pCommandList, ImDrawCmd const * const pCommands, irr::u32 const NumberOfCommands, irr::video::S3DVertex * const pVertexArray, irr::u32 const NumberOfVertices, TIndex const * const pIndices)
+  {
+    if (mClippingMode == ECM_CPU)
+    {
+      drawClippedCommands(pCommandList, pCommands, NumberOfCommands, pVertexArray, NumberOfVertices, pIndices);
+      return;
+    }
 
-    irr::video::IVideoDriver * pIrrDriver = getIrrDevice()->getVideoDriver();
+    bool const IsDrawCommandMergingEnabled = getSettings().mIsDrawCommandMergingEnabled;
+    irr::u32 LastUsedIndex = 0;
 
-    for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
+    for (irr::u32 CommandIndex = 0; CommandIndex < NumberOfCommands; CommandIndex++)
     {
-      ImDrawCmd * const pDrawCommand = &pCommandList->CmdBuffer[CommandIndex];
+      ImDrawCmd const * const pDrawCommand = &pCommands[CommandIndex];
+      mStatistics.mNumberOfDrawCommands++;
 
       if (pDrawCommand->UserCallback != NULL)
       {
+        FASSERT(pCommandList != nullptr);
+
+        // the callback draws without the clipping rectangle of the command before
+        disableClipping();
         pDrawCommand->UserCallback(pCommandList, pDrawCommand);
+
+        // the callback could render something with an own material, viewport or clipping planes
+        mIsMaterialApplied = false;
+        invalidateClippingRect();
       }
       else
       {
+        irr::u32 NumberOfElements = pDrawCommand->ElemCount;
 
-        CGUITexture * const pGUITexture = static_cast<CGUITexture * const>(pDrawCommand->TextureId);
+        // the indices of adjacent commands are stored one after another, thus compatible commands are drawn together
+        if (IsDrawCommandMergingEnabled)
+        {
+          while (((CommandIndex + 1) < NumberOfCommands) && IrrlichtHelper::canDrawCommandsBeMerged(*pDrawCommand, pCommands[CommandIndex + 1]))
+          {
+            CommandIndex++;
+            NumberOfElements += pCommands[CommandIndex].ElemCount;
+            mStatistics.mNumberOfDrawCommands++;
+            mStatistics.mNumberOfMergedDrawCommands++;
+          }
+        }
 
-        FASSERT(pGUITexture);
-        FASSERT(pGUITexture->mIsValid);
+        if (NumberOfElements > 0)
+        {
+          drawElements(*pDrawCommand, pVertexArray, &pIndices[LastUsedIndex], NumberOfElements);
+        }
 
-        irr::video::ITexture * const pIrrlichtTexture = static_cast<irr::video::ITexture * const>(pGUITexture->mGPUTextureID);
+        LastUsedIndex += NumberOfElements;
 
-        irr::video::SMaterial Material;
-        IrrlichtHelper::setupStandardGUIMaterial(Material, pIrrlichtTexture);
-        pIrrDriver->setMaterial(Material);
-        pIrrDriver->getMaterial2D() = Material;
+      }
 
-        IrrlichtHelper::applyClippingRect(pIrrDriver, pDrawCommand->ClipRect);
+    }
 
-        pIrrDriver->draw2DVertexPrimitiveList(
-            pVertexArray,
-            NumberOfVertex,
-            &pIndices[LastUsedIndex],
-            pDrawCommand->ElemCount / 3,
-            irr::video::EVT_STANDARD,
-            irr::scene::EPT_TRIANGLES,
-            irr::video::EIT_16BIT
-            );
+    return;
+  }
 
+  void CIrrlichtIMGUIDriver::drawMergedFrame(ImDrawData * const pDrawData)
+  {
+    irr::u32 NumberOfVertices = 0;
+    irr::u32 NumberOfIndices  = 0;
+    irr::u32 NumberOfCommands = 0;
+    bool     IsContiguous     = true;
 
-        IrrlichtHelper::disableClippingRect(pIrrDriver);
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList const * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+      // the converted vertices of lists from the staging buffer are usually already stored one after another
+      IsContiguous = IsContiguous && (mVertexArrays[CommandListIndex] == (mVertexArrays[0] + NumberOfVertices));
+
+      NumberOfVertices += pCommandList->VtxBuffer.size();
+      NumberOfIndices  += pCommandList->IdxBuffer.size();
+      NumberOfCommands += pCommandList->CmdBuffer.size();
+    }
+
+    irr::video::S3DVertex * pFrameVertices = mVertexArrays[0];
+    if (!IsContiguous)
+    {
+      pFrameVertices = mFrameVertexBuffer.getBuffer(NumberOfVertices);
+    }
+
+    irr::u32 * const pFrameIndices = mFrameIndexBuffer.getBuffer(NumberOfIndices);
+    mFrameCommands.resize(NumberOfCommands);
+
+    irr::u32 FirstVertex  = 0;
+    irr::u32 FirstIndex   = 0;
+    irr::u32 FirstCommand = 0;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList const * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      irr::u32 const NumberOfListVertices = pCommandList->VtxBuffer.size();
+      irr::u32 const NumberOfListIndices  = pCommandList->IdxBuffer.size();
+      ImDrawIdx const * const pListIndices = &(pCommandList->IdxBuffer.front());
+
+      if (!IsContiguous)
+      {
+        std::memcpy(&pFrameVertices[FirstVertex], mVertexArrays[CommandListIndex], NumberOfListVertices * sizeof(irr::video::S3DVertex));
+      }
+
+#ifndef _IRRIMGUI_32BIT_INDICES_
+      if (NumberOfListVertices > (Indices::MaxBatchIndexRange + 1))
+      {
+        // the overflown 16 bit indices are restored before they are rebased to the frame
+        Indices::unwrapIndices(pListIndices, &pFrameIndices[FirstIndex], NumberOfListIndices);
+        for (irr::u32 i = 0; i < NumberOfListIndices; i++)
+        {
+          pFrameIndices[FirstIndex + i] += FirstVertex;
+        }
+      }
+      else
+#endif // _IRRIMGUI_32BIT_INDICES_
+      {
+        for (irr::u32 i = 0; i < NumberOfListIndices; i++)
+        {
+          pFrameIndices[FirstIndex + i] = pListIndices[i] + FirstVertex;
+        }
+      }
+
+      std::copy(pCommandList->CmdBuffer.begin(), pCommandList->CmdBuffer.end(), mFrameCommands.begin() + FirstCommand);
+
+      FirstVertex  += NumberOfListVertices;
+      FirstIndex   += NumberOfListIndices;
+      FirstCommand += pCommandList->CmdBuffer.size();
+    }
+
+    mStatistics.mNumberOfMergedCommandLists += pDrawData->CmdListsCount;
+    mStatistics.mNumberOfConvertedBytes    += NumberOfIndices * sizeof(irr::u32);
+    if (!IsContiguous)
+    {
+      mStatistics.mNumberOfConvertedBytes  += NumberOfVertices * sizeof(irr::video::S3DVertex);
+    }
+    drawCommands(nullptr, mFrameCommands.data(), NumberOfCommands, pFrameVertices, NumberOfVertices, static_cast<irr::u32 const *>(pFrameIndices));
 
-        LastUsedIndex += pDrawCommand->ElemCount;
+    return;
+  }
+
+  bool CIrrlichtIMGUIDriver::canFrameBeMerged(ImDrawData const * const pDrawData)
+  {
+    if (pDrawData->CmdListsCount < 2)
+    {
+      // a single list is already a single stream
+      return false;
+    }
+
+    // user callbacks expect the command list of their command
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList const * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+      for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
+      {
+        if (pCommandList->CmdBuffer[CommandIndex].UserCallback != NULL)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  void CIrrlichtIMGUIDriver::convertCommandLists(ImDrawData * const pDrawData)
+  {
+    mVertexArrays.resize(pDrawData->CmdListsCount);
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    // IMGUI vertices have already the Irrlicht layout, they only need a fix-up pass in place.
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      mVertexArrays[CommandListIndex] = reinterpret_cast<irr::video::S3DVertex *>(pCommandList->VtxBuffer.Data);
+      mVertexConverter.addVertices(pCommandList->VtxBuffer.Data, nullptr, pCommandList->VtxBuffer.size());
+      mStatistics.mNumberOfConvertedBytes += pCommandList->VtxBuffer.size() * sizeof(irr::video::S3DVertex);
+    }
+#else
+    bool const IsCommandListCacheEnabled = getSettings().mIsCommandListCacheEnabled;
+    irr::u32 NumberOfStagedVertices = 0;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      irr::video::S3DVertex * pVertexArray = nullptr;
+
+      if (IsCommandListCacheEnabled)
+      {
+        pVertexArray = mCommandListCache.findVertices(pCommandList);
+
+        if (pVertexArray != nullptr)
+        {
+          mStatistics.mNumberOfCacheHits++;
+          mVertexArrays[CommandListIndex] = pVertexArray;
+          continue;
+        }
 
+        mStatistics.mNumberOfCacheMisses++;
+        pVertexArray = mCommandListCache.addCommandList(pCommandList);
       }
 
+      if (pVertexArray != nullptr)
+      {
+        mVertexConverter.addVertices(pCommandList->VtxBuffer.Data, pVertexArray, pCommandList->VtxBuffer.size());
+        mStatistics.mNumberOfConvertedBytes += pCommandList->VtxBuffer.size() * sizeof(irr::video::S3DVertex);
+      }
+      else
+      {
+        // the list is converted into the staging buffer, when all lists are known
+        NumberOfStagedVertices += pCommandList->VtxBuffer.size();
+      }
+
+      mVertexArrays[CommandListIndex] = pVertexArray;
+    }
+
+    // Workaround for incompatible Vertex datatype in IMGUI.
+    // Compile with _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_ to avoid this copy.
+    if (NumberOfStagedVertices > 0)
+    {
+      irr::video::S3DVertex * pStagingBuffer = mVertexBuffer.getBuffer(NumberOfStagedVertices);
+      mStatistics.mNumberOfConvertedBytes += NumberOfStagedVertices * sizeof(irr::video::S3DVertex);
+
+      for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+      {
+        ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+        if (mVertexArrays[CommandListIndex] == nullptr)
+        {
+          mVertexArrays[CommandListIndex] = pStagingBuffer;
+          mVertexConverter.addVertices(pCommandList->VtxBuffer.Data, pStagingBuffer, pCommandList->VtxBuffer.size());
+          pStagingBuffer += pCommandList->VtxBuffer.size();
+        }
+      }
+    }
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+    mVertexConverter.setNumberOfThreads(getSettings().mNumberOfConversionThreads);
+    mVertexConverter.convert(mOffset);
+
+    return;
+  }
+
+  void CIrrlichtIMGUIDriver::preparePipelineFrame(CDrawDataPipeline::SFrame &rFrame)
+  {
+    ImDrawData const * const pDrawData = &rFrame.mDrawData;
+    rFrame.mVertexArrays.resize(pDrawData->CmdListsCount);
+
+    // This runs on the worker thread, thus the command list cache and the staging buffers of the render thread are not used.
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      rFrame.mVertexArrays[CommandListIndex] = SIMD::convertVerticesInPlace(pCommandList->VtxBuffer.Data, pCommandList->VtxBuffer.size(), mOffset);
+      rFrame.mNumberOfConvertedBytes += pCommandList->VtxBuffer.size() * sizeof(irr::video::S3DVertex);
+    }
+#else
+    irr::u32 NumberOfVertices = 0;
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      NumberOfVertices += pDrawData->CmdLists[CommandListIndex]->VtxBuffer.size();
+    }
+
+    rFrame.mVertices.resize(NumberOfVertices);
+    rFrame.mNumberOfConvertedBytes = NumberOfVertices * sizeof(irr::video::S3DVertex);
+    irr::video::S3DVertex * pVertexArray = rFrame.mVertices.data();
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      SIMD::convertVertices(pCommandList->VtxBuffer.Data, pVertexArray, pCommandList->VtxBuffer.size(), mOffset);
+      rFrame.mVertexArrays[CommandListIndex] = pVertexArray;
+      pVertexArray += pCommandList->VtxBuffer.size();
+    }
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+    return;
+  }
+
+  template <typename TIndex>
+  void CIrrlichtIMGUIDriver::drawElements(ImDrawCmd const &rDrawCommand, irr::video::S3DVertex * const pVertexArray, TIndex const * const pIndices, irr::u32 const NumberOfElements)
+  {
+    if (!applyClippingRect(rDrawCommand.ClipRect))
+    {
+      // nothing of this draw command is visible
+      return;
+    }
+
+    applyTexture(rDrawCommand);
+
+    // submit only the vertices that are used by a draw call, since some render drivers process (or upload) every vertex
+    // of the array for every draw call. A draw call contains as many triangles as can be addressed with 16 bit indices.
+    irr::u32 FirstElement = 0;
+    while (FirstElement < NumberOfElements)
+    {
+      TIndex const * const pBatchIndices = &pIndices[FirstElement];
+      irr::u32 MinIndex = 0;
+      irr::u32 MaxIndex = 0;
+      irr::u32 const NumberOfBatchElements = Indices::getBatch(pBatchIndices, NumberOfElements - FirstElement, MinIndex, MaxIndex);
+
+      if (NumberOfBatchElements == 0)
+      {
+        // incomplete triangle
+        break;
+      }
+
+      irr::u16 const * const pCommandIndices = IrrlichtHelper::prepareBatchIndices(pBatchIndices, NumberOfBatchElements, MinIndex, mIndexBuffer);
+      drawVertices(&pVertexArray[MinIndex], MaxIndex - MinIndex + 1, pCommandIndices, NumberOfBatchElements);
+
+      FirstElement += NumberOfBatchElements;
+    }
+
+    return;
+  }
+
+  template <typename TIndex>
+  void CIrrlichtIMGUIDriver::drawClippedCommands(ImDrawList * const pCommandList, ImDrawCmd const * const pCommands, irr::u32 const NumberOfCommands, irr::video::S3DVertex * const pVertexArray, irr::u32 const NumberOfVertices, TIndex const * const pIndices)
+  {
+    bool const IsDrawCommandMergingEnabled = getSettings().mIsDrawCommandMergingEnabled;
+
+    mTriangleClipper.begin(pVertexArray, NumberOfVertices, mOffset);
+
+    // the draw command that defines the texture of the current batch
+    ImDrawCmd const * pBatchCommand = nullptr;
+    irr::u32 LastUsedIndex = 0;
+
+    for (irr::u32 CommandIndex = 0; CommandIndex < NumberOfCommands; CommandIndex++)
+    {
+      ImDrawCmd const * const pDrawCommand = &pCommands[CommandIndex];
+      mStatistics.mNumberOfDrawCommands++;
+
+      if (pDrawCommand->UserCallback != NULL)
+      {
+        if (pBatchCommand != nullptr)
+        {
+          drawClippedBatch(*pBatchCommand);
+          pBatchCommand = nullptr;
+        }
+
+        FASSERT(pCommandList != nullptr);
+
+        // the callback draws without the clipping rectangle of the command before
+        disableClipping();
+        pDrawCommand->UserCallback(pCommandList, pDrawCommand);
+
+        // the callback could render something with an own material, viewport or clipping planes
+        mIsMaterialApplied = false;
+        invalidateClippingRect();
+        continue;
+      }
+
+      // the clipping rectangle is part of the triangles, thus only a different texture ends a batch
+      if (pBatchCommand != nullptr)
+      {
+        if (IsDrawCommandMergingEnabled && (pBatchCommand->TextureId == pDrawCommand->TextureId))
+        {
+          mStatistics.mNumberOfMergedDrawCommands++;
+        }
+        else
+        {
+          drawClippedBatch(*pBatchCommand);
+          pBatchCommand = nullptr;
+        }
+      }
+
+      if (pBatchCommand == nullptr)
+      {
+        pBatchCommand = pDrawCommand;
+      }
+
+      irr::u32 const NumberOfElements = pDrawCommand->ElemCount;
+      irr::u32 FirstElement = 0;
+      while ((FirstElement + 3) <= NumberOfElements)
+      {
+        FirstElement += mTriangleClipper.addTriangles(&pIndices[LastUsedIndex + FirstElement], NumberOfElements - FirstElement, pDrawCommand->ClipRect);
+
+        if ((FirstElement + 3) <= NumberOfElements)
+        {
+          // the batch is full
+          drawClippedBatch(*pBatchCommand);
+        }
+      }
+
+      LastUsedIndex += NumberOfElements;
+    }
+
+    if (pBatchCommand != nullptr)
+    {
+      drawClippedBatch(*pBatchCommand);
+    }
+
+    mStatistics.mNumberOfCutTriangles     += mTriangleClipper.getNumberOfCutTriangles();
+    mStatistics.mNumberOfRemovedTriangles += mTriangleClipper.getNumberOfRemovedTriangles();
+
+    return;
+  }
+
+  void CIrrlichtIMGUIDriver::drawClippedBatch(ImDrawCmd const &rDrawCommand)
+  {
+    if (mTriangleClipper.getNumberOfIndices() > 0)
+    {
+      applyTexture(rDrawCommand);
+      drawVertices(mTriangleClipper.getVertices(), mTriangleClipper.getNumberOfVertices(), mTriangleClipper.getIndices(), mTriangleClipper.getNumberOfIndices());
+    }
+
+    mTriangleClipper.startNextBatch();
+
+    return;
+  }
+
+  void CIrrlichtIMGUIDriver::applyTexture(ImDrawCmd const &rDrawCommand)
+  {
+    CGUITexture * const pGUITexture = static_cast<CGUITexture * const>(rDrawCommand.TextureId);
+
+    FASSERT(pGUITexture);
+    FASSERT(pGUITexture->mIsValid);
+
+    irr::video::ITexture * const pIrrlichtTexture = static_cast<irr::video::ITexture * const>(pGUITexture->mGPUTextureID);
+
+    if ((!mIsMaterialApplied) || (pIrrlichtTexture != mpLastTexture))
+    {
+      irr::video::IVideoDriver * const pIrrDriver = getIrrDevice()->getVideoDriver();
+
+      mMaterial.setTexture(0, pIrrlichtTexture);
+      pIrrDriver->setMaterial(mMaterial);
+      pIrrDriver->getMaterial2D() = mMaterial;
+
+      mpLastTexture      = pIrrlichtTexture;
+      mIsMaterialApplied = true;
+      mStatistics.mNumberOfMaterialSwitches++;
+    }
+    else
+    {
+      mStatistics.mNumberOfSavedMaterialSwitches++;
+    }
+
+    return;
+  }
+
+  void CIrrlichtIMGUIDriver::drawVertices(irr::video::S3DVertex const * const pVertices, irr::u32 const NumberOfVertex, irr::u16 const * const pIndices, irr::u32 const NumberOfElements)
+  {
+    irr::video::IVideoDriver * const pIrrDriver = getIrrDevice()->getVideoDriver();
+
+    if (mIsMeshBufferUsed)
+    {
+      drawMeshBuffer(pVertices, NumberOfVertex, pIndices, NumberOfElements);
+    }
+    else if (mIsTransformationUsed)
+    {
+      pIrrDriver->drawVertexPrimitiveList(
+          pVertices,
+          NumberOfVertex,
+          pIndices,
+          NumberOfElements / 3,
+          irr::video::EVT_STANDARD,
+          irr::scene::EPT_TRIANGLES,
+          irr::video::EIT_16BIT
+          );
+    }
+    else
+    {
+      pIrrDriver->draw2DVertexPrimitiveList(
+          pVertices,
+          NumberOfVertex,
+          pIndices,
+          NumberOfElements / 3,
+          irr::video::EVT_STANDARD,
+          irr::scene::EPT_TRIANGLES,
+          irr::video::EIT_16BIT
+          );
+    }
+    mStatistics.mNumberOfDrawCalls++;
+    mStatistics.mNumberOfSubmittedVertices += NumberOfVertex;
+
+    return;
+  }
+
+  bool CIrrlichtIMGUIDriver::applyClippingRect(ImVec4 const &rClippingRect)
+  {
+    if (mIsClippingEnabled && mIsClippingRectApplied &&
+        (rClippingRect.x == mClippingRect.x) && (rClippingRect.y == mClippingRect.y) &&
+        (rClippingRect.z == mClippingRect.z) && (rClippingRect.w == mClippingRect.w))
+    {
+      // the clipping rectangle is still applied
+      return true;
+    }
+
+    mStatistics.mNumberOfClipChanges++;
+
+    irr::video::IVideoDriver * const pIrrDriver = getIrrDevice()->getVideoDriver();
+    irr::core::dimension2d<irr::u32> const &rRenderTargetSize = pIrrDriver->getCurrentRenderTargetSize();
+
+    irr::core::rect<irr::s32> ClippingRect(
+        static_cast<irr::s32>(rClippingRect.x), static_cast<irr::s32>(rClippingRect.y),
+        static_cast<irr::s32>(rClippingRect.z), static_cast<irr::s32>(rClippingRect.w));
+    ClippingRect.clipAgainst(irr::core::rect<irr::s32>(0, 0, rRenderTargetSize.Width, rRenderTargetSize.Height));
+
+    if ((ClippingRect.getWidth() <= 0) || (ClippingRect.getHeight() <= 0))
+    {
+      return false;
+    }
+
+    switch (mClippingMode)
+    {
+      case ECM_VIEWPORT:
+        IrrlichtHelper::applyClippingViewPort(pIrrDriver, ClippingRect);
+        break;
+
+      case ECM_SCISSOR:
+        IrrlichtHelper::applyClippingScissor(ClippingRect, rRenderTargetSize.Height);
+        break;
+
+      case ECM_CLIP_PLANES:
+      default:
+        IrrlichtHelper::applyClippingRect(pIrrDriver, rClippingRect);
+        break;
+    }
+
+    mClippingRect          = rClippingRect;
+    mIsClippingEnabled     = true;
+    mIsClippingRectApplied = true;
+
+    return true;
+  }
+
+  void CIrrlichtIMGUIDriver::disableClipping(void)
+  {
+    if (!mIsClippingEnabled)
+    {
+      return;
+    }
+
+    irr::video::IVideoDriver * const pIrrDriver = getIrrDevice()->getVideoDriver();
+
+    switch (mClippingMode)
+    {
+      case ECM_VIEWPORT:
+        // the viewport clipping has changed the projection, thus the projection of the whole render target is set again
+        pIrrDriver->setViewPort(mOldViewPort);
+        pIrrDriver->setTransform(irr::video::ETS_PROJECTION, IrrlichtHelper::getGUIProjection(pIrrDriver));
+        break;
+
+      case ECM_SCISSOR:
+        glDisable(GL_SCISSOR_TEST);
+        break;
+
+      case ECM_CLIP_PLANES:
+      default:
+        IrrlichtHelper::disableClippingRect(pIrrDriver);
+        break;
+    }
+
+    mIsClippingEnabled = false;
+
+    return;
+  }
+
+  bool CIrrlichtIMGUIDriver::isClippingEnabled(void)
+  {
+    return mIsClippingEnabled;
+  }
+
+  void CIrrlichtIMGUIDriver::invalidateClippingRect(void)
+  {
+    mIsClippingRectApplied = false;
+    return;
+  }
+
+  void CIrrlichtIMGUIDriver::drawMeshBuffer(irr::video::S3DVertex const * const pVertices, irr::u32 const NumberOfVertex, irr::u16 const * const pIndices, irr::u32 const NumberOfElements)
+  {
+    irr::scene::SMeshBuffer * const pMeshBuffer = getNextMeshBuffer();
+
+    pMeshBuffer->Vertices.set_used(NumberOfVertex);
+    std::memcpy(pMeshBuffer->Vertices.pointer(), pVertices, NumberOfVertex * sizeof(irr::video::S3DVertex));
+
+    pMeshBuffer->Indices.set_used(NumberOfElements);
+    std::memcpy(pMeshBuffer->Indices.pointer(), pIndices, NumberOfElements * sizeof(irr::u16));
+
+    // the render driver uploads the buffers again at the next draw call
+    pMeshBuffer->setDirty(irr::scene::EBT_VERTEX_AND_INDEX);
+
+    getIrrDevice()->getVideoDriver()->drawMeshBuffer(pMeshBuffer);
+
+    return;
+  }
+
+  irr::scene::SMeshBuffer * CIrrlichtIMGUIDriver::getNextMeshBuffer(void)
+  {
+    if (mNumberOfUsedMeshBuffers == mMeshBuffers.size())
+    {
+      irr::scene::SMeshBuffer * const pMeshBuffer = new irr::scene::SMeshBuffer();
+      pMeshBuffer->setHardwareMappingHint(irr::scene::EHM_STREAM, irr::scene::EBT_VERTEX_AND_INDEX);
+      mMeshBuffers.push_back(pMeshBuffer);
+    }
+
+    irr::scene::SMeshBuffer * const pMeshBuffer = mMeshBuffers[mNumberOfUsedMeshBuffers];
+    mNumberOfUsedMeshBuffers++;
+
+    return pMeshBuffer;
+  }
+
+  void CIrrlichtIMGUIDriver::releaseMeshBuffers(irr::u32 const NumberOfKeptBuffers)
+  {
+    irr::video::IVideoDriver * const pIrrDriver = getIrrDevice()->getVideoDriver();
+
+    while (mMeshBuffers.size() > NumberOfKeptBuffers)
+    {
+      irr::scene::SMeshBuffer * const pMeshBuffer = mMeshBuffers.back();
+
+      pIrrDriver->removeHardwareBuffer(pMeshBuffer);
+      pMeshBuffer->drop();
+
+      mMeshBuffers.pop_back();
     }
 
-    delete[] pVertexArray;
     return;
   }
 
@@ -271,7 +1088,8 @@ namespace IrrlichtHelper
     pGUITexture->mSourceType       = ETST_RAWDATA;
     pGUITexture->mSource.RawDataID = pPixelData;
     pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height);
+    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height, mImageBuffer);
+    mNumberOfTextureAllocations++;
 
     return pGUITexture;
   }
@@ -286,6 +1104,7 @@ namespace IrrlichtHelper
     pGUITexture->mSource.ImageID   = pImage;
     pGUITexture->mIsValid          = true;
     pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromImage(getIrrDevice()->getVideoDriver(), pImage);
+    mNumberOfTextureAllocations++;
 
     return pGUITexture;
   }
@@ -313,7 +1132,8 @@ namespace IrrlichtHelper
     pGUITexture->mSourceType       = ETST_GUIFONT;
     pGUITexture->mSource.GUIFontID = IrrlichtHelper::IMGUI_FONT_ID;
     pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver());
+    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver(), mImageBuffer);
+    mNumberOfTextureAllocations++;
 
     void * const pFontTexture = reinterpret_cast<void *>(pGUITexture);
     ImGui::GetIO().Fonts->TexID = pFontTexture;
@@ -349,7 +1169,8 @@ namespace IrrlichtHelper
       pRealTexture->mSourceType       = ETST_RAWDATA;
       pRealTexture->mSource.RawDataID = pPixelData;
       pRealTexture->mIsValid          = true;
-      pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height);
+      pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height, mImageBuffer);
+      mNumberOfTextureAllocations++;
     }
 
     return;
@@ -362,7 +1183,12 @@ namespace IrrlichtHelper
 
     FASSERT(pRealTexture->mIsValid);
 
-    if (pRealTexture->mIsUsingOwnMemory)
+    if (pRealTexture->mIsStreaming && (pRealTexture->mSourceType == ETST_IMAGE) && pRealTexture->mIsUsingOwnMemory)
+    {
+      // streaming textures keep their GPU texture, as long as the image size does not change
+      IsRecreationNecessary = (pRealTexture->mWidth != pImage->getDimension().Width) || (pRealTexture->mHeight != pImage->getDimension().Height);
+    }
+    else if (pRealTexture->mIsUsingOwnMemory)
     {
       IsRecreationNecessary = true;
     }
@@ -375,7 +1201,13 @@ namespace IrrlichtHelper
       IsRecreationNecessary = true;
     }
 
-    if (IsRecreationNecessary)
+    if (!IsRecreationNecessary && pRealTexture->mIsStreaming)
+    {
+      pRealTexture->mSource.ImageID = pImage;
+      IrrlichtHelper::copyImageIntoTexture(static_cast<irr::video::ITexture *>(pRealTexture->mGPUTextureID), pImage);
+      mNumberOfTextureUploads++;
+    }
+    else if (IsRecreationNecessary)
     {
       IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
 
@@ -384,6 +1216,7 @@ namespace IrrlichtHelper
       pRealTexture->mSource.ImageID   = pImage;
       pRealTexture->mIsValid          = true;
       pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromImage(getIrrDevice()->getVideoDriver(), pImage);
+      mNumberOfTextureAllocations++;
     }
 
     return;
@@ -423,6 +1256,20 @@ namespace IrrlichtHelper
     return;
   }
 
+  void CIrrlichtIMGUIDriver::updateTextureRegion(IGUITexture * const pGUITexture, EColorFormat const ColorFormat, irr::u8 const * const pPixelData, irr::u32 const Pitch, irr::u32 const X, irr::u32 const Y, irr::u32 const Width, irr::u32 const Height)
+  {
+    CGUITexture * const pRealTexture = dynamic_cast<CGUITexture * const>(pGUITexture);
+
+    FASSERT(pRealTexture->mIsValid);
+
+    // every GPU texture of this driver is an Irrlicht texture, thus it is updated in place with lock and unlock
+    irr::video::ITexture * const pTexture = static_cast<irr::video::ITexture *>(pRealTexture->mGPUTextureID);
+    IrrlichtHelper::copyRawDataIntoTexture(pTexture, ColorFormat, pPixelData, Pitch, X, Y, Width, Height);
+    mNumberOfTextureUploads++;
+
+    return;
+  }
+
   void CIrrlichtIMGUIDriver::updateFontTexture(IGUITexture * const pGUITexture)
   {
     CGUITexture * const pRealTexture = dynamic_cast<CGUITexture * const>(pGUITexture);
@@ -451,7 +1298,8 @@ namespace IrrlichtHelper
       pRealTexture->mSourceType       = ETST_GUIFONT;
       pRealTexture->mSource.GUIFontID = IrrlichtHelper::IMGUI_FONT_ID;
       pRealTexture->mIsValid          = true;
-      pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver());
+      pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver(), mImageBuffer);
+      mNumberOfTextureAllocations++;
 
       void * const pFontTexture = reinterpret_cast<void *>(pGUITexture);
       ImGui::GetIO().Fonts->TexID = pFontTexture;
@@ -478,70 +1326,27 @@ namespace IrrlichtHelper
 {
 
 
-  irr::video::SColor getColorFromImGuiColor(irr::u32 const ImGuiColor)
-  {
-    ImColor const Color(ImGuiColor);
-
-    irr::u8 const Red   = static_cast<irr::u8>(Color.Value.x * 255);
-    irr::u8 const Green = static_cast<irr::u8>(Color.Value.y * 255);
-    irr::u8 const Blue  = static_cast<irr::u8>(Color.Value.z * 255);
-    irr::u8 const Alpha = static_cast<irr::u8>(Color.Value.w * 255);
-
-    return irr::video::SColor(Alpha, Red, Green, Blue);
-  }
-
-  void copyImGuiVertices2IrrlichtVertices(ImVector<ImDrawVert> &rIMGUIVertexBuffer, irr::video::S3DVertex * const pIrrlichtVertex, irr::core::vector3df const &rOffset)
-  {
-    irr::u32 const NumberOfVertex = rIMGUIVertexBuffer.size();
-
-    for (irr::u32 i = 0; i < NumberOfVertex; i++)
-    {
-      ImDrawVert &rImGUIVertex = rIMGUIVertexBuffer[i];
-
-      pIrrlichtVertex[i].Pos     = irr::core::vector3df(static_cast<irr::f32>(rImGUIVertex.pos.x), static_cast<irr::f32>(rImGUIVertex.pos.y), 0.0) + rOffset;
-      pIrrlichtVertex[i].Normal  = irr::core::vector3df(0.0, 0.0, 1.0);
-      pIrrlichtVertex[i].Color   = getColorFromImGuiColor(rImGUIVertex.col);
-      pIrrlichtVertex[i].TCoords = irr::core::vector2df(static_cast<irr::f32>(rImGUIVertex.uv.x), static_cast<irr::f32>(rImGUIVertex.uv.y));
-    }
-  }
-
-  ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver * const pIrrDriver, EColorFormat const ColorFormat, irr::u8 * const pPixelData, irr::u32 const Width, irr::u32 const Height)
+  ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver * const pIrrDriver, EColorFormat const ColorFormat, irr::u8 * const pPixelData, irr::u32 const Width, irr::u32 const Height, CStagingBuffer<irr::u32> &rImageBuffer)
   {
 
     irr::u32 * pImageData = nullptr;
-    bool IsTempMemoryUsed = false;
 
     // decide if we need to translate the color or not
     switch (ColorFormat)
     {
       case ECF_A8R8G8B8:
-        pImageData       = reinterpret_cast<irr::u32 *>(pPixelData);
-        IsTempMemoryUsed = false;
+        pImageData = reinterpret_cast<irr::u32 *>(pPixelData);
         break;
 
       case ECF_R8G8B8A8:
-        pImageData       = reinterpret_cast<irr::u32 *>(pPixelData);
-        IsTempMemoryUsed = false;
-
-        for (irr::u32 X = 0; X < (Width * Height); X++)
-        {
-          irr::video::SColor Color = getColorFromImGuiColor(pImageData[X]);
-          Color.getData(&pImageData[X], irr::video::ECF_A8R8G8B8);
-        }
-
+        pImageData = reinterpret_cast<irr::u32 *>(pPixelData);
+        SIMD::convertColors(pImageData, pImageData, Width * Height);
         break;
 
       case ECF_A8:
-        pImageData       = new irr::u32[Width * Height];
-        IsTempMemoryUsed = true;
-
-        for (irr::u32 X = 0; X < (Width * Height); X++)
-        {
-          // set only Alpha
-          irr::video::SColor Color(pPixelData[X], 255, 255, 255);
-          Color.getData(&pImageData[X], irr::video::ECF_A8R8G8B8);
-        }
-
+        // the image object copies the pixels, thus the buffer is reused for the next texture
+        pImageData = rImageBuffer.getBuffer(Width * Height);
+        SIMD::expandAlpha(pPixelData, pImageData, Width * Height);
         break;
 
       default:
@@ -570,24 +1375,113 @@ namespace IrrlichtHelper
     // delete image object
     pImage->drop();
 
-    if (IsTempMemoryUsed)
+    LOG_NOTE("{IrrIMGUI-Irr} Create ITexture object from Raw Data. Handle: " << std::hex << TextureID << "\n");
+
+    return TextureID;
+  }
+
+  void copyRawDataIntoTexture(irr::video::ITexture * const pTexture, EColorFormat const ColorFormat, irr::u8 const * const pPixelData, irr::u32 const Pitch, irr::u32 const X, irr::u32 const Y, irr::u32 const Width, irr::u32 const Height)
+  {
+    irr::core::dimension2du const &rSize = pTexture->getSize();
+
+    if ((X > rSize.Width) || (Width > rSize.Width - X) || (Y > rSize.Height) || (Height > rSize.Height - Y))
     {
-      delete[] pImageData;
+      LOG_ERROR("{IrrIMGUI-Irr} The region is outside of the texture!\n");
+      return;
     }
 
-    LOG_NOTE("{IrrIMGUI-Irr} Create ITexture object from Raw Data. Handle: " << std::hex << TextureID << "\n");
+    irr::u8 * const pTextureData = static_cast<irr::u8 *>(pTexture->lock());
 
-    return TextureID;
+    if (pTextureData == nullptr)
+    {
+      LOG_WARNING("{IrrIMGUI-Irr} Cannot lock the texture for a region update.\n");
+      return;
+    }
+
+    irr::video::ECOLOR_FORMAT const TextureFormat = pTexture->getColorFormat();
+    irr::u32 const TexturePitch  = pTexture->getPitch();
+    irr::u32 const TextureBytes  = irr::video::IImage::getBitsPerPixelFromFormat(TextureFormat) / 8;
+    bool const     IsCopyEnabled = (ColorFormat == ECF_A8R8G8B8) && (TextureFormat == irr::video::ECF_A8R8G8B8);
+
+    for (irr::u32 Row = 0; Row < Height; Row++)
+    {
+      irr::u8 const * const pSourceRow      = pPixelData + (Row * Pitch);
+      irr::u8       * const pDestinationRow = pTextureData + ((Y + Row) * TexturePitch) + (X * TextureBytes);
+
+      if (IsCopyEnabled)
+      {
+        std::memcpy(pDestinationRow, pSourceRow, Width * 4);
+        continue;
+      }
+
+      for (irr::u32 Column = 0; Column < Width; Column++)
+      {
+        irr::video::SColor Color;
+
+        switch (ColorFormat)
+        {
+          case ECF_A8R8G8B8:
+            Color.setData(pSourceRow + (Column * 4), irr::video::ECF_A8R8G8B8);
+            break;
+
+          case ECF_R8G8B8A8:
+          {
+            irr::u8 const * const pSourcePixel = pSourceRow + (Column * 4);
+            Color = irr::video::SColor(pSourcePixel[3], pSourcePixel[0], pSourcePixel[1], pSourcePixel[2]);
+            break;
+          }
+
+          case ECF_A8:
+            // set only Alpha
+            Color = irr::video::SColor(pSourceRow[Column], 255, 255, 255);
+            break;
+
+          default:
+            LOG_ERROR("Unknown ColorFormat "<<ColorFormat<<"!\n");
+            FASSERT(false);
+            break;
+        }
+
+        Color.getData(pDestinationRow + (Column * TextureBytes), TextureFormat);
+      }
+    }
+
+    // the texture is uploaded again by Irrlicht, but its image does not need to be recreated
+    pTexture->unlock();
+
+    LOG_NOTE("{IrrIMGUI-Irr} Update region " << Width << "x" << Height << " of ITexture object. Handle: " << std::hex << pTexture << "\n");
+
+    return;
   }
 
-  ImTextureID copyTextureIDFromGUIFont(irr::video::IVideoDriver * const pIrrDriver)
+  void copyImageIntoTexture(irr::video::ITexture * const pTexture, irr::video::IImage * const pImage)
+  {
+    // the whole texture is overwritten, thus it does not need to be read back from the GPU
+    void * const pTextureData = pTexture->lock(irr::video::ETLM_WRITE_ONLY);
+
+    if (pTextureData == nullptr)
+    {
+      LOG_WARNING("{IrrIMGUI-Irr} Cannot lock the streaming texture.\n");
+      return;
+    }
+
+    // the texture size can differ from the image size, when the driver does not support non power of two textures
+    irr::core::dimension2d<irr::u32> const &rSize = pTexture->getSize();
+    pImage->copyToScaling(pTextureData, rSize.Width, rSize.Height, pTexture->getColorFormat(), pTexture->getPitch());
+
+    pTexture->unlock();
+
+    return;
+  }
+
+  ImTextureID copyTextureIDFromGUIFont(irr::video::IVideoDriver * const pIrrDriver, CStagingBuffer<irr::u32> &rImageBuffer)
   {
     // Get Font Texture from IMGUI system.
     irr::u8 * pPixelData;
     int Width, Height;
     ImGui::GetIO().Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
 
-    ImTextureID const FontTexture = copyTextureIDFromRawData(pIrrDriver, ECF_A8, pPixelData, Width, Height);
+    ImTextureID const FontTexture = copyTextureIDFromRawData(pIrrDriver, ECF_A8, pPixelData, Width, Height, rImageBuffer);
 
     // delete temporary texture memory in IMGUI
     ImGui::GetIO().Fonts->ClearTexData();
@@ -645,7 +1539,7 @@ namespace IrrlichtHelper
     //       prepared for 2D and the clipping plane error disappears.
 
     irr::u32 const NumberOfVertex = 3;
-    irr::video::S3DVertex * const pDummyVertices = new irr::video::S3DVertex[NumberOfVertex];
+    irr::video::S3DVertex pDummyVertices[NumberOfVertex];
     pDummyVertices[0].Pos    = irr::core::vector3df(-20.0f,-20.0f, 0.0f);
     pDummyVertices[0].Normal = irr::core::vector3df( 0.0f,  0.0f, 1.0f);
     pDummyVertices[0].Color  = irr::video::SColor(0, 255, 0, 0);
@@ -684,8 +1578,6 @@ namespace IrrlichtHelper
     pIrrDriver->getMaterial2D().MaterialType      = MaterialType;
     pIrrDriver->getMaterial2D().MaterialTypeParam = MaterialParam;
 
-    delete[] pDummyVertices;
-
     return;
   }
 
@@ -693,7 +1585,8 @@ namespace IrrlichtHelper
   {
     rMaterial.setTexture(0, pTexture);
     rMaterial.MaterialType = irr::video::EMT_ONETEXTURE_BLEND;
-    rMaterial.MaterialTypeParam = irr::video::pack_textureBlendFunc(irr::video::EBF_SRC_ALPHA, irr::video::EBF_ONE_MINUS_SRC_ALPHA, irr::video::EMFN_MODULATE_1X, irr::video::EAS_VERTEX_COLOR | irr::video::EAS_TEXTURE);
+    setupBlendMode(rMaterial, EBM_STANDARD);
+    rMaterial.setFlag(irr::video::EMF_LIGHTING,           false);
     rMaterial.setFlag(irr::video::EMF_ANTI_ALIASING,      true);
     rMaterial.setFlag(irr::video::EMF_BILINEAR_FILTER,    false);
     rMaterial.setFlag(irr::video::EMF_ZBUFFER,            false);
@@ -707,7 +1600,37 @@ namespace IrrlichtHelper
     return;
   }
 
-  void applyClippingRect(irr::video::IVideoDriver * const pIrrDriver, ImVec4 &rClippingRect)
+  void setupBlendMode(irr::video::SMaterial &rMaterial, EBlendMode const BlendMode)
+  {
+    irr::video::E_BLEND_FACTOR SourceFactor = irr::video::EBF_SRC_ALPHA;
+    irr::u8                    ColorMask    = irr::video::ECP_ALL;
+
+    switch (BlendMode)
+    {
+      case EBM_ACCUMULATE_ALPHA:
+        SourceFactor = irr::video::EBF_ONE;
+        ColorMask    = irr::video::ECP_ALPHA;
+        break;
+
+      case EBM_PREMULTIPLIED_ALPHA:
+        SourceFactor = irr::video::EBF_ONE;
+        break;
+
+      case EBM_COLOR_ONLY:
+        ColorMask = irr::video::ECP_RGB;
+        break;
+
+      default:
+        break;
+    }
+
+    rMaterial.MaterialTypeParam = irr::video::pack_textureBlendFunc(SourceFactor, irr::video::EBF_ONE_MINUS_SRC_ALPHA, irr::video::EMFN_MODULATE_1X, irr::video::EAS_VERTEX_COLOR | irr::video::EAS_TEXTURE);
+    rMaterial.ColorMask         = ColorMask;
+
+    return;
+  }
+
+  void applyClippingRect(irr::video::IVideoDriver * const pIrrDriver, ImVec4 const &rClippingRect)
   {
     irr::core::plane3df LeftPlane   (irr::core::vector3df(rClippingRect.x, 0.0f, 0.0f), irr::core::vector3df( 1.0f,  0.0f, 0.0f));
     irr::core::plane3df RightPlane  (irr::core::vector3df(rClippingRect.z, 0.0f, 0.0f), irr::core::vector3df(-1.0f,  0.0f, 0.0f));
@@ -730,6 +1653,89 @@ namespace IrrlichtHelper
 
     return;
   }
+
+  void applyClippingViewPort(irr::video::IVideoDriver * const pIrrDriver, irr::core::rect<irr::s32> const &rViewPort)
+  {
+    pIrrDriver->setViewPort(rViewPort);
+
+    // the orthogonal projection maps the clipping rectangle to the whole viewport
+    irr::f32 const Width  = static_cast<irr::f32>(rViewPort.getWidth());
+    irr::f32 const Height = static_cast<irr::f32>(rViewPort.getHeight());
+    irr::f32 const Left   = static_cast<irr::f32>(rViewPort.UpperLeftCorner.X);
+    irr::f32 const Top    = static_cast<irr::f32>(rViewPort.UpperLeftCorner.Y);
+
+    irr::core::matrix4 Projection;
+    Projection.buildProjectionMatrixOrthoLH(Width, -Height, -1.0f, 1.0f);
+    Projection.setTranslation(irr::core::vector3df(-1.0f - (2.0f * Left / Width), 1.0f + (2.0f * Top / Height), 0.0f));
+
+    pIrrDriver->setTransform(irr::video::ETS_PROJECTION, Projection);
+
+    return;
+  }
+
+  void applyClippingScissor(irr::core::rect<irr::s32> const &rScissor, irr::u32 const RenderTargetHeight)
+  {
+    // the origin of OpenGL window coordinates is the lower left corner
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(rScissor.UpperLeftCorner.X, static_cast<GLint>(RenderTargetHeight) - rScissor.LowerRightCorner.Y, rScissor.getWidth(), rScissor.getHeight());
+
+    return;
+  }
+
+  irr::core::matrix4 getGUIProjection(irr::video::IVideoDriver * const pIrrDriver)
+  {
+    // the same orthogonal projection like Irrlicht uses for the 2D mode: (0,0) is the upper left corner of the render target
+    irr::core::dimension2d<irr::u32> const &rRenderTargetSize = pIrrDriver->getCurrentRenderTargetSize();
+    irr::core::matrix4 Projection;
+    Projection.buildProjectionMatrixOrthoLH(static_cast<irr::f32>(rRenderTargetSize.Width), -static_cast<irr::f32>(rRenderTargetSize.Height), -1.0f, 1.0f);
+    Projection.setTranslation(irr::core::vector3df(-1.0f, 1.0f, 0.0f));
+
+    return Projection;
+  }
+
+  CTransformationState::CTransformationState(irr::video::IVideoDriver * const pIrrDriver, bool const IsEnabled, irr::core::vector3df const &rOffset):
+    mpIrrDriver(pIrrDriver),
+    mIsEnabled(IsEnabled)
+  {
+    if (mIsEnabled)
+    {
+      mOldProjection = mpIrrDriver->getTransform(irr::video::ETS_PROJECTION);
+      mOldView       = mpIrrDriver->getTransform(irr::video::ETS_VIEW);
+      mOldWorld      = mpIrrDriver->getTransform(irr::video::ETS_WORLD);
+
+      // the vertex offset compensates the translation of the Irrlicht 2D mode, which is not applied here
+      irr::core::matrix4 World;
+      World.setTranslation(-rOffset);
+
+      mpIrrDriver->setTransform(irr::video::ETS_PROJECTION, getGUIProjection(mpIrrDriver));
+      mpIrrDriver->setTransform(irr::video::ETS_VIEW,       irr::core::IdentityMatrix);
+      mpIrrDriver->setTransform(irr::video::ETS_WORLD,      World);
+    }
+
+    return;
+  }
+
+  CTransformationState::~CTransformationState(void)
+  {
+    if (mIsEnabled)
+    {
+      mpIrrDriver->setTransform(irr::video::ETS_PROJECTION, mOldProjection);
+      mpIrrDriver->setTransform(irr::video::ETS_VIEW,       mOldView);
+      mpIrrDriver->setTransform(irr::video::ETS_WORLD,      mOldWorld);
+    }
+
+    return;
+  }
+
+  bool canDrawCommandsBeMerged(ImDrawCmd const &rCommand, ImDrawCmd const &rNextCommand)
+  {
+    return (rNextCommand.UserCallback == NULL)                &&
+           (rNextCommand.TextureId    == rCommand.TextureId)  &&
+           (rNextCommand.ClipRect.x   == rCommand.ClipRect.x) &&
+           (rNextCommand.ClipRect.y   == rCommand.ClipRect.y) &&
+           (rNextCommand.ClipRect.z   == rCommand.ClipRect.z) &&
+           (rNextCommand.ClipRect.w   == rCommand.ClipRect.w);
+  }
 }
 }
 }
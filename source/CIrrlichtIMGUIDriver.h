@@ -40,11 +40,18 @@
  * @{
  */
 
+// library includes
+#include <vector>
+
 // module includes
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #include <IrrIMGUI/IrrIMGUI.h>
 #include "IIMGUIDriver.h"
+#include "private/CCommandListCache.h"
 #include "private/CGUITexture.h"
+#include "private/CStagingBuffer.h"
+#include "private/CTriangleClipper.h"
+#include "private/CVertexConverter.h"
 
 namespace IrrIMGUI
 {
@@ -60,6 +67,9 @@ namespace Driver
   {
     friend class IrrIMGUI::Private::IIMGUIDriver;
     public:
+      /// @return Returns true, while a clipping rectangle is applied. User callbacks are called without clipping.
+      static bool isClippingEnabled(void);
+
     private:
       /// @{
       /// @name Constructor and Destructor
@@ -90,7 +100,98 @@ namespace Driver
 
       /// @brief Renders a single command list.
       /// @param pCommandList is the list of commands to render.
-      static void drawCommandList(ImDrawList * pCommandList);
+      /// @param pVertexArray is a pointer to the converted vertices of the command list.
+      static void drawCommandList(ImDrawList * pCommandList, irr::video::S3DVertex * pVertexArray);
+
+      /// @brief Draws the commands of a command list or of a merged frame.
+      /// @param pCommandList     Is the command list, that is passed to user callbacks (nullptr for a merged frame without callbacks).
+      /// @param pCommands        Is a pointer to the first draw command.
+      /// @param NumberOfCommands Is the number of draw commands.
+      /// @param pVertexArray     Is a pointer to the converted vertices.
+      /// @param NumberOfVertices Is the number of vertices.
+      /// @param pIndices         Is a pointer to the indices of all draw commands.
+      /// @tparam TIndex Is the type of the indices (16 bit or 32 bit).
+      template <typename TIndex>
+      static void drawCommands(ImDrawList * pCommandList, ImDrawCmd const * pCommands, irr::u32 NumberOfCommands, irr::video::S3DVertex * pVertexArray, irr::u32 NumberOfVertices, TIndex const * pIndices);
+
+      /// @brief Concatenates the vertices, indices and draw commands of all command lists into a single stream and draws it.
+      /// @param pDrawData is the draw data with all command lists. The vertices must have been converted already.
+      static void drawMergedFrame(ImDrawData * pDrawData);
+
+      /// @param pDrawData is the draw data with all command lists.
+      /// @return Returns true, when the command lists can be drawn as a single stream.
+      static bool canFrameBeMerged(ImDrawData const * pDrawData);
+
+      /// @brief Converts the vertices of all command lists to Irrlicht vertices, when they are not found in the command list cache.
+      ///        The pointers to the converted vertices are stored in mVertexArrays.
+      /// @param pDrawData is the draw data with all command lists.
+      static void convertCommandLists(ImDrawData * pDrawData);
+
+      /// @brief Converts the vertices of a frame of the render pipeline (called by the worker thread of the pipeline).
+      /// @param rFrame Is the frame to prepare.
+      static void preparePipelineFrame(CDrawDataPipeline::SFrame &rFrame);
+
+      /// @brief Draws the triangles of one or more draw commands with a single draw call.
+      /// @details When the vertices cannot be addressed with 16 bit indices, the triangles are split into several draw calls.
+      /// @param rDrawCommand     Is the draw command that defines the texture and the clipping rectangle.
+      /// @param pVertexArray     Is a pointer to the converted vertices of the command list.
+      /// @param pIndices         Is a pointer to the first index of the draw command.
+      /// @param NumberOfElements Is the number of indices to draw.
+      /// @tparam TIndex Is the type of the indices (16 bit or 32 bit).
+      template <typename TIndex>
+      static void drawElements(ImDrawCmd const &rDrawCommand, irr::video::S3DVertex * pVertexArray, TIndex const * pIndices, irr::u32 NumberOfElements);
+
+      /// @brief Draws draw commands with triangles, that are clipped on the CPU (clipping mode ECM_CPU).
+      /// @details Adjacent draw commands with the same texture are drawn with a single draw call, even when their clipping rectangles differ.
+      /// @param pCommandList     Is the command list, that is passed to user callbacks.
+      /// @param pCommands        Is a pointer to the first draw command.
+      /// @param NumberOfCommands Is the number of draw commands.
+      /// @param pVertexArray     Is a pointer to the converted vertices.
+      /// @param NumberOfVertices Is the number of vertices.
+      /// @param pIndices         Is a pointer to the indices of all draw commands.
+      /// @tparam TIndex Is the type of the indices (16 bit or 32 bit).
+      template <typename TIndex>
+      static void drawClippedCommands(ImDrawList * pCommandList, ImDrawCmd const * pCommands, irr::u32 NumberOfCommands, irr::video::S3DVertex * pVertexArray, irr::u32 NumberOfVertices, TIndex const * pIndices);
+
+      /// @brief Draws the batch of the triangle clipper and starts a new batch.
+      /// @param rDrawCommand Is the draw command that defines the texture of the batch.
+      static void drawClippedBatch(ImDrawCmd const &rDrawCommand);
+
+      /// @brief Applies the texture of a draw command to the material of the Irrlicht driver, when it has changed.
+      /// @param rDrawCommand Is the draw command that defines the texture.
+      static void applyTexture(ImDrawCmd const &rDrawCommand);
+
+      /// @brief Draws triangles with the current material and the draw method of the current frame.
+      /// @param pVertices        Is a pointer to the first vertex used by the draw call.
+      /// @param NumberOfVertex   Is the number of vertices.
+      /// @param pIndices         Is a pointer to the first index (relative to pVertices).
+      /// @param NumberOfElements Is the number of indices to draw.
+      static void drawVertices(irr::video::S3DVertex const * pVertices, irr::u32 NumberOfVertex, irr::u16 const * pIndices, irr::u32 NumberOfElements);
+
+      /// @brief Applies a clipping rectangle with the clipping mode of the current frame.
+      /// @param rClippingRect Is the IMGUI clipping rectangle.
+      /// @return Returns false, when nothing inside the clipping rectangle is visible.
+      static bool applyClippingRect(ImVec4 const &rClippingRect);
+
+      /// @brief Disables the clipping and restores the viewport of the render target.
+      static void disableClipping(void);
+
+      /// @brief Forces the next draw command to apply its clipping rectangle again (e.g. after a user callback).
+      static void invalidateClippingRect(void);
+
+      /// @brief Copies vertices and indices into a stream mesh buffer and draws it.
+      /// @param pVertices        Is a pointer to the first vertex used by the draw call.
+      /// @param NumberOfVertex   Is the number of vertices.
+      /// @param pIndices         Is a pointer to the first index (relative to pVertices).
+      /// @param NumberOfElements Is the number of indices to draw.
+      static void drawMeshBuffer(irr::video::S3DVertex const * pVertices, irr::u32 NumberOfVertex, irr::u16 const * pIndices, irr::u32 NumberOfElements);
+
+      /// @return Returns a mesh buffer, that has not been used in this frame. If necessary, a new one is created.
+      static irr::scene::SMeshBuffer * getNextMeshBuffer(void);
+
+      /// @brief Removes mesh buffers from the pool and from the graphic memory.
+      /// @param NumberOfKeptBuffers Is the number of mesh buffers at the begin of the pool, that are not removed.
+      static void releaseMeshBuffers(irr::u32 NumberOfKeptBuffers);
 
       /// @}
 
@@ -137,6 +238,17 @@ namespace Driver
       /// @param pTexture    Is a pointer to an Irrlicht image object.
       virtual void updateTexture(IGUITexture * pGUITexture, irr::video::ITexture * pTexture);
 
+      /// @brief Writes raw data into a rectangle of a GUI texture without recreating the texture.
+      /// @param pGUITexture Is a pointer to the GUI texture object.
+      /// @param ColorFormat Is the format of the Color of every Pixel.
+      /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+      /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+      /// @param X           Is the left border of the rectangle inside the texture.
+      /// @param Y           Is the upper border of the rectangle inside the texture.
+      /// @param Width       Is the number of Pixels in X direction.
+      /// @param Height      Is the number of Pixels in Y direction.
+      virtual void updateTextureRegion(IGUITexture * pGUITexture, EColorFormat ColorFormat, irr::u8 const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height);
+
       /// @brief Updates a GUI texture with the currently loaded fonts.
       /// @param pGUITexture Is a pointer to the GUI texture object.
       virtual void updateFontTexture(IGUITexture * pGUITexture);
@@ -152,6 +264,82 @@ namespace Driver
       /// @brief An pixel offset that is applied to every vertex.
       static irr::core::vector3df mOffset;
 
+      /// @brief A buffer for the converted vertices of all command lists, that are not stored in the command list cache.
+      static CStagingBuffer<irr::video::S3DVertex> mVertexBuffer;
+
+      /// @brief Converts the vertices of all command lists of a frame (optionally in parallel).
+      static CVertexConverter mVertexConverter;
+
+      /// @brief The converted vertices of every command list of the current frame.
+      static std::vector<irr::video::S3DVertex *> mVertexArrays;
+
+      /// @brief A buffer for indices that are rebased to the first vertex used by a draw call.
+      static CStagingBuffer<irr::u16> mIndexBuffer;
+
+      /// @brief A buffer for the restored indices of command lists, which 16 bit indices have overflown.
+      static CStagingBuffer<irr::u32> mUnwrappedIndexBuffer;
+
+      /// @brief A buffer for the expanded pixels of alpha textures, that is reused for every new texture.
+      static CStagingBuffer<irr::u32> mImageBuffer;
+
+      /// @brief Clips the triangles of the draw commands in the clipping mode ECM_CPU.
+      static CTriangleClipper mTriangleClipper;
+
+      /// @brief A buffer for the vertices of all command lists of a merged frame.
+      static CStagingBuffer<irr::video::S3DVertex> mFrameVertexBuffer;
+
+      /// @brief A buffer for the indices of all command lists of a merged frame, which are rebased to the first vertex of the frame.
+      static CStagingBuffer<irr::u32> mFrameIndexBuffer;
+
+      /// @brief The draw commands of all command lists of a merged frame.
+      static std::vector<ImDrawCmd> mFrameCommands;
+
+      /// @brief Keeps the converted vertices of command lists, that have not changed since the frame before.
+      static CCommandListCache mCommandListCache;
+
+      /// @brief Counts the rendered frames until the staging buffers are shrunk.
+      static irr::u32 mFramesSinceShrink;
+
+      /// @brief The material for all draw commands. Only the texture differs between the commands.
+      static irr::video::SMaterial mMaterial;
+
+      /// @brief The texture of the material that has been applied to the Irrlicht driver at last.
+      static irr::video::ITexture * mpLastTexture;
+
+      /// @brief Is false, when the material of the Irrlicht driver is unknown and must be applied again.
+      static bool mIsMaterialApplied;
+
+      /// @brief The blend mode, that is set up in the material.
+      static EBlendMode mMaterialBlendMode;
+
+      /// @brief Is true, when the GUI is drawn with mesh buffers in the current frame.
+      static bool mIsMeshBufferUsed;
+
+      /// @brief Is true, when the GUI is drawn in 3D mode with its own transformations in the current frame.
+      static bool mIsTransformationUsed;
+
+      /// @brief The clipping mode, that is used in the current frame.
+      static EClippingMode mClippingMode;
+
+      /// @brief The clipping rectangle, that has been applied at last.
+      static ImVec4 mClippingRect;
+
+      /// @brief Is true, when a clipping rectangle is applied.
+      static bool mIsClippingEnabled;
+
+      /// @brief Is false, when the clipping state of the render driver is unknown and mClippingRect must be applied again.
+      static bool mIsClippingRectApplied;
+
+      /// @brief The viewport of the render target before the GUI has been drawn.
+      static irr::core::rect<irr::s32> mOldViewPort;
+
+      /// @brief The pool of mesh buffers for the stream mode. Every draw call of a frame uses its own mesh buffer,
+      ///        thus the render driver never needs to overwrite a hardware buffer that is still in use.
+      static std::vector<irr::scene::SMeshBuffer *> mMeshBuffers;
+
+      /// @brief The number of mesh buffers from the pool, that have been used in the current frame.
+      static irr::u32 mNumberOfUsedMeshBuffers;
+
   };
 
 }
@@ -0,0 +1,816 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file       COpenGL3IMGUIDriver.cpp
+ * @author     Andre Netzeband
+ * @brief      Contains a driver that uses an OpenGL 3.3 shader pipeline to render the GUI.
+ * @attention  This driver is a test- and fallback implementation like the native OpenGL driver. It is not officially supported by the Irrlicht IMGUI binding.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+
+// library includes
+#include <cstddef>
+#include <vector>
+
+// module includes
+#include "COpenGL3IMGUIDriver.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/CGUITexture.h"
+#include "private/IrrIMGUIOpenGL_priv.h"
+
+// OpenGL 2.0 - 3.3 definitions, which are missing in the OpenGL 1.1 headers of some platforms
+#ifndef GL_FUNC_ADD
+#define GL_FUNC_ADD               0x8006
+#endif // GL_FUNC_ADD
+#ifndef GL_BLEND_EQUATION_RGB
+#define GL_BLEND_EQUATION_RGB     0x8009
+#endif // GL_BLEND_EQUATION_RGB
+#ifndef GL_BLEND_DST_RGB
+#define GL_BLEND_DST_RGB          0x80C8
+#endif // GL_BLEND_DST_RGB
+#ifndef GL_BLEND_SRC_RGB
+#define GL_BLEND_SRC_RGB          0x80C9
+#endif // GL_BLEND_SRC_RGB
+#ifndef GL_BLEND_DST_ALPHA
+#define GL_BLEND_DST_ALPHA        0x80CA
+#endif // GL_BLEND_DST_ALPHA
+#ifndef GL_BLEND_SRC_ALPHA
+#define GL_BLEND_SRC_ALPHA        0x80CB
+#endif // GL_BLEND_SRC_ALPHA
+#ifndef GL_TEXTURE0
+#define GL_TEXTURE0               0x84C0
+#endif // GL_TEXTURE0
+#ifndef GL_ACTIVE_TEXTURE
+#define GL_ACTIVE_TEXTURE         0x84E0
+#endif // GL_ACTIVE_TEXTURE
+#ifndef GL_VERTEX_ARRAY_BINDING
+#define GL_VERTEX_ARRAY_BINDING   0x85B5
+#endif // GL_VERTEX_ARRAY_BINDING
+#ifndef GL_BLEND_EQUATION_ALPHA
+#define GL_BLEND_EQUATION_ALPHA   0x883D
+#endif // GL_BLEND_EQUATION_ALPHA
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER        0x8B30
+#endif // GL_FRAGMENT_SHADER
+#ifndef GL_VERTEX_SHADER
+#define GL_VERTEX_SHADER          0x8B31
+#endif // GL_VERTEX_SHADER
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS         0x8B81
+#endif // GL_COMPILE_STATUS
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS            0x8B82
+#endif // GL_LINK_STATUS
+#ifndef GL_INFO_LOG_LENGTH
+#define GL_INFO_LOG_LENGTH        0x8B84
+#endif // GL_INFO_LOG_LENGTH
+#ifndef GL_CURRENT_PROGRAM
+#define GL_CURRENT_PROGRAM        0x8B8D
+#endif // GL_CURRENT_PROGRAM
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace Driver
+{
+
+  /// @brief Helper functions for the OpenGL 3.3 driver
+  namespace OpenGL3Helper
+  {
+    /// @{
+    /// @name OpenGL 2.0 - 3.3 functions
+
+    typedef GLuint (APIENTRY * TCreateShaderFunction)(GLenum Type);
+    typedef void   (APIENTRY * TShaderSourceFunction)(GLuint Shader, GLsizei Count, char const * const * ppStrings, GLint const * pLengths);
+    typedef void   (APIENTRY * TCompileShaderFunction)(GLuint Shader);
+    typedef void   (APIENTRY * TGetShaderivFunction)(GLuint Shader, GLenum Name, GLint * pParameter);
+    typedef void   (APIENTRY * TGetShaderInfoLogFunction)(GLuint Shader, GLsizei BufferSize, GLsizei * pLength, char * pInfoLog);
+    typedef void   (APIENTRY * TDeleteShaderFunction)(GLuint Shader);
+    typedef GLuint (APIENTRY * TCreateProgramFunction)(void);
+    typedef void   (APIENTRY * TAttachShaderFunction)(GLuint Program, GLuint Shader);
+    typedef void   (APIENTRY * TLinkProgramFunction)(GLuint Program);
+    typedef void   (APIENTRY * TGetProgramivFunction)(GLuint Program, GLenum Name, GLint * pParameter);
+    typedef void   (APIENTRY * TGetProgramInfoLogFunction)(GLuint Program, GLsizei BufferSize, GLsizei * pLength, char * pInfoLog);
+    typedef void   (APIENTRY * TDeleteProgramFunction)(GLuint Program);
+    typedef void   (APIENTRY * TUseProgramFunction)(GLuint Program);
+    typedef GLint  (APIENTRY * TGetUniformLocationFunction)(GLuint Program, char const * pName);
+    typedef void   (APIENTRY * TUniform1iFunction)(GLint Location, GLint Value);
+    typedef void   (APIENTRY * TUniformMatrix4fvFunction)(GLint Location, GLsizei Count, GLboolean Transpose, GLfloat const * pValue);
+    typedef void   (APIENTRY * TGenVertexArraysFunction)(GLsizei Number, GLuint * pArrays);
+    typedef void   (APIENTRY * TDeleteVertexArraysFunction)(GLsizei Number, GLuint const * pArrays);
+    typedef void   (APIENTRY * TBindVertexArrayFunction)(GLuint Array);
+    typedef void   (APIENTRY * TEnableVertexAttribArrayFunction)(GLuint Index);
+    typedef void   (APIENTRY * TVertexAttribPointerFunction)(GLuint Index, GLint Size, GLenum Type, GLboolean Normalized, GLsizei Stride, void const * pPointer);
+    typedef void   (APIENTRY * TDrawElementsBaseVertexFunction)(GLenum Mode, GLsizei Count, GLenum Type, void const * pIndices, GLint BaseVertex);
+    typedef void   (APIENTRY * TBlendEquationSeparateFunction)(GLenum ModeRGB, GLenum ModeAlpha);
+    typedef void   (APIENTRY * TBlendFuncSeparateFunction)(GLenum SourceRGB, GLenum DestinationRGB, GLenum SourceAlpha, GLenum DestinationAlpha);
+    typedef void   (APIENTRY * TActiveTextureFunction)(GLenum Texture);
+
+    /// @}
+
+    /// @brief The attribute locations of the vertex shader.
+    enum EAttributeLocation
+    {
+      EAL_POSITION = 0,
+      EAL_UV       = 1,
+      EAL_COLOR    = 2
+    };
+
+    /// @brief The vertex shader transforms the GUI coordinates into clip space.
+    char const * const VertexShaderSource =
+      "#version 330\n"
+      "uniform mat4 ProjectionMatrix;\n"
+      "layout(location = 0) in vec2 Position;\n"
+      "layout(location = 1) in vec2 UV;\n"
+      "layout(location = 2) in vec4 Color;\n"
+      "out vec2 FragmentUV;\n"
+      "out vec4 FragmentColor;\n"
+      "void main()\n"
+      "{\n"
+      "  FragmentUV    = UV;\n"
+      "  FragmentColor = Color;\n"
+      "  gl_Position   = ProjectionMatrix * vec4(Position, 0.0, 1.0);\n"
+      "}\n";
+
+    /// @brief The fragment shader modulates the vertex color with the texture. Single channel textures return (1, 1, 1, red) by their swizzle mask.
+    char const * const FragmentShaderSource =
+      "#version 330\n"
+      "uniform sampler2D Texture;\n"
+      "in vec2 FragmentUV;\n"
+      "in vec4 FragmentColor;\n"
+      "out vec4 OutputColor;\n"
+      "void main()\n"
+      "{\n"
+      "  OutputColor = FragmentColor * texture(Texture, FragmentUV);\n"
+      "}\n";
+
+    /// @brief The fragment shader, that is compiled by CShaderPipeline::createPipeline() (see COpenGL3IMGUIDriver::setFragmentShaderSource(...)).
+    char const * pCurrentFragmentShaderSource = FragmentShaderSource;
+
+    /// @brief Restores an OpenGL Bit
+    /// @param WhichBit is the bit to restore.
+    /// @param Value must be true or false, whether it was set or cleared.
+    void restoreGLBit(GLenum const WhichBit, bool const Value);
+
+    /// @brief Contains the shader program and the vertex array object of the driver and stores the OpenGL state, that is changed by the GUI.
+    class CShaderPipeline
+    {
+      public:
+        /// @brief Loads the OpenGL 3.3 functions and creates the shader program and the vertex array object.
+        /// @return Returns a new pipeline or nullptr, when a function is missing or the shader program cannot be created.
+        static CShaderPipeline * createPipeline(void);
+
+        /// @brief The Destructor deletes the shader program and the vertex array object.
+        ~CShaderPipeline(void);
+
+        /// @brief Stores the current OpenGL state and setups the state of the GUI.
+        ///        The vertex array object is bound afterwards, thus the index buffer binding is stored inside of it.
+        /// @param DisplayWidth          Is the width of the GUI display.
+        /// @param DisplayHeight         Is the height of the GUI display.
+        /// @param BlendMode             Is the blend mode of the GUI.
+        /// @param IsHostStatePersistent Is true, when the state stored in the frame before is reused instead of reading it again.
+        void begin(float DisplayWidth, float DisplayHeight, EBlendMode BlendMode, bool IsHostStatePersistent);
+
+        /// @brief Sets the vertex attributes to the IMGUI vertices inside the currently bound vertex buffer.
+        void setVertexFormat(void);
+
+        /// @brief Draws triangles from the currently bound buffers.
+        /// @param NumberOfIndices Is the number of indices to draw.
+        /// @param IndexType       Is GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+        /// @param IndexOffset     Is the byte offset of the first index inside the index buffer.
+        /// @param BaseVertex      Is the number of the vertex inside the vertex buffer, that is addressed by the index 0.
+        void drawElements(GLsizei NumberOfIndices, GLenum IndexType, size_t IndexOffset, GLint BaseVertex);
+
+        /// @brief Restores the OpenGL state, that has been stored by begin(...).
+        void end(void);
+
+        /// @brief Forgets the stored OpenGL state, thus it is read again by the next begin(...).
+        void invalidateHostState(void);
+
+        /// @return Returns the number of state values, that have been read from OpenGL by the last begin(...).
+        irr::u32 getNumberOfQueries(void) const;
+
+      private:
+        /// @brief The Constructor is private, use createPipeline(...) instead.
+        CShaderPipeline(void);
+
+        /// @return Returns true, when all OpenGL functions have been loaded.
+        bool loadFunctions(void);
+
+        /// @brief Compiles a shader.
+        /// @param Type    Is GL_VERTEX_SHADER or GL_FRAGMENT_SHADER.
+        /// @param pSource Is the source code.
+        /// @return Returns the shader or 0, when it cannot be compiled.
+        GLuint compileShader(GLenum Type, char const * pSource);
+
+        /// @return Returns true, when the shader program has been compiled and linked.
+        bool createProgram(void);
+
+        TCreateShaderFunction            mpCreateShader;
+        TShaderSourceFunction            mpShaderSource;
+        TCompileShaderFunction           mpCompileShader;
+        TGetShaderivFunction             mpGetShaderiv;
+        TGetShaderInfoLogFunction        mpGetShaderInfoLog;
+        TDeleteShaderFunction            mpDeleteShader;
+        TCreateProgramFunction           mpCreateProgram;
+        TAttachShaderFunction            mpAttachShader;
+        TLinkProgramFunction             mpLinkProgram;
+        TGetProgramivFunction            mpGetProgramiv;
+        TGetProgramInfoLogFunction       mpGetProgramInfoLog;
+        TDeleteProgramFunction           mpDeleteProgram;
+        TUseProgramFunction              mpUseProgram;
+        TGetUniformLocationFunction      mpGetUniformLocation;
+        TUniform1iFunction               mpUniform1i;
+        TUniformMatrix4fvFunction        mpUniformMatrix4fv;
+        TGenVertexArraysFunction         mpGenVertexArrays;
+        TDeleteVertexArraysFunction      mpDeleteVertexArrays;
+        TBindVertexArrayFunction         mpBindVertexArray;
+        TEnableVertexAttribArrayFunction mpEnableVertexAttribArray;
+        TVertexAttribPointerFunction     mpVertexAttribPointer;
+        TDrawElementsBaseVertexFunction  mpDrawElementsBaseVertex;
+        TBlendEquationSeparateFunction   mpBlendEquationSeparate;
+        TBlendFuncSeparateFunction       mpBlendFuncSeparate;
+        TActiveTextureFunction           mpActiveTexture;
+
+        GLuint mProgram;
+        GLuint mVertexArray;
+        GLint  mProjectionMatrixLocation;
+        GLint  mTextureLocation;
+
+        GLint     mOldProgram;
+        GLint     mOldVertexArray;
+        GLint     mOldActiveTexture;
+        GLint     mOldTexture;
+        GLint     mOldBlendSourceRGB;
+        GLint     mOldBlendDestinationRGB;
+        GLint     mOldBlendSourceAlpha;
+        GLint     mOldBlendDestinationAlpha;
+        GLint     mOldBlendEquationRGB;
+        GLint     mOldBlendEquationAlpha;
+        GLint     mOldScissorBox[4];
+        GLboolean mOldColorMask[4];
+        bool      mWasBlendEnabled;
+        bool      mWasCullFaceEnabled;
+        bool      mWasDepthTestEnabled;
+        bool      mWasScissorTestEnabled;
+        bool      mIsHostStateKnown;
+        irr::u32  mNumberOfQueries;
+    };
+  }
+
+  OpenGL3Helper::CShaderPipeline * COpenGL3IMGUIDriver::mpShaderPipeline = nullptr;
+
+  bool COpenGL3IMGUIDriver::isSupported(irr::IrrlichtDevice * const pDevice)
+  {
+    irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+
+    if (pDriver->getDriverType() != irr::video::EDT_OPENGL)
+    {
+      return false;
+    }
+
+    if (!pDriver->queryFeature(irr::video::EVDF_VERTEX_BUFFER_OBJECT))
+    {
+      return false;
+    }
+
+    int Major;
+    int Minor;
+    if (!OpenGL::getVersion(Major, Minor))
+    {
+      return false;
+    }
+
+    return (Major > 3) || ((Major == 3) && (Minor >= 3));
+  }
+
+  bool COpenGL3IMGUIDriver::createShaderPipeline(void)
+  {
+    if (!mpShaderPipeline)
+    {
+      mpShaderPipeline = OpenGL3Helper::CShaderPipeline::createPipeline();
+    }
+
+    return (mpShaderPipeline != nullptr);
+  }
+
+  void COpenGL3IMGUIDriver::setFragmentShaderSource(char const * const pSource)
+  {
+    OpenGL3Helper::pCurrentFragmentShaderSource = pSource ? pSource : OpenGL3Helper::FragmentShaderSource;
+    return;
+  }
+
+  COpenGL3IMGUIDriver::COpenGL3IMGUIDriver(irr::IrrlichtDevice * const pDevice):
+      COpenGLIMGUIDriver(pDevice)
+  {
+    ImGui::GetIO().RenderDrawListsFn = COpenGL3IMGUIDriver::drawGUIList;
+
+    // the font texture is created after the driver, thus it is already a single channel texture
+    mIsAlphaInRedChannel = true;
+
+    // the pipeline has usually been created already, when the render backend has been selected
+    if (!createShaderPipeline())
+    {
+      LOG_ERROR("{IrrIMGUI-GL3} Cannot create the shader program, the GUI is not drawn.\n");
+    }
+
+    LOG_NOTE("{IrrIMGUI-GL3} Start OpenGL 3.3 GUI renderer.\n");
+    return;
+  }
+
+  COpenGL3IMGUIDriver::~COpenGL3IMGUIDriver(void)
+  {
+    delete mpShaderPipeline;
+    mpShaderPipeline = nullptr;
+
+    mIsAlphaInRedChannel = false;
+    return;
+  }
+
+  void COpenGL3IMGUIDriver::drawGUIList(ImDrawData * const pDrawData)
+  {
+    invalidateScissorRect();
+    shrinkStagingBuffers();
+
+    if (!mpShaderPipeline || !mpBufferObjectStream)
+    {
+      return;
+    }
+
+    ImGuiIO& rGUIIO = ImGui::GetIO();
+    pDrawData->ScaleClipRects(rGUIIO.DisplayFramebufferScale);
+
+    // the shadow tracks the buffer bindings of the buffer object stream
+    mpStateShadow->setHostStatePersistent(getSettings().mIsOpenGLHostStatePersistent);
+    mpStateShadow->begin();
+
+    mpShaderPipeline->begin(rGUIIO.DisplaySize.x, rGUIIO.DisplaySize.y, getBlendMode(), getSettings().mIsOpenGLHostStatePersistent);
+
+    // the whole frame is uploaded into a single vertex and index buffer, before the first command is drawn
+    if (uploadFrame(pDrawData) > 0)
+    {
+      mpShaderPipeline->setVertexFormat();
+      drawCommandLists(pDrawData);
+    }
+
+    // the index buffer binding is part of the vertex array object of the GUI, thus it is restored before the pipeline unbinds it
+    mpStateShadow->restore();
+    mpShaderPipeline->end();
+
+    mStatistics.mNumberOfStateQueries += mpShaderPipeline->getNumberOfQueries() + mpStateShadow->getNumberOfQueries();
+
+    return;
+  }
+
+  void COpenGL3IMGUIDriver::invalidateHostState(void)
+  {
+    COpenGLIMGUIDriver::invalidateHostState();
+
+    if (mpShaderPipeline)
+    {
+      mpShaderPipeline->invalidateHostState();
+    }
+
+    return;
+  }
+
+  void COpenGL3IMGUIDriver::drawCommandLists(ImDrawData * const pDrawData)
+  {
+    ImGuiIO& rGUIIO = ImGui::GetIO();
+    float const FrameBufferHeight = rGUIIO.DisplaySize.y * rGUIIO.DisplayFramebufferScale.y;
+
+    size_t IndexOffset    = 0;
+    GLint  BaseVertex     = 0;
+    GLuint CurrentTexture = 0;
+    bool   IsTextureBound = false;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+      bool   const Is32BitIndexData = OpenGL::isUsing32BitIndices(pCommandList);
+      GLenum const IndexType        = Is32BitIndexData ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+      size_t const IndexSize        = Is32BitIndexData ? sizeof(irr::u32) : sizeof(irr::u16);
+      size_t FirstIndexOffset       = IndexOffset;
+
+      for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
+      {
+        ImDrawCmd * const pCommand = &pCommandList->CmdBuffer[CommandIndex];
+        mStatistics.mNumberOfDrawCommands++;
+
+        if (pCommand->UserCallback)
+        {
+          pCommand->UserCallback(pCommandList, pCommand);
+
+          // the callback may bind another texture or set another scissor rectangle
+          IsTextureBound = false;
+          invalidateScissorRect();
+        }
+        else
+        {
+          CGUITexture * const pGUITexture = reinterpret_cast<CGUITexture*>(pCommand->TextureId);
+          GLuint const Texture = (GLuint)(intptr_t)pGUITexture->mGPUTextureID;
+
+          if (IsTextureBound && (Texture == CurrentTexture))
+          {
+            mStatistics.mNumberOfSavedMaterialSwitches++;
+          }
+          else
+          {
+            glBindTexture(GL_TEXTURE_2D, Texture);
+            CurrentTexture = Texture;
+            IsTextureBound = true;
+            mStatistics.mNumberOfMaterialSwitches++;
+          }
+
+          applyScissorRect(pCommand->ClipRect, FrameBufferHeight);
+          mpShaderPipeline->drawElements((GLsizei)pCommand->ElemCount, IndexType, FirstIndexOffset, BaseVertex);
+          mStatistics.mNumberOfDrawCalls++;
+        }
+
+        FirstIndexOffset += pCommand->ElemCount * IndexSize;
+      }
+
+      BaseVertex  += pCommandList->VtxBuffer.size();
+      IndexOffset += OpenGL::getStreamedIndexBytes(pCommandList);
+    }
+
+    return;
+  }
+
+namespace OpenGL3Helper
+{
+  void restoreGLBit(GLenum const WhichBit, bool const Value)
+  {
+    if (Value)
+    {
+      glEnable(WhichBit);
+    }
+    else
+    {
+      glDisable(WhichBit);
+    }
+  }
+
+  CShaderPipeline * CShaderPipeline::createPipeline(void)
+  {
+    CShaderPipeline * const pPipeline = new CShaderPipeline();
+
+    if (!pPipeline->loadFunctions())
+    {
+      LOG_WARNING("{IrrIMGUI-GL3} The OpenGL context does not provide all OpenGL 3.3 functions.\n");
+      delete pPipeline;
+      return nullptr;
+    }
+
+    if (!pPipeline->createProgram())
+    {
+      delete pPipeline;
+      return nullptr;
+    }
+
+    pPipeline->mpGenVertexArrays(1, &pPipeline->mVertexArray);
+
+    return pPipeline;
+  }
+
+  CShaderPipeline::CShaderPipeline(void):
+    mpCreateShader(nullptr),
+    mpShaderSource(nullptr),
+    mpCompileShader(nullptr),
+    mpGetShaderiv(nullptr),
+    mpGetShaderInfoLog(nullptr),
+    mpDeleteShader(nullptr),
+    mpCreateProgram(nullptr),
+    mpAttachShader(nullptr),
+    mpLinkProgram(nullptr),
+    mpGetProgramiv(nullptr),
+    mpGetProgramInfoLog(nullptr),
+    mpDeleteProgram(nullptr),
+    mpUseProgram(nullptr),
+    mpGetUniformLocation(nullptr),
+    mpUniform1i(nullptr),
+    mpUniformMatrix4fv(nullptr),
+    mpGenVertexArrays(nullptr),
+    mpDeleteVertexArrays(nullptr),
+    mpBindVertexArray(nullptr),
+    mpEnableVertexAttribArray(nullptr),
+    mpVertexAttribPointer(nullptr),
+    mpDrawElementsBaseVertex(nullptr),
+    mpBlendEquationSeparate(nullptr),
+    mpBlendFuncSeparate(nullptr),
+    mpActiveTexture(nullptr),
+    mProgram(0),
+    mVertexArray(0),
+    mProjectionMatrixLocation(-1),
+    mTextureLocation(-1),
+    mOldProgram(0),
+    mOldVertexArray(0),
+    mOldActiveTexture(GL_TEXTURE0),
+    mOldTexture(0),
+    mOldBlendSourceRGB(GL_ONE),
+    mOldBlendDestinationRGB(GL_ZERO),
+    mOldBlendSourceAlpha(GL_ONE),
+    mOldBlendDestinationAlpha(GL_ZERO),
+    mOldBlendEquationRGB(GL_FUNC_ADD),
+    mOldBlendEquationAlpha(GL_FUNC_ADD),
+    mWasBlendEnabled(false),
+    mWasCullFaceEnabled(false),
+    mWasDepthTestEnabled(false),
+    mWasScissorTestEnabled(false),
+    mIsHostStateKnown(false),
+    mNumberOfQueries(0)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      mOldScissorBox[i] = 0;
+      mOldColorMask[i]  = GL_TRUE;
+    }
+
+    return;
+  }
+
+  CShaderPipeline::~CShaderPipeline(void)
+  {
+    if (mpDeleteVertexArrays && mVertexArray)
+    {
+      mpDeleteVertexArrays(1, &mVertexArray);
+    }
+
+    if (mpDeleteProgram && mProgram)
+    {
+      mpDeleteProgram(mProgram);
+    }
+
+    return;
+  }
+
+  bool CShaderPipeline::loadFunctions(void)
+  {
+    bool IsLoaded = true;
+
+    IsLoaded = OpenGL::loadFunction(mpCreateShader,            "glCreateShader")            && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpShaderSource,            "glShaderSource")            && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpCompileShader,           "glCompileShader")           && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGetShaderiv,             "glGetShaderiv")             && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGetShaderInfoLog,        "glGetShaderInfoLog")        && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpDeleteShader,            "glDeleteShader")            && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpCreateProgram,           "glCreateProgram")           && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpAttachShader,            "glAttachShader")            && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpLinkProgram,             "glLinkProgram")             && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGetProgramiv,            "glGetProgramiv")            && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGetProgramInfoLog,       "glGetProgramInfoLog")       && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpDeleteProgram,           "glDeleteProgram")           && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpUseProgram,              "glUseProgram")              && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGetUniformLocation,      "glGetUniformLocation")      && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpUniform1i,               "glUniform1i")               && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpUniformMatrix4fv,        "glUniformMatrix4fv")        && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpGenVertexArrays,         "glGenVertexArrays")         && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpDeleteVertexArrays,      "glDeleteVertexArrays")      && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpBindVertexArray,         "glBindVertexArray")         && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpEnableVertexAttribArray, "glEnableVertexAttribArray") && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpVertexAttribPointer,     "glVertexAttribPointer")     && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpDrawElementsBaseVertex,  "glDrawElementsBaseVertex")  && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpBlendEquationSeparate,   "glBlendEquationSeparate")   && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpBlendFuncSeparate,       "glBlendFuncSeparate")       && IsLoaded;
+    IsLoaded = OpenGL::loadFunction(mpActiveTexture,           "glActiveTexture")           && IsLoaded;
+
+    return IsLoaded;
+  }
+
+  GLuint CShaderPipeline::compileShader(GLenum const Type, char const * const pSource)
+  {
+    GLuint const Shader = mpCreateShader(Type);
+    mpShaderSource(Shader, 1, &pSource, nullptr);
+    mpCompileShader(Shader);
+
+    GLint IsCompiled = GL_FALSE;
+    mpGetShaderiv(Shader, GL_COMPILE_STATUS, &IsCompiled);
+
+    if (IsCompiled != GL_TRUE)
+    {
+      GLint LogLength = 0;
+      mpGetShaderiv(Shader, GL_INFO_LOG_LENGTH, &LogLength);
+
+      std::vector<char> Log(LogLength + 1, '\0');
+      mpGetShaderInfoLog(Shader, LogLength, nullptr, Log.data());
+      LOG_ERROR("{IrrIMGUI-GL3} Cannot compile shader: " << Log.data() << "\n");
+
+      mpDeleteShader(Shader);
+      return 0;
+    }
+
+    return Shader;
+  }
+
+  bool CShaderPipeline::createProgram(void)
+  {
+    GLuint const VertexShader   = compileShader(GL_VERTEX_SHADER,   VertexShaderSource);
+    GLuint const FragmentShader = compileShader(GL_FRAGMENT_SHADER, pCurrentFragmentShaderSource);
+
+    if (!VertexShader || !FragmentShader)
+    {
+      if (VertexShader)
+      {
+        mpDeleteShader(VertexShader);
+      }
+
+      if (FragmentShader)
+      {
+        mpDeleteShader(FragmentShader);
+      }
+
+      return false;
+    }
+
+    mProgram = mpCreateProgram();
+    mpAttachShader(mProgram, VertexShader);
+    mpAttachShader(mProgram, FragmentShader);
+    mpLinkProgram(mProgram);
+
+    // the shaders are deleted together with the program
+    mpDeleteShader(VertexShader);
+    mpDeleteShader(FragmentShader);
+
+    GLint IsLinked = GL_FALSE;
+    mpGetProgramiv(mProgram, GL_LINK_STATUS, &IsLinked);
+
+    if (IsLinked != GL_TRUE)
+    {
+      GLint LogLength = 0;
+      mpGetProgramiv(mProgram, GL_INFO_LOG_LENGTH, &LogLength);
+
+      std::vector<char> Log(LogLength + 1, '\0');
+      mpGetProgramInfoLog(mProgram, LogLength, nullptr, Log.data());
+      LOG_ERROR("{IrrIMGUI-GL3} Cannot link shader program: " << Log.data() << "\n");
+
+      return false;
+    }
+
+    mProjectionMatrixLocation = mpGetUniformLocation(mProgram, "ProjectionMatrix");
+    mTextureLocation          = mpGetUniformLocation(mProgram, "Texture");
+
+    return true;
+  }
+
+  void CShaderPipeline::invalidateHostState(void)
+  {
+    mIsHostStateKnown = false;
+    return;
+  }
+
+  irr::u32 CShaderPipeline::getNumberOfQueries(void) const
+  {
+    return mNumberOfQueries;
+  }
+
+  void CShaderPipeline::begin(float const DisplayWidth, float const DisplayHeight, EBlendMode const BlendMode, bool const IsHostStatePersistent)
+  {
+    mNumberOfQueries = 0;
+
+    // store the state, that is changed by the GUI (end() restores it, thus it is still valid for a persistent host state)
+    if (!IsHostStatePersistent || !mIsHostStateKnown)
+    {
+      glGetIntegerv(GL_CURRENT_PROGRAM,       &mOldProgram);
+      glGetIntegerv(GL_VERTEX_ARRAY_BINDING,  &mOldVertexArray);
+      glGetIntegerv(GL_ACTIVE_TEXTURE,        &mOldActiveTexture);
+      glGetIntegerv(GL_BLEND_SRC_RGB,         &mOldBlendSourceRGB);
+      glGetIntegerv(GL_BLEND_DST_RGB,         &mOldBlendDestinationRGB);
+      glGetIntegerv(GL_BLEND_SRC_ALPHA,       &mOldBlendSourceAlpha);
+      glGetIntegerv(GL_BLEND_DST_ALPHA,       &mOldBlendDestinationAlpha);
+      glGetIntegerv(GL_BLEND_EQUATION_RGB,    &mOldBlendEquationRGB);
+      glGetIntegerv(GL_BLEND_EQUATION_ALPHA,  &mOldBlendEquationAlpha);
+      glGetIntegerv(GL_SCISSOR_BOX,           mOldScissorBox);
+      glGetBooleanv(GL_COLOR_WRITEMASK,       mOldColorMask);
+      mWasBlendEnabled       = (glIsEnabled(GL_BLEND)        == GL_TRUE);
+      mWasCullFaceEnabled    = (glIsEnabled(GL_CULL_FACE)    == GL_TRUE);
+      mWasDepthTestEnabled   = (glIsEnabled(GL_DEPTH_TEST)   == GL_TRUE);
+      mWasScissorTestEnabled = (glIsEnabled(GL_SCISSOR_TEST) == GL_TRUE);
+    }
+
+    mpActiveTexture(GL_TEXTURE0);
+    if (!IsHostStatePersistent || !mIsHostStateKnown)
+    {
+      glGetIntegerv(GL_TEXTURE_BINDING_2D, &mOldTexture);
+
+      // 11 values, 4 capabilities and the texture binding
+      mNumberOfQueries  = 16;
+      mIsHostStateKnown = true;
+    }
+
+    // setup the state of the GUI
+    glEnable(GL_BLEND);
+    mpBlendEquationSeparate(GL_FUNC_ADD, GL_FUNC_ADD);
+    switch (BlendMode)
+    {
+      case EBM_ACCUMULATE_ALPHA:
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_TRUE);
+        break;
+
+      case EBM_PREMULTIPLIED_ALPHA:
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+
+      case EBM_COLOR_ONLY:
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
+        break;
+
+      default:
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    }
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_SCISSOR_TEST);
+
+    // orthographic projection of the display (column major)
+    GLfloat const ProjectionMatrix[16] =
+    {
+      2.0f / DisplayWidth, 0.0f,                  0.0f, 0.0f,
+      0.0f,                -2.0f / DisplayHeight, 0.0f, 0.0f,
+      0.0f,                0.0f,                 -1.0f, 0.0f,
+      -1.0f,               1.0f,                  0.0f, 1.0f
+    };
+
+    mpUseProgram(mProgram);
+    mpUniform1i(mTextureLocation, 0);
+    mpUniformMatrix4fv(mProjectionMatrixLocation, 1, GL_FALSE, ProjectionMatrix);
+    mpBindVertexArray(mVertexArray);
+
+    return;
+  }
+
+  void CShaderPipeline::setVertexFormat(void)
+  {
+    GLsizei const Stride = sizeof(ImDrawVert);
+
+    mpEnableVertexAttribArray(EAL_POSITION);
+    mpEnableVertexAttribArray(EAL_UV);
+    mpEnableVertexAttribArray(EAL_COLOR);
+    mpVertexAttribPointer(EAL_POSITION, 2, GL_FLOAT,         GL_FALSE, Stride, reinterpret_cast<void const *>(offsetof(ImDrawVert, pos)));
+    mpVertexAttribPointer(EAL_UV,       2, GL_FLOAT,         GL_FALSE, Stride, reinterpret_cast<void const *>(offsetof(ImDrawVert, uv)));
+    mpVertexAttribPointer(EAL_COLOR,    4, GL_UNSIGNED_BYTE, GL_TRUE,  Stride, reinterpret_cast<void const *>(offsetof(ImDrawVert, col)));
+
+    return;
+  }
+
+  void CShaderPipeline::drawElements(GLsizei const NumberOfIndices, GLenum const IndexType, size_t const IndexOffset, GLint const BaseVertex)
+  {
+    mpDrawElementsBaseVertex(GL_TRIANGLES, NumberOfIndices, IndexType, reinterpret_cast<void const *>(IndexOffset), BaseVertex);
+    return;
+  }
+
+  void CShaderPipeline::end(void)
+  {
+    mpBindVertexArray(static_cast<GLuint>(mOldVertexArray));
+    mpUseProgram(static_cast<GLuint>(mOldProgram));
+
+    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(mOldTexture));
+    mpActiveTexture(static_cast<GLenum>(mOldActiveTexture));
+
+    mpBlendEquationSeparate(static_cast<GLenum>(mOldBlendEquationRGB), static_cast<GLenum>(mOldBlendEquationAlpha));
+    mpBlendFuncSeparate(static_cast<GLenum>(mOldBlendSourceRGB), static_cast<GLenum>(mOldBlendDestinationRGB), static_cast<GLenum>(mOldBlendSourceAlpha), static_cast<GLenum>(mOldBlendDestinationAlpha));
+    glScissor(mOldScissorBox[0], mOldScissorBox[1], mOldScissorBox[2], mOldScissorBox[3]);
+    glColorMask(mOldColorMask[0], mOldColorMask[1], mOldColorMask[2], mOldColorMask[3]);
+
+    restoreGLBit(GL_BLEND,        mWasBlendEnabled);
+    restoreGLBit(GL_CULL_FACE,    mWasCullFaceEnabled);
+    restoreGLBit(GL_DEPTH_TEST,   mWasDepthTestEnabled);
+    restoreGLBit(GL_SCISSOR_TEST, mWasScissorTestEnabled);
+
+    return;
+  }
+
+}
+
+}
+}
+}
+
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
@@ -0,0 +1,120 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file       COpenGL3IMGUIDriver.h
+ * @author     Andre Netzeband
+ * @brief      Contains a driver that uses an OpenGL 3.3 shader pipeline to render the GUI.
+ * @attention  This driver is a test- and fallback implementation like the native OpenGL driver. It is not officially supported by the Irrlicht IMGUI binding.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_COPENGL3IMGUIDRIVER_H_
+#define IRRIMGUI_SOURCE_COPENGL3IMGUIDRIVER_H_
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+// module includes
+#include <IrrIMGUI/IrrIMGUIConfig.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include "COpenGLIMGUIDriver.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace Driver
+{
+  namespace OpenGL3Helper
+  {
+    class CShaderPipeline;
+  }
+
+  /// @brief A driver that draws the GUI with a vertex array object and a shader program (OpenGL 3.3).
+  ///        It needs no fixed function state, thus it also works with core profile contexts. The textures are
+  ///        created like by the native OpenGL driver, but alpha textures (like the font texture) are single channel R8 textures.
+  class COpenGL3IMGUIDriver : public COpenGLIMGUIDriver
+  {
+    friend class IrrIMGUI::Private::IIMGUIDriver;
+    public:
+      /// @brief Checks if the driver can be used with an Irrlicht device.
+      /// @param pDevice is a pointer to the Irrlicht Device.
+      /// @return Returns true, when the device uses the Irrlicht OpenGL driver with an OpenGL 3.3 context (or higher).
+      static bool isSupported(irr::IrrlichtDevice * pDevice);
+
+      /// @brief Creates the shader program and the vertex array object for the current OpenGL context, when they do not exist yet.
+      ///        This is checked before the driver is selected, thus a failure falls back to another render backend.
+      /// @return Returns false, when the shader pipeline cannot be created. The driver cannot draw the GUI then.
+      static bool createShaderPipeline(void);
+
+      /// @brief Replaces the fragment shader, that is compiled by createShaderPipeline() (used by the unit tests to check the fall-back).
+      /// @param pSource Is the source code of the fragment shader or nullptr for the built-in shader.
+      static void setFragmentShaderSource(char const * pSource);
+
+    private:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief The constructor.
+      /// @param pDevice is a pointer to the Irrlicht Device.
+      COpenGL3IMGUIDriver(irr::IrrlichtDevice * const pDevice);
+
+      /// @brief The Destructor
+      ~COpenGL3IMGUIDriver(void);
+
+      /// @}
+
+      /// @{
+      /// @name Methods used for rendering.
+
+      /// @brief Renders a full IMGUI draw list (called by the IMGUI system).
+      /// @param pDrawData is a list of data to draw.
+      static void drawGUIList(ImDrawData * pDrawData);
+
+      /// @brief Draws all command lists from the buffer objects, where they have been uploaded with uploadFrame(...).
+      /// @param pDrawData is a list of data to draw.
+      static void drawCommandLists(ImDrawData * pDrawData);
+
+      /// @brief Forgets the OpenGL state values, that have been read by the state shadow and the shader pipeline.
+      virtual void invalidateHostState(void);
+
+      /// @}
+
+      /// @brief The shader program and the vertex array object. It is nullptr, when the shader program could not be created.
+      static OpenGL3Helper::CShaderPipeline * mpShaderPipeline;
+
+  };
+
+}
+}
+}
+
+/**
+ * @}
+ */
+
+
+#endif /* IRRIMGUI_SOURCE_COPENGL3IMGUIDRIVER_H_ */
@@ -33,7 +33,7 @@
  * @addtogroup IrrIMGUIPrivate
  */
 
-#ifdef _IRRIMGUI_NATIVE_OPENGL_
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
 
 // library includes
 #include <IrrIMGUI/IrrIMGUIConfig.h>
@@ -46,6 +46,9 @@
 #include "COpenGLIMGUIDriver.h"
 #include "private/IrrIMGUIDebug_priv.h"
 #include "private/CGUITexture.h"
+#include "private/IrrIMGUIIndices_priv.h"
+#include "private/IrrIMGUIOpenGL_priv.h"
+#include "private/IrrIMGUISIMD_priv.h"
 
 namespace IrrIMGUI
 {
@@ -58,12 +61,16 @@ namespace Driver
   namespace OpenGLHelper
   {
     /// @brief Deleted a texture from memory if it uses its own memory.
-    /// @param pGUITexture Is a CGUITexture object where the GPU memory should be deleted from.
-    void deleteTextureFromMemory(CGUITexture * pGUITexture);
+    /// @param pGUITexture  Is a CGUITexture object where the GPU memory should be deleted from.
+    /// @param rStateShadow Is the shadow of the OpenGL state.
+    void deleteTextureFromMemory(CGUITexture * pGUITexture, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Copies the current loaded GUI Fonts into the GPU memory.
+    /// @param IsAlphaInRedChannel Is true, when alpha textures are stored as single channel red textures (see createTextureIDFromRawData).
+    /// @param rImageBuffer        Is a buffer for converted pixels, which is reused for every texture.
+    /// @param rStateShadow        Is the shadow of the OpenGL state.
     /// @return Returns a GPU memory ID.
-    ImTextureID copyTextureIDFromGUIFont(void);
+    ImTextureID copyTextureIDFromGUIFont(bool IsAlphaInRedChannel, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Extracts the GPU memory ID for GUI usage from the ITexture object.
     /// @param pTexture Is a pointer to a ITexture object.
@@ -71,14 +78,18 @@ namespace Driver
     ImTextureID getTextureIDFromIrrlichtTexture(irr::video::ITexture * pTexture);
 
     /// @brief Copies the content of an ITexture object into the GPU memory.
-    /// @param pTexture Is a pointer to a ITexture object.
+    /// @param pTexture     Is a pointer to a ITexture object.
+    /// @param rImageBuffer Is a buffer for the converted pixels, which is reused for every texture.
+    /// @param rStateShadow Is the shadow of the OpenGL state.
     /// @return Returns a GPU memory ID.
-    ImTextureID copyTextureIDFromIrrlichtTexture(irr::video::ITexture * pTexture);
+    ImTextureID copyTextureIDFromIrrlichtTexture(irr::video::ITexture * pTexture, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Copies the content of an IImage object into the GPU memory.
-    /// @param pImage Is a pointer to a IImage object.
+    /// @param pImage       Is a pointer to a IImage object.
+    /// @param rImageBuffer Is a buffer for the converted pixels, which is reused for every texture.
+    /// @param rStateShadow Is the shadow of the OpenGL state.
     /// @return Returns a GPU memory ID.
-    ImTextureID copyTextureIDFromIrrlichtImage(irr::video::IImage * pImage);
+    ImTextureID copyTextureIDFromIrrlichtImage(irr::video::IImage * pImage, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Creates an new texture from raw data inside the GPU memory.
     ///        When the color format does not fit to the OpenGL format, it will be translated automatically.
@@ -86,8 +97,12 @@ namespace Driver
     /// @param pPixelData  Is a pointer to the image array.
     /// @param Width       Is the number of X pixels.
     /// @param Height      Is the number of Y pixels.
+    /// @param IsAlphaInRedChannel Is true, when alpha textures are stored as single channel red textures with a swizzle mask,
+    ///                            that returns the red channel as alpha (core profiles do not support GL_ALPHA textures).
+    /// @param rImageBuffer        Is a buffer for converted pixels, which is reused for every texture.
+    /// @param rStateShadow        Is the shadow of the OpenGL state.
     /// @return Returns a GPU memory ID.
-    ImTextureID createTextureIDFromRawData(EColorFormat ColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height);
+    ImTextureID createTextureIDFromRawData(EColorFormat ColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height, bool IsAlphaInRedChannel, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Creates an new texture from raw data inside the GPU memory.
     ///        For this, the Color Format must be already in an OpenGL accepted format!
@@ -95,50 +110,83 @@ namespace Driver
     /// @param pPixelData        Is a pointer to the image array.
     /// @param Width             Is the number of X pixels.
     /// @param Height            Is the number of Y pixels.
+    /// @param rStateShadow      Is the shadow of the OpenGL state. The texture binding is restored without reading it from OpenGL.
     /// @return Returns a GPU memory ID.
-    ImTextureID createTextureInMemory(GLint OpenGLColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height);
+    ImTextureID createTextureInMemory(GLint OpenGLColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height, OpenGL::CStateShadow &rStateShadow);
+
+    /// @brief Writes raw data into a rectangle of an existing texture inside the GPU memory.
+    ///        OpenGL translates the color format during the upload, thus no temporary copy is needed.
+    /// @param TextureID   Is the GPU memory ID of the texture.
+    /// @param ColorFormat Is the used Color Format inside the raw data.
+    /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+    /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+    /// @param X           Is the left border of the rectangle inside the texture.
+    /// @param Y           Is the upper border of the rectangle inside the texture.
+    /// @param Width       Is the number of X pixels.
+    /// @param Height      Is the number of Y pixels.
+    /// @param IsAlphaInRedChannel Is true, when alpha textures are stored as single channel red textures (see createTextureIDFromRawData).
+    /// @param rStateShadow        Is the shadow of the OpenGL state.
+    void copyRawDataIntoTexture(ImTextureID TextureID, EColorFormat ColorFormat, irr::u8 const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height, bool IsAlphaInRedChannel, OpenGL::CStateShadow &rStateShadow);
+
+    /// @brief Writes the content of an image into an existing texture with the same size inside the GPU memory.
+    /// @param TextureID    Is the GPU memory ID of the texture.
+    /// @param pImage       Is a pointer to the Irrlicht image object.
+    /// @param rImageBuffer Is a buffer for the translated image, when the image is not stored as ARGB words.
+    /// @param rStateShadow Is the shadow of the OpenGL state.
+    void copyImageIntoTexture(ImTextureID TextureID, irr::video::IImage * pImage, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow);
 
     /// @brief Translates an image in ARGB format (used by Irrlicht) to an image in RGBA format (used by OpenGL).
     /// @param pSource      Is a pointer to the source data array.
-    /// @param pDestination Is a pointer to the destination data array.
+    /// @param pDestination Is a pointer to the destination data array. It can be the same like pSource.
     /// @param Width             Is the number of X pixels.
     /// @param Height            Is the number of Y pixels.
-    void copyARGBImageToRGBA(irr::u32 * pSource, irr::u32 * pDestination, irr::u32 Width, irr::u32 Height);
+    void copyARGBImageToRGBA(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 Width, irr::u32 Height);
 
     /// @return Returns the value of an OpenGL Enum Value
     /// @param Which is the enum where we want to know the value.
     GLenum getGlEnum(GLenum const Which);
 
-    /// @brief Restores an OpenGL Bit
-    /// @param WhichBit is the bit to restore.
-    /// @param Value must be true or false, whether it was set or cleared.
-    void restoreGLBit(GLenum const WhichBit, bool const Value);
-
-    /// @brief Helper Class to store and restore the OpenGL state.
-    class COpenGLState
-    {
-      public:
-        /// @brief The Constructor stored the OpenGL state.
-        COpenGLState(void);
-
-        /// @brief The Destructor restores the state.
-        ~COpenGLState(void);
-
-      private:
-        GLint  mOldTexture;
-    };
+    /// @brief After this number of frames the staging buffers are shrunk to the size needed in this period.
+    static irr::u32 const FramesPerStagingBufferShrink = 600;
   }
 
+  CStagingBuffer<irr::u32>                  COpenGLIMGUIDriver::mUnwrappedIndexBuffer;
+  CStagingBuffer<irr::u32>                  COpenGLIMGUIDriver::mImageBuffer;
+  irr::u32                                  COpenGLIMGUIDriver::mFramesSinceShrink   = 0;
+  OpenGL::CBufferObjectStream             * COpenGLIMGUIDriver::mpBufferObjectStream = nullptr;
+  bool                                      COpenGLIMGUIDriver::mIsAlphaInRedChannel = false;
+  OpenGL::CStateShadow                    * COpenGLIMGUIDriver::mpStateShadow        = nullptr;
+  ImVec4                                    COpenGLIMGUIDriver::mScissorRect;
+  bool                                      COpenGLIMGUIDriver::mIsScissorRectApplied = false;
+
   COpenGLIMGUIDriver::COpenGLIMGUIDriver(irr::IrrlichtDevice * const pDevice):
       IIMGUIDriver(pDevice)
   {
     setupFunctionPointer();
+
+    mpStateShadow = new OpenGL::CStateShadow();
+
+    mpBufferObjectStream = OpenGL::CBufferObjectStream::createStream(pDevice->getVideoDriver(), *mpStateShadow);
+    if (!mpBufferObjectStream)
+    {
+      LOG_NOTE("{IrrIMGUI-GL} The OpenGL context does not support buffer objects, the GUI is drawn from client memory.\n");
+    }
+
     LOG_WARNING("{IrrIMGUI-GL} Start native OpenGL GUI renderer. This renderer is just a test and fall-back solution and it is not officially supported.\n");
     return;
   }
 
   COpenGLIMGUIDriver::~COpenGLIMGUIDriver(void)
   {
+    delete mpBufferObjectStream;
+    mpBufferObjectStream = nullptr;
+
+    delete mpStateShadow;
+    mpStateShadow = nullptr;
+
+    mUnwrappedIndexBuffer.clear();
+    mImageBuffer.clear();
+    mFramesSinceShrink = 0;
     return;
   }
 
@@ -161,36 +209,115 @@ namespace Driver
     return;
   }
 
-  void COpenGLIMGUIDriver::drawCommandList(ImDrawList * const pCommandList)
+  void const * COpenGLIMGUIDriver::getIndexData(ImDrawList * const pCommandList, bool &rIs32BitIndexData)
+  {
+    ImDrawIdx * const pIndexBuffer = &(pCommandList->IdxBuffer.front());
+    rIs32BitIndexData = OpenGL::isUsing32BitIndices(pCommandList);
+
+#ifndef _IRRIMGUI_32BIT_INDICES_
+    // the 16 bit indices of lists with more than 65536 vertices have overflown, thus the real indices are restored as 32 bit indices
+    if (rIs32BitIndexData)
+    {
+      irr::u32 const NumberOfIndices = pCommandList->IdxBuffer.size();
+      irr::u32 * const pUnwrappedIndices = mUnwrappedIndexBuffer.getBuffer(NumberOfIndices);
+      Indices::unwrapIndices(pIndexBuffer, pUnwrappedIndices, NumberOfIndices);
+      mStatistics.mNumberOfConvertedBytes += NumberOfIndices * sizeof(irr::u32);
+
+      return pUnwrappedIndices;
+    }
+#endif // _IRRIMGUI_32BIT_INDICES_
+
+    return pIndexBuffer;
+  }
+
+  void COpenGLIMGUIDriver::applyScissorRect(ImVec4 const &rClippingRect, float const FrameBufferHeight)
+  {
+    if (mIsScissorRectApplied &&
+        (rClippingRect.x == mScissorRect.x) && (rClippingRect.y == mScissorRect.y) &&
+        (rClippingRect.z == mScissorRect.z) && (rClippingRect.w == mScissorRect.w))
+    {
+      return;
+    }
+
+    glScissor((int)rClippingRect.x, (int)(FrameBufferHeight - rClippingRect.w), (int)(rClippingRect.z - rClippingRect.x), (int)(rClippingRect.w - rClippingRect.y));
+    mScissorRect          = rClippingRect;
+    mIsScissorRectApplied = true;
+    mStatistics.mNumberOfClipChanges++;
+
+    return;
+  }
+
+  void COpenGLIMGUIDriver::invalidateScissorRect(void)
+  {
+    mIsScissorRectApplied = false;
+    return;
+  }
+
+  void COpenGLIMGUIDriver::invalidateHostState(void)
+  {
+    mpStateShadow->invalidateHostState();
+    return;
+  }
+
+  void COpenGLIMGUIDriver::shrinkStagingBuffers(void)
+  {
+    // give back memory after a spike of overflown indices or a huge texture
+    mFramesSinceShrink++;
+    if (mFramesSinceShrink >= OpenGLHelper::FramesPerStagingBufferShrink)
+    {
+      mUnwrappedIndexBuffer.shrink();
+      mImageBuffer.shrink();
+      mFramesSinceShrink = 0;
+    }
+
+    return;
+  }
+
+  void COpenGLIMGUIDriver::drawCommandList(ImDrawList * const pCommandList, void const * const pVertexData, void const * const pIndexData, bool const Is32BitIndexData)
   {
     ImGuiIO& rGUIIO = ImGui::GetIO();
     float const FrameBufferHeight = rGUIIO.DisplaySize.y * rGUIIO.DisplayFramebufferScale.y;
 
     #define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
 
-    ImDrawVert * const pVertexBuffer = &(pCommandList->VtxBuffer.front());
-    ImDrawIdx  * const pIndexBuffer  = &(pCommandList->IdxBuffer.front());
+    irr::u8 const * const pVertexBuffer = static_cast<irr::u8 const *>(pVertexData);
     int FirstIndexElement = 0;
 
-    glVertexPointer(  2, GL_FLOAT,         sizeof(ImDrawVert), (void*)(((irr::u8*)pVertexBuffer) + OFFSETOF(ImDrawVert, pos)));
-    glTexCoordPointer(2, GL_FLOAT,         sizeof(ImDrawVert), (void*)(((irr::u8*)pVertexBuffer) + OFFSETOF(ImDrawVert, uv)));
-    glColorPointer(   4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (void*)(((irr::u8*)pVertexBuffer) + OFFSETOF(ImDrawVert, col)));
+    GLenum const IndexType = Is32BitIndexData ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+    size_t const IndexSize = Is32BitIndexData ? sizeof(irr::u32) : sizeof(irr::u16);
+
+    glVertexPointer(  2, GL_FLOAT,         sizeof(ImDrawVert), pVertexBuffer + OFFSETOF(ImDrawVert, pos));
+    glTexCoordPointer(2, GL_FLOAT,         sizeof(ImDrawVert), pVertexBuffer + OFFSETOF(ImDrawVert, uv));
+    glColorPointer(   4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), pVertexBuffer + OFFSETOF(ImDrawVert, col));
 
     for (int CommandIndex = 0; CommandIndex < pCommandList->CmdBuffer.size(); CommandIndex++)
     {
 
       ImDrawCmd * const pCommand = &pCommandList->CmdBuffer[CommandIndex];
+      mStatistics.mNumberOfDrawCommands++;
 
       if (pCommand->UserCallback)
       {
         pCommand->UserCallback(pCommandList, pCommand);
+
+        // the callback may change the OpenGL state without the shadow
+        mpStateShadow->invalidate();
+        invalidateScissorRect();
       }
       else
       {
         CGUITexture * const pGUITexture = reinterpret_cast<CGUITexture*>(pCommand->TextureId);
-        glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pGUITexture->mGPUTextureID);
-        glScissor((int)pCommand->ClipRect.x, (int)(FrameBufferHeight - pCommand->ClipRect.w), (int)(pCommand->ClipRect.z - pCommand->ClipRect.x), (int)(pCommand->ClipRect.w - pCommand->ClipRect.y));
-        glDrawElements(GL_TRIANGLES, (GLsizei)pCommand->ElemCount, GL_UNSIGNED_SHORT, &(pIndexBuffer[FirstIndexElement]));
+        if (mpStateShadow->bindTexture((GLuint)(intptr_t)pGUITexture->mGPUTextureID))
+        {
+          mStatistics.mNumberOfMaterialSwitches++;
+        }
+        else
+        {
+          mStatistics.mNumberOfSavedMaterialSwitches++;
+        }
+        applyScissorRect(pCommand->ClipRect, FrameBufferHeight);
+        glDrawElements(GL_TRIANGLES, (GLsizei)pCommand->ElemCount, IndexType, static_cast<irr::u8 const *>(pIndexData) + (FirstIndexElement * IndexSize));
+        mStatistics.mNumberOfDrawCalls++;
       }
 
       FirstIndexElement += pCommand->ElemCount;
@@ -199,49 +326,173 @@ namespace Driver
     return;
   }
 
+  size_t COpenGLIMGUIDriver::uploadFrame(ImDrawData * const pDrawData)
+  {
+    size_t FrameVertexBytes = 0;
+    size_t FrameIndexBytes  = 0;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList const * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      FrameVertexBytes += pCommandList->VtxBuffer.size() * sizeof(ImDrawVert);
+      FrameIndexBytes  += OpenGL::getStreamedIndexBytes(pCommandList);
+    }
+
+    if ((FrameVertexBytes == 0) || (FrameIndexBytes == 0))
+    {
+      return 0;
+    }
+
+    mpBufferObjectStream->beginFrame(FrameVertexBytes, FrameIndexBytes, *mpStateShadow);
+    mStatistics.mNumberOfStreamedBytes += static_cast<irr::u32>(FrameVertexBytes + FrameIndexBytes);
+
+    size_t VertexOffset = 0;
+    size_t IndexOffset  = 0;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+      size_t const VertexBytes = pCommandList->VtxBuffer.size() * sizeof(ImDrawVert);
+
+      bool Is32BitIndexData;
+      void const * const pIndexData = getIndexData(pCommandList, Is32BitIndexData);
+
+      mpBufferObjectStream->uploadVertices(VertexOffset, VertexBytes, &(pCommandList->VtxBuffer.front()));
+      mpBufferObjectStream->uploadIndices(IndexOffset, pCommandList->IdxBuffer.size() * (Is32BitIndexData ? sizeof(irr::u32) : sizeof(ImDrawIdx)), pIndexData);
+
+      VertexOffset += VertexBytes;
+      IndexOffset  += OpenGL::getStreamedIndexBytes(pCommandList);
+    }
+
+    return FrameVertexBytes + FrameIndexBytes;
+  }
+
+  void COpenGLIMGUIDriver::drawStreamedFrame(ImDrawData * const pDrawData)
+  {
+    // upload the whole frame, before the first command is drawn
+    if (uploadFrame(pDrawData) == 0)
+    {
+      return;
+    }
+
+    // draw every command list with its offset inside the buffer objects
+    size_t VertexOffset = 0;
+    size_t IndexOffset  = 0;
+
+    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    {
+      ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+      drawCommandList(pCommandList, reinterpret_cast<void const *>(VertexOffset), reinterpret_cast<void const *>(IndexOffset), OpenGL::isUsing32BitIndices(pCommandList));
+
+      VertexOffset += pCommandList->VtxBuffer.size() * sizeof(ImDrawVert);
+      IndexOffset  += OpenGL::getStreamedIndexBytes(pCommandList);
+    }
+
+    return;
+  }
+
   void COpenGLIMGUIDriver::drawGUIList(ImDrawData * const pDrawData)
   {
-    OpenGLHelper::COpenGLState OpenGLState;
+    SIMGUISettings const &rSettings = getSettings();
+    invalidateScissorRect();
+    shrinkStagingBuffers();
+
+    mpStateShadow->setHostStatePersistent(rSettings.mIsOpenGLHostStatePersistent);
+    mpStateShadow->begin();
+
+    if (rSettings.mIsOpenGLStateValidationEnabled)
+    {
+      mStatistics.mNumberOfStateMismatches += mpStateShadow->validate();
+    }
 
     // setup OpenGL states
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glDisable(GL_LIGHTING);
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_SCISSOR_TEST);
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
-    glEnable(GL_TEXTURE_2D);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_BLEND, true);
+    switch (getBlendMode())
+    {
+      case EBM_ACCUMULATE_ALPHA:
+        mpStateShadow->setBlendFunction(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        mpStateShadow->setColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_TRUE);
+        break;
+
+      case EBM_PREMULTIPLIED_ALPHA:
+        mpStateShadow->setBlendFunction(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+
+      case EBM_COLOR_ONLY:
+        mpStateShadow->setBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        mpStateShadow->setColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
+        break;
+
+      default:
+        mpStateShadow->setBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    }
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_LIGHTING,            false);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_CULL_FACE,           false);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_DEPTH_TEST,          false);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_SCISSOR_TEST,        true);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_VERTEX_ARRAY,        true);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_TEXTURE_COORD_ARRAY, true);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_COLOR_ARRAY,         true);
+    mpStateShadow->setEnabled(OpenGL::CStateShadow::ES_TEXTURE_2D,          true);
 
     // calculate framebuffe scales
     ImGuiIO& rGUIIO = ImGui::GetIO();
     pDrawData->ScaleClipRects(rGUIIO.DisplayFramebufferScale);
 
-    // setup orthographic projection matrix
-    glMatrixMode(GL_PROJECTION);
+    // setup orthographic projection matrix (the matrix stacks store the matrices without reading them back)
+    mpStateShadow->setMatrixMode(GL_PROJECTION);
+    glPushMatrix();
     glLoadIdentity();
     glOrtho(0.0f, rGUIIO.DisplaySize.x, rGUIIO.DisplaySize.y, 0.0f, -1.0f, +1.0f);
 
     // setup model view matrix
-    glMatrixMode(GL_MODELVIEW);
+    mpStateShadow->setMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
     glLoadIdentity();
 
-    for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+    if (mpBufferObjectStream && rSettings.mIsBufferObjectStreamingEnabled)
+    {
+      drawStreamedFrame(pDrawData);
+    }
+    else
+    {
+      // fallback for OpenGL 1.x contexts: the driver pulls the vertices from client memory for every draw call
+      for (int CommandListIndex = 0; CommandListIndex < pDrawData->CmdListsCount; CommandListIndex++)
+      {
+        ImDrawList * const pCommandList = pDrawData->CmdLists[CommandListIndex];
+
+        bool Is32BitIndexData;
+        void const * const pIndexData = getIndexData(pCommandList, Is32BitIndexData);
+        drawCommandList(pCommandList, &(pCommandList->VtxBuffer.front()), pIndexData, Is32BitIndexData);
+      }
+    }
+
+    // restore matrices
+    mpStateShadow->setMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    mpStateShadow->setMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+
+    if (rSettings.mIsOpenGLStateValidationEnabled)
     {
-      drawCommandList(pDrawData->CmdLists[CommandListIndex]);
+      mStatistics.mNumberOfStateMismatches += mpStateShadow->validate();
     }
 
     // restore modified state
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
+    mpStateShadow->restore();
+
+    if (rSettings.mIsOpenGLStateValidationEnabled)
+    {
+      mStatistics.mNumberOfStateMismatches += mpStateShadow->validate();
+    }
+
+    mStatistics.mNumberOfStateQueries += mpStateShadow->getNumberOfQueries();
 
     return;
   }
 
-
   IGUITexture *COpenGLIMGUIDriver::createTexture(EColorFormat ColorFormat, irr::u8 * pPixelData, irr::u32 Width, irr::u32 Height)
   {
     mTextureInstances++;
@@ -252,9 +503,11 @@ namespace Driver
     pRealGUITexture->mSource.RawDataID = pPixelData;
     pRealGUITexture->mIsValid          = true;
 
+    mNumberOfTextureAllocations++;
+
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      pRealGUITexture->mGPUTextureID = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height);
+      pRealGUITexture->mGPUTextureID = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height, mIsAlphaInRedChannel, mImageBuffer, *mpStateShadow);
     }
     else
     {
@@ -289,9 +542,11 @@ namespace Driver
     pRealGUITexture->mSource.TextureID = pTexture;
     pRealGUITexture->mIsValid          = true;
 
+    mNumberOfTextureAllocations++;
+
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture);
+      pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture, mImageBuffer, *mpStateShadow);
     }
     else
     {
@@ -311,9 +566,11 @@ namespace Driver
     pGUITexture->mSource.ImageID   = pImage;
     pGUITexture->mIsValid          = true;
 
+    mNumberOfTextureAllocations++;
+
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage);
+      pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage, mImageBuffer, *mpStateShadow);
     }
     else
     {
@@ -333,9 +590,11 @@ namespace Driver
     pGUITexture->mSource.GUIFontID = 0;
     pGUITexture->mIsValid          = true;
 
+    mNumberOfTextureAllocations++;
+
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont();
+      pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont(mIsAlphaInRedChannel, mImageBuffer, *mpStateShadow);
     }
     else
     {
@@ -381,7 +640,7 @@ namespace Driver
     {
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture, *mpStateShadow);
       }
 
       pRealGUITexture->mIsUsingOwnMemory = true;
@@ -389,9 +648,11 @@ namespace Driver
       pRealGUITexture->mSource.RawDataID = pPixelData;
       pRealGUITexture->mIsValid          = true;
 
+      mNumberOfTextureAllocations++;
+
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        pRealGUITexture->mGPUTextureID     = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height);
+        pRealGUITexture->mGPUTextureID     = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height, mIsAlphaInRedChannel, mImageBuffer, *mpStateShadow);
       }
       else
       {
@@ -427,7 +688,7 @@ namespace Driver
     {
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture, *mpStateShadow);
       }
 
 #ifdef _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
@@ -450,9 +711,11 @@ namespace Driver
       pRealGUITexture->mSource.TextureID = pTexture;
       pRealGUITexture->mIsValid          = true;
 
+      mNumberOfTextureAllocations++;
+
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture);
+        pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture, mImageBuffer, *mpStateShadow);
       }
       else
       {
@@ -476,6 +739,11 @@ namespace Driver
     {
       IsRecreateNecessary = true;
     }
+    else if (pRealGUITexture->mIsStreaming && pRealGUITexture->mIsUsingOwnMemory)
+    {
+      // streaming textures keep their GPU texture, as long as the image size does not change
+      IsRecreateNecessary = (pRealGUITexture->mWidth != pImage->getDimension().Width) || (pRealGUITexture->mHeight != pImage->getDimension().Height);
+    }
     else if (pImage != pRealGUITexture->mSource.ImageID)
     {
       IsRecreateNecessary = true;
@@ -485,11 +753,21 @@ namespace Driver
       IsRecreateNecessary = true;
     }
 
-    if (IsRecreateNecessary)
+    if (!IsRecreateNecessary && pRealGUITexture->mIsStreaming)
+    {
+      pRealGUITexture->mSource.ImageID = pImage;
+      mNumberOfTextureUploads++;
+
+      if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
+      {
+        OpenGLHelper::copyImageIntoTexture(pRealGUITexture->mGPUTextureID, pImage, mImageBuffer, *mpStateShadow);
+      }
+    }
+    else if (IsRecreateNecessary)
     {
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+        OpenGLHelper::deleteTextureFromMemory(pRealGUITexture, *mpStateShadow);
       }
 
       pRealGUITexture->mIsUsingOwnMemory = true;
@@ -497,9 +775,11 @@ namespace Driver
       pRealGUITexture->mSource.ImageID   = pImage;
       pRealGUITexture->mIsValid          = true;
 
+      mNumberOfTextureAllocations++;
+
       if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
       {
-        pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage);
+        pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage, mImageBuffer, *mpStateShadow);
       }
       else
       {
@@ -510,22 +790,40 @@ namespace Driver
     return;
   }
 
+  void COpenGLIMGUIDriver::updateTextureRegion(IGUITexture * const pGUITexture, EColorFormat const ColorFormat, irr::u8 const * const pPixelData, irr::u32 const Pitch, irr::u32 const X, irr::u32 const Y, irr::u32 const Width, irr::u32 const Height)
+  {
+    CGUITexture * const pRealGUITexture = dynamic_cast<CGUITexture*>(pGUITexture);
+
+    FASSERT(pRealGUITexture->mIsValid);
+
+    if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
+    {
+      OpenGLHelper::copyRawDataIntoTexture(pRealGUITexture->mGPUTextureID, ColorFormat, pPixelData, Pitch, X, Y, Width, Height, mIsAlphaInRedChannel, *mpStateShadow);
+    }
+
+    mNumberOfTextureUploads++;
+
+    return;
+  }
+
   void COpenGLIMGUIDriver::updateFontTexture(IGUITexture * const pGUITexture)
   {
     CGUITexture * const pRealGUITexture = dynamic_cast<CGUITexture*>(pGUITexture);
 
     FASSERT(pRealGUITexture->mIsValid);
 
-    OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+    OpenGLHelper::deleteTextureFromMemory(pRealGUITexture, *mpStateShadow);
 
     pRealGUITexture->mIsUsingOwnMemory = true;
     pRealGUITexture->mSourceType       = ETST_GUIFONT;
     pRealGUITexture->mSource.GUIFontID = 0;
     pRealGUITexture->mIsValid          = true;
 
+    mNumberOfTextureAllocations++;
+
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont();
+      pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont(mIsAlphaInRedChannel, mImageBuffer, *mpStateShadow);
     }
     else
     {
@@ -553,7 +851,7 @@ namespace Driver
 
     if (this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL)
     {
-      OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+      OpenGLHelper::deleteTextureFromMemory(pRealGUITexture, *mpStateShadow);
     }
 
     delete(pRealGUITexture);
@@ -563,66 +861,141 @@ namespace Driver
 
 namespace OpenGLHelper
 {
-  void copyARGBImageToRGBA(irr::u32 * const pSource, irr::u32 * const pDestination, irr::u32 const Width, irr::u32 const Height)
+  void copyARGBImageToRGBA(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const Width, irr::u32 const Height)
   {
-    for (irr::u32 X = 0; X < Width; X++)
-    {
-      for (irr::u32 Y = 0; Y < Height; Y++)
-      {
-        irr::video::SColor PixelColor;
-        PixelColor.setData(&pSource[X + Y * Width], irr::video::ECF_A8R8G8B8);
-        irr::u8 * const pDestPixel = (irr::u8 *)(&pDestination[X + Y * Width]);
-        PixelColor.toOpenGLColor(pDestPixel);
-      }
-    }
+    // the RGBA bytes of OpenGL are ARGB words with swapped Red and Blue channel
+    SIMD::convertColors(pSource, pDestination, Width * Height);
 
     return;
   }
 
-  ImTextureID createTextureInMemory(GLint OpenGLColorFormat, irr::u8 * const pPixelData, irr::u32 const Width, irr::u32 const Height)
+  ImTextureID createTextureInMemory(GLint OpenGLColorFormat, irr::u8 * const pPixelData, irr::u32 const Width, irr::u32 const Height, OpenGL::CStateShadow &rStateShadow)
   {
-    // Store current Texture handle
-    GLint OldTextureID;
-    glGetIntegerv(GL_TEXTURE_BINDING_2D, &OldTextureID);
+    // the shadow knows the current texture handle, when the host state is persistent
+    rStateShadow.begin();
 
     // Create new texture for image
     GLuint NewTextureID;
     glGenTextures(1, &NewTextureID);
-    glBindTexture(GL_TEXTURE_2D, NewTextureID);
+    rStateShadow.bindTexture(NewTextureID);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, OpenGLColorFormat, Width, Height, 0, OpenGLColorFormat, GL_UNSIGNED_BYTE, pPixelData);
+    if (OpenGLColorFormat == GL_RED)
+    {
+      // single channel texture, that returns its red channel as alpha value with white color
+      GLint const SwizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, Width, Height, 0, GL_RED, GL_UNSIGNED_BYTE, pPixelData);
+      glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, SwizzleMask);
+    }
+    else
+    {
+      glTexImage2D(GL_TEXTURE_2D, 0, OpenGLColorFormat, Width, Height, 0, OpenGLColorFormat, GL_UNSIGNED_BYTE, pPixelData);
+    }
 
     ImTextureID pTexture = reinterpret_cast<void *>(static_cast<intptr_t>(NewTextureID));
 
     // Reset Texture handle
-    glBindTexture(GL_TEXTURE_2D, OldTextureID);
+    rStateShadow.restore();
 
     return pTexture;
   }
 
-  ImTextureID createTextureIDFromRawData(EColorFormat const ColorFormat, irr::u8 * pPixelData, irr::u32 const Width, irr::u32 const Height)
+  void copyRawDataIntoTexture(ImTextureID const TextureID, EColorFormat const ColorFormat, irr::u8 const * const pPixelData, irr::u32 const Pitch, irr::u32 const X, irr::u32 const Y, irr::u32 const Width, irr::u32 const Height, bool const IsAlphaInRedChannel, OpenGL::CStateShadow &rStateShadow)
+  {
+    GLenum   OpenGLColor;
+    GLenum   OpenGLType;
+    irr::u32 BytesPerPixel;
+
+    switch(ColorFormat)
+    {
+      // the ARGB words of Irrlicht are translated by OpenGL
+      case ECF_A8R8G8B8:
+        OpenGLColor   = GL_BGRA;
+        OpenGLType    = GL_UNSIGNED_INT_8_8_8_8_REV;
+        BytesPerPixel = 4;
+        break;
+
+      case ECF_R8G8B8A8:
+        OpenGLColor   = GL_RGBA;
+        OpenGLType    = GL_UNSIGNED_BYTE;
+        BytesPerPixel = 4;
+        break;
+
+      case ECF_A8:
+        OpenGLColor   = IsAlphaInRedChannel ? GL_RED : GL_ALPHA;
+        OpenGLType    = GL_UNSIGNED_BYTE;
+        BytesPerPixel = 1;
+        break;
+
+      default:
+        LOG_ERROR("Unknown color format: " << ColorFormat << "\n");
+        FASSERT(false);
+        return;
+    }
+
+    FASSERT((Pitch % BytesPerPixel) == 0);
+
+    rStateShadow.begin();
+    rStateShadow.bindTexture(static_cast<GLuint>(reinterpret_cast<intptr_t>(TextureID)));
+
+    // the rows of the rectangle are read with the pitch of the source data
+    rStateShadow.setUnpackParameter(OpenGL::CStateShadow::ES_UNPACK_ROW_LENGTH, static_cast<GLint>(Pitch / BytesPerPixel));
+    rStateShadow.setUnpackParameter(OpenGL::CStateShadow::ES_UNPACK_ALIGNMENT,  1);
+
+    glTexSubImage2D(GL_TEXTURE_2D, 0, X, Y, Width, Height, OpenGLColor, OpenGLType, pPixelData);
+
+    // Reset Texture handle and unpack parameters
+    rStateShadow.restore();
+
+    return;
+  }
+
+  void copyImageIntoTexture(ImTextureID const TextureID, irr::video::IImage * const pImage, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow)
+  {
+    irr::u32 const Width  = pImage->getDimension().Width;
+    irr::u32 const Height = pImage->getDimension().Height;
+
+    if (pImage->getColorFormat() == irr::video::ECF_A8R8G8B8)
+    {
+      // the ARGB words are uploaded directly from the image memory
+      irr::u8 const * const pImageData = static_cast<irr::u8 const *>(pImage->lock());
+      copyRawDataIntoTexture(TextureID, ECF_A8R8G8B8, pImageData, pImage->getPitch(), 0, 0, Width, Height, false, rStateShadow);
+      pImage->unlock();
+    }
+    else
+    {
+      irr::u32 * const pImageData = rImageBuffer.getBuffer(Width * Height);
+      pImage->copyToScaling(pImageData, Width, Height, irr::video::ECF_A8R8G8B8, Width * 4);
+      copyRawDataIntoTexture(TextureID, ECF_A8R8G8B8, reinterpret_cast<irr::u8 const *>(pImageData), Width * 4, 0, 0, Width, Height, false, rStateShadow);
+    }
+
+    return;
+  }
+
+  ImTextureID createTextureIDFromRawData(EColorFormat const ColorFormat, irr::u8 * pPixelData, irr::u32 const Width, irr::u32 const Height, bool const IsAlphaInRedChannel, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow)
   {
-    irr::u8 * pCopyImageData = nullptr;
-    GLint     OpenGLColor;
+    GLint OpenGLColor;
 
     switch(ColorFormat)
     {
       // convert color to OpenGL color format
       case ECF_A8R8G8B8:
-        pCopyImageData = reinterpret_cast<irr::u8*>(new irr::u32[Width * Height]);
-        copyARGBImageToRGBA(reinterpret_cast<irr::u32*>(pPixelData), reinterpret_cast<irr::u32*>(pCopyImageData), Width, Height);
+      {
+        // the raw data belongs to the caller, thus it is converted into the reused image buffer
+        irr::u32 * const pCopyImageData = rImageBuffer.getBuffer(Width * Height);
+        copyARGBImageToRGBA(reinterpret_cast<irr::u32*>(pPixelData), pCopyImageData, Width, Height);
         OpenGLColor = GL_RGBA;
-        pPixelData = pCopyImageData;
+        pPixelData  = reinterpret_cast<irr::u8*>(pCopyImageData);
         break;
+      }
 
       case ECF_R8G8B8A8:
         OpenGLColor = GL_RGBA;
         break;
 
       case ECF_A8:
-        OpenGLColor = GL_ALPHA;
+        OpenGLColor = IsAlphaInRedChannel ? GL_RED : GL_ALPHA;
         break;
 
       default:
@@ -632,50 +1005,37 @@ namespace OpenGLHelper
         break;
     }
 
-    ImTextureID const pTexture = createTextureInMemory(OpenGLColor, pPixelData, Width, Height);
-
-    if (pCopyImageData)
-    {
-      delete[] pCopyImageData;
-    }
+    ImTextureID const pTexture = createTextureInMemory(OpenGLColor, pPixelData, Width, Height, rStateShadow);
 
     LOG_NOTE("{IrrIMGUI-GL} Create texture from raw data. Handle: " << std::hex << pTexture << "\n");
 
     return pTexture;
   }
 
-  ImTextureID copyTextureIDFromIrrlichtImage(irr::video::IImage * const pImage)
+  ImTextureID copyTextureIDFromIrrlichtImage(irr::video::IImage * const pImage, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow)
   {
     // Convert pImage to RGBA
     int const Width  = pImage->getDimension().Width;
     int const Height = pImage->getDimension().Height;
-    irr::u32 * const pImageData = new irr::u32[Width * Height];
+    irr::u32 * const pImageData = rImageBuffer.getBuffer(Width * Height);
 
-    for (int X = 0; X < Width; X++)
-    {
-      for (int Y = 0; Y < Height; Y++)
-      {
-        irr::video::SColor const PixelColor = pImage->getPixel(X, Y);
-        irr::u8 * const pPixelPointer = (irr::u8 *)(&pImageData[X + Y * Width]);
-        PixelColor.toOpenGLColor(pPixelPointer);
-      }
-    }
+    // Irrlicht translates every color format to ARGB, which is swizzled to RGBA afterwards
+    pImage->copyToScaling(pImageData, Width, Height, irr::video::ECF_A8R8G8B8, Width * 4);
+    copyARGBImageToRGBA(pImageData, pImageData, Width, Height);
 
-    ImTextureID const pTexture = createTextureInMemory(GL_RGBA, reinterpret_cast<irr::u8*>(pImageData), Width, Height);
-
-    delete[] pImageData;
+    ImTextureID const pTexture = createTextureInMemory(GL_RGBA, reinterpret_cast<irr::u8*>(pImageData), Width, Height, rStateShadow);
 
     LOG_NOTE("{IrrIMGUI-GL} Create texture from IImage. Handle: " << std::hex << pTexture << "\n");
 
     return pTexture;
   }
 
-  ImTextureID copyTextureIDFromIrrlichtTexture(irr::video::ITexture * pTexture)
+  ImTextureID copyTextureIDFromIrrlichtTexture(irr::video::ITexture * pTexture, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow)
   {
     // Convert pImage to RGBA
     int const Width  = pTexture->getSize().Width;
     int const Height = pTexture->getSize().Height;
-    irr::u32 * const pImageData = new irr::u32[Width * Height];
+    irr::u32 * const pImageData = rImageBuffer.getBuffer(Width * Height);
 
     irr::u32 const Pitch = pTexture->getPitch();
     irr::video::ECOLOR_FORMAT const ColorFormat = pTexture->getColorFormat();
@@ -684,22 +1044,30 @@ namespace OpenGLHelper
 
     FASSERT(pTextureData);
 
-    for (int X = 0; X < Width; X++)
+    if (ColorFormat == irr::video::ECF_A8R8G8B8)
+    {
+      for (int Y = 0; Y < Height; Y++)
+      {
+        SIMD::convertColors(reinterpret_cast<irr::u32 const *>(pTextureData + (Y * Pitch)), &pImageData[Y * Width], Width);
+      }
+    }
+    else
     {
       for (int Y = 0; Y < Height; Y++)
       {
-        irr::video::SColor PixelColor = irr::video::SColor();
-        PixelColor.setData((void*)(pTextureData + (Y * Pitch) + (X * Bytes)), ColorFormat);
-        irr::u8 * const pPixelPointer = (irr::u8 *)(&pImageData[X + Y * Width]);
-        PixelColor.toOpenGLColor(pPixelPointer);
+        for (int X = 0; X < Width; X++)
+        {
+          irr::video::SColor PixelColor = irr::video::SColor();
+          PixelColor.setData((void*)(pTextureData + (Y * Pitch) + (X * Bytes)), ColorFormat);
+          irr::u8 * const pPixelPointer = (irr::u8 *)(&pImageData[X + Y * Width]);
+          PixelColor.toOpenGLColor(pPixelPointer);
+        }
       }
     }
 
     pTexture->unlock();
 
-    ImTextureID const pNewTexture = createTextureInMemory(GL_RGBA, reinterpret_cast<irr::u8*>(pImageData), Width, Height);
-
-    delete[] pImageData;
+    ImTextureID const pNewTexture = createTextureInMemory(GL_RGBA, reinterpret_cast<irr::u8*>(pImageData), Width, Height, rStateShadow);
 
     LOG_NOTE("{IrrIMGUI-GL} Create texture from ITexture. Handle: " << std::hex << pNewTexture << "\n");
 
@@ -743,7 +1111,7 @@ namespace OpenGLHelper
     return TexID;
   }
 
-  ImTextureID copyTextureIDFromGUIFont(void)
+  ImTextureID copyTextureIDFromGUIFont(bool const IsAlphaInRedChannel, CStagingBuffer<irr::u32> &rImageBuffer, OpenGL::CStateShadow &rStateShadow)
   {
     ImGuiIO &rGUIIO  = ImGui::GetIO();
 
@@ -752,20 +1120,21 @@ namespace OpenGLHelper
     int Width, Height;
     rGUIIO.Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
 
-    ImTextureID const TextureID = createTextureIDFromRawData(ECF_A8, pPixelData, Width, Height);
+    ImTextureID const TextureID = createTextureIDFromRawData(ECF_A8, pPixelData, Width, Height, IsAlphaInRedChannel, rImageBuffer, rStateShadow);
 
     rGUIIO.Fonts->ClearTexData();
 
     return TextureID;
   }
 
-  void deleteTextureFromMemory(CGUITexture * pGUITexture)
+  void deleteTextureFromMemory(CGUITexture * pGUITexture, OpenGL::CStateShadow &rStateShadow)
   {
     if (pGUITexture->mIsUsingOwnMemory)
     {
       LOG_NOTE("{IrrIMGUI-GL} Delete GPU memory. Handle: " << std::hex << pGUITexture->mGPUTextureID << "\n");
       GLuint TextureID = static_cast<GLuint>(reinterpret_cast<intptr_t>(pGUITexture->mGPUTextureID));
       glDeleteTextures(1, &TextureID);
+      rStateShadow.onDeleteTexture(TextureID);
     }
     pGUITexture->mIsValid = false;
     return;
@@ -778,61 +1147,10 @@ namespace OpenGLHelper
     return Vector[0];
   }
 
-  void restoreGLBit(GLenum const WhichBit, bool const Value)
-  {
-    if (Value)
-    {
-      glEnable(WhichBit);
-    }
-    else
-    {
-      glDisable(WhichBit);
-    }
-  }
-
-  COpenGLState::COpenGLState(void)
-  {
-    // store current texture
-    glGetIntegerv(GL_TEXTURE_BINDING_2D, &mOldTexture);
-
-    // store other settings
-    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
-
-    // store projection matrix
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-
-    // store view matrix
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-
-    return;
-  }
-
-  COpenGLState::~COpenGLState(void)
-  {
-    // restore view matrix
-    glMatrixMode(GL_MODELVIEW);
-    glPopMatrix();
-
-    // restore projection matrix
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
-
-    // restore other settings
-    glPopAttrib();
-
-    // restore texture
-    glBindTexture(GL_TEXTURE_2D, mOldTexture);
-
-    return;
-  }
-
 }
 
 }
 }
 }
 
-
-#endif // _IRRIMGUI_NATIVE_OPENGL_
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
@@ -33,8 +33,6 @@
  * @addtogroup IrrIMGUIPrivate
  */
 
-#ifdef _IRRIMGUI_NATIVE_OPENGL_
-
 #ifndef IRRIMGUI_SOURCE_COPENGLIMGUIDRIVER_H_
 #define IRRIMGUI_SOURCE_COPENGLIMGUIDRIVER_H_
 
@@ -47,11 +45,17 @@
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #include <IrrIMGUI/IrrIMGUI.h>
 #include "IIMGUIDriver.h"
+#include "private/CStagingBuffer.h"
 
 namespace IrrIMGUI
 {
 namespace Private
 {
+namespace OpenGL
+{
+  class CBufferObjectStream;
+  class CStateShadow;
+}
 
 /// @brief Contains driver classes for the IMGUI render system.
 namespace Driver
@@ -63,7 +67,7 @@ namespace Driver
   {
     friend class IrrIMGUI::Private::IIMGUIDriver;
     public:
-    private:
+    protected:
       /// @{
       /// @name Constructor and Destructor
 
@@ -76,6 +80,49 @@ namespace Driver
 
       /// @}
 
+      /// @{
+      /// @name Methods shared with the OpenGL 3.3 driver.
+
+      /// @brief Uploads the geometry of all command lists into the streaming buffer objects, which stay bound afterwards.
+      ///        The vertices of every list follow the vertices of the list before, the indices of every list start at a multiple
+      ///        of OpenGL::getStreamedIndexBytes(...) of the lists before.
+      /// @param pDrawData is a list of data to draw.
+      /// @return Returns the number of uploaded bytes. When it is 0, the frame has no geometry and no buffer has been bound.
+      static size_t uploadFrame(ImDrawData * pDrawData);
+
+      /// @brief Returns the indices of a command list in a format, that OpenGL can draw.
+      /// @param pCommandList      is the command list.
+      /// @param rIs32BitIndexData is set to true, when the returned indices are 32 bit indices instead of ImDrawIdx elements.
+      /// @return Returns a pointer to the indices. Restored indices are only valid until this method is called again.
+      static void const * getIndexData(ImDrawList * pCommandList, bool &rIs32BitIndexData);
+
+      /// @brief Sets the scissor rectangle of a draw command, when it differs from the rectangle, that is already applied.
+      /// @param rClippingRect     is the clipping rectangle of the draw command.
+      /// @param FrameBufferHeight is the height of the frame buffer in pixels.
+      static void applyScissorRect(ImVec4 const &rClippingRect, float FrameBufferHeight);
+
+      /// @brief Forgets the applied scissor rectangle (must be called at the start of a frame and after user callbacks).
+      static void invalidateScissorRect(void);
+
+      /// @brief Counts the rendered frames and shrinks the staging buffers to the size needed in the last period, when the period is over.
+      static void shrinkStagingBuffers(void);
+
+      /// @brief Forgets the OpenGL state values, that have been read by the state shadow.
+      virtual void invalidateHostState(void);
+
+      /// @brief The vertex and index buffer objects, that stream the geometry of a frame. It is nullptr, when the OpenGL context does not support buffer objects.
+      static OpenGL::CBufferObjectStream * mpBufferObjectStream;
+
+      /// @brief The shadow of the OpenGL state, that is changed by this driver.
+      static OpenGL::CStateShadow * mpStateShadow;
+
+      /// @brief When this is true, alpha textures (like the font texture) are created as single channel red textures, since core profiles
+      ///        do not support GL_ALPHA textures. A swizzle mask returns the red channel as alpha value.
+      static bool mIsAlphaInRedChannel;
+
+      /// @}
+
+    private:
       /// @{
       /// @name Methods used for setup.
 
@@ -91,9 +138,16 @@ namespace Driver
       /// @param pDrawData is a list of data to draw.
       static void drawGUIList(ImDrawData * pDrawData);
 
+      /// @brief Uploads the geometry of all command lists into the streaming buffer objects and draws them from there.
+      /// @param pDrawData is a list of data to draw.
+      static void drawStreamedFrame(ImDrawData * pDrawData);
+
       /// @brief Renders a single command list.
-      /// @param pCommandList is the list of commands to render.
-      static void drawCommandList(ImDrawList * pCommandList);
+      /// @param pCommandList     is the list of commands to render.
+      /// @param pVertexData      is the address of the first vertex. When a vertex buffer object is bound, it is the offset inside this buffer.
+      /// @param pIndexData       is the address of the first index. When an index buffer object is bound, it is the offset inside this buffer.
+      /// @param Is32BitIndexData is true, when pIndexData contains 32 bit indices instead of ImDrawIdx elements.
+      static void drawCommandList(ImDrawList * pCommandList, void const * pVertexData, void const * pIndexData, bool Is32BitIndexData);
 
       /// @}
 
@@ -140,6 +194,17 @@ namespace Driver
       /// @param pTexture    Is a pointer to an Irrlicht image object.
       virtual void updateTexture(IGUITexture * pGUITexture, irr::video::ITexture * pTexture);
 
+      /// @brief Writes raw data into a rectangle of a GUI texture without recreating the texture.
+      /// @param pGUITexture Is a pointer to the GUI texture object.
+      /// @param ColorFormat Is the format of the Color of every Pixel.
+      /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+      /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+      /// @param X           Is the left border of the rectangle inside the texture.
+      /// @param Y           Is the upper border of the rectangle inside the texture.
+      /// @param Width       Is the number of Pixels in X direction.
+      /// @param Height      Is the number of Pixels in Y direction.
+      virtual void updateTextureRegion(IGUITexture * pGUITexture, EColorFormat ColorFormat, irr::u8 const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height);
+
       /// @brief Updates a GUI texture with the currently loaded fonts.
       /// @param pGUITexture Is a pointer to the GUI texture object.
       virtual void updateFontTexture(IGUITexture * pGUITexture);
@@ -152,6 +217,21 @@ namespace Driver
 
       /// @}
 
+      /// @brief A buffer for the restored indices of command lists, which 16 bit indices have overflown.
+      static CStagingBuffer<irr::u32> mUnwrappedIndexBuffer;
+
+      /// @brief A buffer for images, that are converted before they are copied into a texture. It is reused for every texture.
+      static CStagingBuffer<irr::u32> mImageBuffer;
+
+      /// @brief Counts the rendered frames until the staging buffers are shrunk.
+      static irr::u32 mFramesSinceShrink;
+
+      /// @brief The scissor rectangle, that has been applied by applyScissorRect(...).
+      static ImVec4 mScissorRect;
+
+      /// @brief Is true, when mScissorRect is the current scissor rectangle of OpenGL.
+      static bool   mIsScissorRectApplied;
+
   };
 
 }
@@ -164,5 +244,3 @@ namespace Driver
 
 
 #endif /* IRRIMGUI_SOURCE_COPENGLIMGUIDRIVER_H_ */
-
-#endif // _IRRIMGUI_NATIVE_OPENGL_
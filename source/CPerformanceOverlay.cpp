@@ -0,0 +1,134 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CPerformanceOverlay.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a small window, that shows the render statistics of the GUI.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cfloat>
+
+// module includes
+#include "private/CPerformanceOverlay.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @brief The size of a graph in pixels.
+  ImVec2 const GraphSize(240.0f, 40.0f);
+
+  /// @brief The window flags of the overlay. It does not take any input, thus it never changes the behavior of the GUI.
+  ImGuiWindowFlags const OverlayWindowFlags =
+      ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar |
+      ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs;
+}
+
+  CPerformanceOverlay::CPerformanceOverlay(void):
+    mNextValue(0),
+    mLastFrame(-1),
+    mpDrawList(nullptr)
+  {
+    for (irr::u32 i = 0; i < NumberOfGraphValues; i++)
+    {
+      mFrameTimes[i] = 0.0f;
+      mGUITimes[i]   = 0.0f;
+    }
+
+    return;
+  }
+
+  void CPerformanceOverlay::build(SIMGUIStatistics const &rStatistics, SIMGUIStatisticsSummary const &rSummary)
+  {
+    int const Frame = ImGui::GetFrameCount();
+    if (Frame == mLastFrame)
+    {
+      return;
+    }
+    mLastFrame = Frame;
+
+    irr::f32 const FrameTime = ImGui::GetIO().DeltaTime * 1000.0f;
+    irr::f32 const GUITime   = rStatistics.mNewFrameTime + rStatistics.mRenderTime + rStatistics.mConversionTime + rStatistics.mSubmissionTime;
+
+    mFrameTimes[mNextValue] = FrameTime;
+    mGUITimes[mNextValue]   = GUITime;
+    mNextValue = (mNextValue + 1) % NumberOfGraphValues;
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiSetCond_Always);
+    ImGui::Begin("##IrrIMGUIPerformanceOverlay", nullptr, OverlayWindowFlags);
+
+    ImGui::Text("Frame %6.2f ms (%.0f FPS)", FrameTime, (FrameTime > 0.0f) ? (1000.0f / FrameTime) : 0.0f);
+    ImGui::PlotLines("##FrameTime", mFrameTimes, NumberOfGraphValues, mNextValue, nullptr, 0.0f, FLT_MAX, GraphSize);
+
+    ImGui::Text("GUI CPU %6.3f ms (p99 %.3f ms)", GUITime, rSummary.mTotalTime.mPercentile99);
+    ImGui::PlotLines("##GUITime", mGUITimes, NumberOfGraphValues, mNextValue, nullptr, 0.0f, FLT_MAX, GraphSize);
+
+    ImGui::Text("Draw calls %u, commands %u", rStatistics.mNumberOfDrawCalls, rStatistics.mNumberOfDrawCommands);
+    ImGui::Text("Vertices %u, indices %u", rStatistics.mNumberOfVertices, rStatistics.mNumberOfIndices);
+    ImGui::Text("Conversion %.3f ms (%u KiB)", rStatistics.mConversionTime, rStatistics.mNumberOfConvertedBytes / 1024);
+    ImGui::Text("Textures %.2f MiB", static_cast<irr::f32>(rStatistics.mTextureMemory) / (1024.0f * 1024.0f));
+
+    mpDrawList = ImGui::GetWindowDrawList();
+    ImGui::End();
+
+    return;
+  }
+
+  ImDrawList * CPerformanceOverlay::removeDrawList(ImDrawData * const pDrawData)
+  {
+    ImDrawList * const pDrawList = mpDrawList;
+    mpDrawList = nullptr;
+
+    if ((pDrawList == nullptr) || (pDrawData == nullptr) || (pDrawData->CmdListsCount == 0))
+    {
+      return nullptr;
+    }
+
+    for (int i = 0; i < pDrawData->CmdListsCount; i++)
+    {
+      if (pDrawData->CmdLists[i] == pDrawList)
+      {
+        // the order of the other lists must be kept, since it is the order of the windows on the screen
+        for (int j = i + 1; j < pDrawData->CmdListsCount; j++)
+        {
+          pDrawData->CmdLists[j - 1] = pDrawData->CmdLists[j];
+        }
+
+        pDrawData->CmdListsCount--;
+        pDrawData->TotalVtxCount -= pDrawList->VtxBuffer.size();
+        pDrawData->TotalIdxCount -= pDrawList->IdxBuffer.size();
+
+        return pDrawList;
+      }
+    }
+
+    return nullptr;
+  }
+
+}
+}
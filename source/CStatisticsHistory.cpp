@@ -0,0 +1,193 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CStatisticsHistory.cpp
+ * @author Andre Netzeband
+ * @brief  Contains the render statistics of the last frames.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+
+// module includes
+#include "private/CStatisticsHistory.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @brief Returns the value of a sorted array, that is not exceeded by a percentage of all values (nearest rank).
+  /// @param rSortedValues Is the sorted array, it must not be empty.
+  /// @param Percentage    Is the percentage between 0 and 100.
+  irr::f32 getPercentile(std::vector<irr::f32> const &rSortedValues, irr::u32 const Percentage)
+  {
+    size_t const NumberOfValues = rSortedValues.size();
+    size_t Rank = (NumberOfValues * Percentage + 99) / 100;
+
+    if (Rank < 1)
+    {
+      Rank = 1;
+    }
+
+    return rSortedValues[Rank - 1];
+  }
+
+  irr::f32 getNumberOfCommandLists(SIMGUIStatistics const &rStatistics)     { return static_cast<irr::f32>(rStatistics.mNumberOfCommandLists); }
+  irr::f32 getNumberOfVertices(SIMGUIStatistics const &rStatistics)         { return static_cast<irr::f32>(rStatistics.mNumberOfVertices); }
+  irr::f32 getNumberOfIndices(SIMGUIStatistics const &rStatistics)          { return static_cast<irr::f32>(rStatistics.mNumberOfIndices); }
+  irr::f32 getNumberOfDrawCommands(SIMGUIStatistics const &rStatistics)     { return static_cast<irr::f32>(rStatistics.mNumberOfDrawCommands); }
+  irr::f32 getNumberOfDrawCalls(SIMGUIStatistics const &rStatistics)        { return static_cast<irr::f32>(rStatistics.mNumberOfDrawCalls); }
+  irr::f32 getNumberOfMaterialSwitches(SIMGUIStatistics const &rStatistics) { return static_cast<irr::f32>(rStatistics.mNumberOfMaterialSwitches); }
+  irr::f32 getNumberOfClipChanges(SIMGUIStatistics const &rStatistics)      { return static_cast<irr::f32>(rStatistics.mNumberOfClipChanges); }
+  irr::f32 getNumberOfConvertedBytes(SIMGUIStatistics const &rStatistics)   { return static_cast<irr::f32>(rStatistics.mNumberOfConvertedBytes); }
+  irr::f32 getNewFrameTime(SIMGUIStatistics const &rStatistics)             { return rStatistics.mNewFrameTime; }
+  irr::f32 getRenderTime(SIMGUIStatistics const &rStatistics)               { return rStatistics.mRenderTime; }
+  irr::f32 getConversionTime(SIMGUIStatistics const &rStatistics)           { return rStatistics.mConversionTime; }
+  irr::f32 getSubmissionTime(SIMGUIStatistics const &rStatistics)           { return rStatistics.mSubmissionTime; }
+
+  irr::f32 getTotalTime(SIMGUIStatistics const &rStatistics)
+  {
+    return rStatistics.mNewFrameTime + rStatistics.mRenderTime + rStatistics.mConversionTime + rStatistics.mSubmissionTime;
+  }
+}
+
+  CStatisticsHistory::CStatisticsHistory(void):
+    mMaxNumberOfFrames(0),
+    mNextFrame(0),
+    mIsSummaryValid(true)
+  {
+    return;
+  }
+
+  void CStatisticsHistory::setNumberOfFrames(irr::u32 const NumberOfFrames)
+  {
+    if (NumberOfFrames != mMaxNumberOfFrames)
+    {
+      mMaxNumberOfFrames = NumberOfFrames;
+      clear();
+      mFrames.reserve(mMaxNumberOfFrames);
+    }
+
+    return;
+  }
+
+  irr::u32 CStatisticsHistory::getNumberOfFrames(void) const
+  {
+    return mMaxNumberOfFrames;
+  }
+
+  void CStatisticsHistory::addFrame(SIMGUIStatistics const &rStatistics)
+  {
+    if (mMaxNumberOfFrames == 0)
+    {
+      return;
+    }
+
+    if (mFrames.size() < mMaxNumberOfFrames)
+    {
+      mFrames.push_back(rStatistics);
+    }
+    else
+    {
+      mFrames[mNextFrame] = rStatistics;
+    }
+
+    mNextFrame      = (mNextFrame + 1) % mMaxNumberOfFrames;
+    mIsSummaryValid = false;
+
+    return;
+  }
+
+  void CStatisticsHistory::clear(void)
+  {
+    mFrames.clear();
+    mNextFrame = 0;
+    mSummary.reset();
+    mIsSummaryValid = true;
+    return;
+  }
+
+  SIMGUIStatisticsSummary const &CStatisticsHistory::getSummary(void)
+  {
+    if (mIsSummaryValid)
+    {
+      return mSummary;
+    }
+
+    mSummary.mNumberOfFrames = static_cast<irr::u32>(mFrames.size());
+
+    summarize(getNumberOfCommandLists,     mSummary.mNumberOfCommandLists);
+    summarize(getNumberOfVertices,         mSummary.mNumberOfVertices);
+    summarize(getNumberOfIndices,          mSummary.mNumberOfIndices);
+    summarize(getNumberOfDrawCommands,     mSummary.mNumberOfDrawCommands);
+    summarize(getNumberOfDrawCalls,        mSummary.mNumberOfDrawCalls);
+    summarize(getNumberOfMaterialSwitches, mSummary.mNumberOfMaterialSwitches);
+    summarize(getNumberOfClipChanges,      mSummary.mNumberOfClipChanges);
+    summarize(getNumberOfConvertedBytes,   mSummary.mNumberOfConvertedBytes);
+    summarize(getNewFrameTime,             mSummary.mNewFrameTime);
+    summarize(getRenderTime,               mSummary.mRenderTime);
+    summarize(getConversionTime,           mSummary.mConversionTime);
+    summarize(getSubmissionTime,           mSummary.mSubmissionTime);
+    summarize(getTotalTime,                mSummary.mTotalTime);
+
+    mIsSummaryValid = true;
+
+    return mSummary;
+  }
+
+  void CStatisticsHistory::summarize(TValueFunction const pValueFunction, SIMGUIStatisticValue &rValue)
+  {
+    rValue.reset();
+
+    if (mFrames.empty())
+    {
+      return;
+    }
+
+    mSortedValues.resize(mFrames.size());
+
+    // the sum is calculated in double precision, since the times of many frames are added
+    double Sum = 0.0;
+    for (size_t i = 0; i < mFrames.size(); i++)
+    {
+      mSortedValues[i] = pValueFunction(mFrames[i]);
+      Sum += mSortedValues[i];
+    }
+
+    std::sort(mSortedValues.begin(), mSortedValues.end());
+
+    rValue.mAverage      = static_cast<irr::f32>(Sum / mFrames.size());
+    rValue.mMedian       = getPercentile(mSortedValues, 50);
+    rValue.mPercentile95 = getPercentile(mSortedValues, 95);
+    rValue.mPercentile99 = getPercentile(mSortedValues, 99);
+    rValue.mMaximum      = mSortedValues.back();
+
+    return;
+  }
+
+}
+}
@@ -0,0 +1,304 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CTriangleClipper.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a class that clips triangles at clipping rectangles on the CPU.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+
+// module includes
+#include "private/CTriangleClipper.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @brief The maximum number of vertices, that can be addressed with 16 bit indices.
+  irr::u32 const MaxBatchVertices = 0x10000;
+
+  /// @brief A triangle, that is cut at four borders, has at most 7 corners.
+  irr::u32 const MaxCutCorners = 7;
+
+  /// @brief Flags for the borders of the clipping rectangle, that a vertex lies outside of.
+  enum EOutside
+  {
+    EO_LEFT   = 1,
+    EO_RIGHT  = 2,
+    EO_TOP    = 4,
+    EO_BOTTOM = 8
+  };
+
+  /// @brief Interpolates all attributes of two vertices.
+  /// @param rStart  Is the vertex at Factor 0.
+  /// @param rEnd    Is the vertex at Factor 1.
+  /// @param Factor  Is the position between both vertices.
+  /// @return Returns the interpolated vertex.
+  irr::video::S3DVertex interpolateVertex(irr::video::S3DVertex const &rStart, irr::video::S3DVertex const &rEnd, irr::f32 const Factor)
+  {
+    irr::video::S3DVertex Vertex;
+    Vertex.Pos.X     = rStart.Pos.X     + (rEnd.Pos.X     - rStart.Pos.X)     * Factor;
+    Vertex.Pos.Y     = rStart.Pos.Y     + (rEnd.Pos.Y     - rStart.Pos.Y)     * Factor;
+    Vertex.Pos.Z     = rStart.Pos.Z     + (rEnd.Pos.Z     - rStart.Pos.Z)     * Factor;
+    Vertex.Normal    = rStart.Normal;
+    Vertex.Color     = rEnd.Color.getInterpolated(rStart.Color, Factor);
+    Vertex.TCoords.X = rStart.TCoords.X + (rEnd.TCoords.X - rStart.TCoords.X) * Factor;
+    Vertex.TCoords.Y = rStart.TCoords.Y + (rEnd.TCoords.Y - rStart.TCoords.Y) * Factor;
+    return Vertex;
+  }
+
+  /// @brief Cuts a convex polygon at a border (Sutherland-Hodgman algorithm).
+  /// @param pInput          Is a pointer to the corners of the polygon.
+  /// @param NumberOfCorners Is the number of corners of the polygon.
+  /// @param pOutput         Is a pointer to the corners of the cut polygon (at least NumberOfCorners+1 elements).
+  /// @param Distance        Is a function, that returns the distance of a vertex to the border (positive inside).
+  /// @return Returns the number of corners of the cut polygon.
+  template <typename TDistance>
+  irr::u32 cutPolygon(irr::video::S3DVertex const * const pInput, irr::u32 const NumberOfCorners, irr::video::S3DVertex * const pOutput, TDistance Distance)
+  {
+    irr::u32 NumberOfOutputCorners = 0;
+
+    for (irr::u32 i = 0; i < NumberOfCorners; i++)
+    {
+      irr::video::S3DVertex const &rStart = pInput[i];
+      irr::video::S3DVertex const &rEnd   = pInput[(i + 1) % NumberOfCorners];
+      irr::f32 const StartDistance = Distance(rStart);
+      irr::f32 const EndDistance   = Distance(rEnd);
+
+      if (StartDistance >= 0.0f)
+      {
+        pOutput[NumberOfOutputCorners++] = rStart;
+      }
+
+      if ((StartDistance >= 0.0f) != (EndDistance >= 0.0f))
+      {
+        pOutput[NumberOfOutputCorners++] = interpolateVertex(rStart, rEnd, StartDistance / (StartDistance - EndDistance));
+      }
+    }
+
+    return NumberOfOutputCorners;
+  }
+}
+
+  CTriangleClipper::CTriangleClipper(void):
+    mpSourceVertices(nullptr),
+    mNumberOfSourceVertices(0),
+    mOffset(0.0f, 0.0f, 0.0f),
+    mClipLeft(0.0f),
+    mClipTop(0.0f),
+    mClipRight(0.0f),
+    mClipBottom(0.0f),
+    mBatchNumber(0),
+    mNumberOfCutTriangles(0),
+    mNumberOfRemovedTriangles(0)
+  {
+    return;
+  }
+
+  void CTriangleClipper::begin(irr::video::S3DVertex const * const pVertices, irr::u32 const NumberOfVertices, irr::core::vector3df const &rOffset)
+  {
+    mpSourceVertices          = pVertices;
+    mNumberOfSourceVertices   = NumberOfVertices;
+    mOffset                   = rOffset;
+    mNumberOfCutTriangles     = 0;
+    mNumberOfRemovedTriangles = 0;
+
+    // the batch number marks the source vertices, that have already been copied into this batch
+    if (mBatchNumbers.size() < NumberOfVertices)
+    {
+      mBatchNumbers.resize(NumberOfVertices, 0);
+      mBatchIndices.resize(NumberOfVertices, 0);
+    }
+
+    startNextBatch();
+
+    return;
+  }
+
+  void CTriangleClipper::startNextBatch(void)
+  {
+    mVertices.clear();
+    mIndices.clear();
+
+    // every batch has its own number, thus the batch indices of the source vertices must not be cleared
+    mBatchNumber++;
+    if (mBatchNumber == 0)
+    {
+      std::fill(mBatchNumbers.begin(), mBatchNumbers.end(), 0);
+      mBatchNumber = 1;
+    }
+
+    return;
+  }
+
+  irr::u32 CTriangleClipper::addTriangles(irr::u16 const * const pIndices, irr::u32 const NumberOfIndices, ImVec4 const &rClippingRect)
+  {
+    return addTrianglesOfType(pIndices, NumberOfIndices, rClippingRect);
+  }
+
+  irr::u32 CTriangleClipper::addTriangles(irr::u32 const * const pIndices, irr::u32 const NumberOfIndices, ImVec4 const &rClippingRect)
+  {
+    return addTrianglesOfType(pIndices, NumberOfIndices, rClippingRect);
+  }
+
+  irr::video::S3DVertex const * CTriangleClipper::getVertices(void) const
+  {
+    return mVertices.data();
+  }
+
+  irr::u32 CTriangleClipper::getNumberOfVertices(void) const
+  {
+    return mVertices.size();
+  }
+
+  irr::u16 const * CTriangleClipper::getIndices(void) const
+  {
+    return mIndices.data();
+  }
+
+  irr::u32 CTriangleClipper::getNumberOfIndices(void) const
+  {
+    return mIndices.size();
+  }
+
+  irr::u32 CTriangleClipper::getNumberOfCutTriangles(void) const
+  {
+    return mNumberOfCutTriangles;
+  }
+
+  irr::u32 CTriangleClipper::getNumberOfRemovedTriangles(void) const
+  {
+    return mNumberOfRemovedTriangles;
+  }
+
+  template <typename TIndex>
+  irr::u32 CTriangleClipper::addTrianglesOfType(TIndex const * const pIndices, irr::u32 const NumberOfIndices, ImVec4 const &rClippingRect)
+  {
+    FASSERT(mpSourceVertices != nullptr);
+
+    // the vertices contain already the offset, thus it is also applied to the clipping rectangle
+    mClipLeft   = rClippingRect.x + mOffset.X;
+    mClipTop    = rClippingRect.y + mOffset.Y;
+    mClipRight  = rClippingRect.z + mOffset.X;
+    mClipBottom = rClippingRect.w + mOffset.Y;
+
+    irr::u32 i = 0;
+    for (; (i + 3) <= NumberOfIndices; i += 3)
+    {
+      if ((mVertices.size() + MaxCutCorners) > MaxBatchVertices)
+      {
+        // the batch is full
+        break;
+      }
+
+      irr::u32 Outside[3];
+      for (irr::u32 Corner = 0; Corner < 3; Corner++)
+      {
+        FASSERT(pIndices[i + Corner] < mNumberOfSourceVertices);
+        irr::core::vector3df const &rPosition = mpSourceVertices[pIndices[i + Corner]].Pos;
+
+        Outside[Corner] = ((rPosition.X < mClipLeft)   ? EO_LEFT   : 0) |
+                          ((rPosition.X > mClipRight)  ? EO_RIGHT  : 0) |
+                          ((rPosition.Y < mClipTop)    ? EO_TOP    : 0) |
+                          ((rPosition.Y > mClipBottom) ? EO_BOTTOM : 0);
+      }
+
+      if ((Outside[0] | Outside[1] | Outside[2]) == 0)
+      {
+        // the triangle is completely inside
+        mIndices.push_back(getBatchIndex(pIndices[i + 0]));
+        mIndices.push_back(getBatchIndex(pIndices[i + 1]));
+        mIndices.push_back(getBatchIndex(pIndices[i + 2]));
+      }
+      else if ((Outside[0] & Outside[1] & Outside[2]) != 0)
+      {
+        // all corners are outside of the same border
+        mNumberOfRemovedTriangles++;
+      }
+      else
+      {
+        addCutTriangle(&pIndices[i]);
+        mNumberOfCutTriangles++;
+      }
+    }
+
+    return i;
+  }
+
+  irr::u16 CTriangleClipper::getBatchIndex(irr::u32 const SourceIndex)
+  {
+    if (mBatchNumbers[SourceIndex] != mBatchNumber)
+    {
+      mBatchNumbers[SourceIndex] = mBatchNumber;
+      mBatchIndices[SourceIndex] = static_cast<irr::u16>(mVertices.size());
+      mVertices.push_back(mpSourceVertices[SourceIndex]);
+    }
+
+    return mBatchIndices[SourceIndex];
+  }
+
+  template <typename TIndex>
+  void CTriangleClipper::addCutTriangle(TIndex const * const pIndices)
+  {
+    irr::video::S3DVertex Corners[MaxCutCorners + 1];
+    irr::video::S3DVertex CutCorners[MaxCutCorners + 1];
+
+    Corners[0] = mpSourceVertices[pIndices[0]];
+    Corners[1] = mpSourceVertices[pIndices[1]];
+    Corners[2] = mpSourceVertices[pIndices[2]];
+    irr::u32 NumberOfCorners = 3;
+
+    NumberOfCorners = cutPolygon(Corners,    NumberOfCorners, CutCorners, [this](irr::video::S3DVertex const &rVertex) { return rVertex.Pos.X - mClipLeft;   });
+    NumberOfCorners = cutPolygon(CutCorners, NumberOfCorners, Corners,    [this](irr::video::S3DVertex const &rVertex) { return mClipRight - rVertex.Pos.X;  });
+    NumberOfCorners = cutPolygon(Corners,    NumberOfCorners, CutCorners, [this](irr::video::S3DVertex const &rVertex) { return rVertex.Pos.Y - mClipTop;    });
+    NumberOfCorners = cutPolygon(CutCorners, NumberOfCorners, Corners,    [this](irr::video::S3DVertex const &rVertex) { return mClipBottom - rVertex.Pos.Y; });
+
+    if (NumberOfCorners < 3)
+    {
+      return;
+    }
+
+    // the cut triangle is convex, thus it is added as triangle fan
+    irr::u16 const FirstIndex = static_cast<irr::u16>(mVertices.size());
+    mVertices.insert(mVertices.end(), &Corners[0], &Corners[NumberOfCorners]);
+
+    for (irr::u32 Corner = 1; (Corner + 1) < NumberOfCorners; Corner++)
+    {
+      mIndices.push_back(FirstIndex);
+      mIndices.push_back(static_cast<irr::u16>(FirstIndex + Corner));
+      mIndices.push_back(static_cast<irr::u16>(FirstIndex + Corner + 1));
+    }
+
+    return;
+  }
+
+}
+}
@@ -0,0 +1,121 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CVertexConverter.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a converter, that converts the vertices of several IMGUI command lists in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "private/CVertexConverter.h"
+#include "private/IrrIMGUISIMD_priv.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace
+{
+  /// @brief The maximum number of vertices, that are converted by a single task.
+  irr::u32 const VerticesPerChunk = 4096;
+
+  /// @brief Below this number of vertices the worker threads are not used.
+  irr::u32 const MinParallelVertices = 16384;
+}
+
+  CVertexConverter::CVertexConverter(void):
+    mNumberOfVertices(0)
+  {
+    return;
+  }
+
+  void CVertexConverter::setNumberOfThreads(irr::u32 const NumberOfThreads)
+  {
+    mWorkerPool.setNumberOfThreads(NumberOfThreads);
+    return;
+  }
+
+  irr::u32 CVertexConverter::getNumberOfThreads(void) const
+  {
+    return mWorkerPool.getNumberOfThreads();
+  }
+
+  void CVertexConverter::addVertices(ImDrawVert * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertices)
+  {
+    for (irr::u32 FirstVertex = 0; FirstVertex < NumberOfVertices; FirstVertex += VerticesPerChunk)
+    {
+      SChunk Chunk;
+      Chunk.mpSource          = &pSource[FirstVertex];
+      Chunk.mpDestination     = (pDestination != nullptr) ? &pDestination[FirstVertex] : nullptr;
+      Chunk.mNumberOfVertices = ((NumberOfVertices - FirstVertex) < VerticesPerChunk) ? (NumberOfVertices - FirstVertex) : VerticesPerChunk;
+      mChunks.push_back(Chunk);
+    }
+
+    mNumberOfVertices += NumberOfVertices;
+
+    return;
+  }
+
+  void CVertexConverter::convert(irr::core::vector3df const &rOffset)
+  {
+    if (mNumberOfVertices >= MinParallelVertices)
+    {
+      mWorkerPool.run(mChunks.size(), [&](irr::u32 const ChunkIndex)
+      {
+        convertChunk(mChunks[ChunkIndex], rOffset);
+      });
+    }
+    else
+    {
+      for (SChunk const &rChunk : mChunks)
+      {
+        convertChunk(rChunk, rOffset);
+      }
+    }
+
+    mChunks.clear();
+    mNumberOfVertices = 0;
+
+    return;
+  }
+
+  irr::u32 CVertexConverter::getNumberOfVertices(void) const
+  {
+    return mNumberOfVertices;
+  }
+
+  void CVertexConverter::convertChunk(SChunk const &rChunk, irr::core::vector3df const &rOffset)
+  {
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    SIMD::convertVerticesInPlace(rChunk.mpSource, rChunk.mNumberOfVertices, rOffset);
+#else
+    SIMD::convertVertices(rChunk.mpSource, rChunk.mpDestination, rChunk.mNumberOfVertices, rOffset);
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    return;
+  }
+
+}
+}
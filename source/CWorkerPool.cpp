@@ -0,0 +1,237 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CWorkerPool.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a pool of worker threads, that execute a number of tasks in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "private/CWorkerPool.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  CWorkerPool::CWorkerPool(void):
+    mpTask(nullptr),
+    mNumberOfTasks(0),
+    mNextTask(0),
+    mNumberOfFinishedTasks(0),
+    mNumberOfActiveWorkers(0),
+    mJobNumber(0),
+    mIsStopped(false),
+    mRequestedNumberOfThreads(1)
+  {
+    return;
+  }
+
+  CWorkerPool::~CWorkerPool(void)
+  {
+    stopWorkers();
+    return;
+  }
+
+  void CWorkerPool::setNumberOfThreads(irr::u32 NumberOfThreads)
+  {
+    if (NumberOfThreads == mRequestedNumberOfThreads)
+    {
+      return;
+    }
+
+    mRequestedNumberOfThreads = NumberOfThreads;
+
+    if (NumberOfThreads == 0)
+    {
+      NumberOfThreads = std::thread::hardware_concurrency();
+    }
+
+    if (NumberOfThreads == 0)
+    {
+      // the number of cores is unknown
+      NumberOfThreads = 1;
+    }
+
+    if (NumberOfThreads == getNumberOfThreads())
+    {
+      return;
+    }
+
+    stopWorkers();
+
+    LOG_NOTE("{IrrIMGUI} Start " << std::dec << (NumberOfThreads - 1) << " worker threads.\n");
+
+    for (irr::u32 i = 1; i < NumberOfThreads; i++)
+    {
+      mWorkers.push_back(std::thread(&CWorkerPool::runWorker, this));
+    }
+
+    return;
+  }
+
+  irr::u32 CWorkerPool::getNumberOfThreads(void) const
+  {
+    return mWorkers.size() + 1;
+  }
+
+  void CWorkerPool::run(irr::u32 const NumberOfTasks, Task const &rTask)
+  {
+    if (mWorkers.empty() || (NumberOfTasks <= 1))
+    {
+      for (irr::u32 TaskIndex = 0; TaskIndex < NumberOfTasks; TaskIndex++)
+      {
+        rTask(TaskIndex);
+      }
+
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> Lock(mMutex);
+      mpTask                 = &rTask;
+      mNumberOfTasks         = NumberOfTasks;
+      mNumberOfFinishedTasks = 0;
+      mNextTask.store(0);
+      mJobNumber++;
+    }
+    mJobStarted.notify_all();
+
+    irr::u32 const NumberOfExecutedTasks = executeTasks(rTask, NumberOfTasks);
+
+    {
+      // the task and the task counter are only reused for the next job, when no worker thread uses them anymore
+      std::unique_lock<std::mutex> Lock(mMutex);
+      mNumberOfFinishedTasks += NumberOfExecutedTasks;
+      mJobFinished.wait(Lock, [this]() { return (mNumberOfFinishedTasks == mNumberOfTasks) && (mNumberOfActiveWorkers == 0); });
+      mpTask         = nullptr;
+      mNumberOfTasks = 0;
+    }
+
+    return;
+  }
+
+  void CWorkerPool::runWorker(void)
+  {
+    irr::u32 LastJobNumber = 0;
+
+    {
+      std::lock_guard<std::mutex> Lock(mMutex);
+      LastJobNumber = mJobNumber;
+    }
+
+    while (true)
+    {
+      Task const * pTask         = nullptr;
+      irr::u32     NumberOfTasks = 0;
+
+      {
+        std::unique_lock<std::mutex> Lock(mMutex);
+        mJobStarted.wait(Lock, [&]() { return mIsStopped || (mJobNumber != LastJobNumber); });
+
+        if (mIsStopped)
+        {
+          return;
+        }
+
+        LastJobNumber = mJobNumber;
+
+        if (mpTask == nullptr)
+        {
+          // the thread woke up too late, the job has already been finished by the other threads
+          continue;
+        }
+
+        // the job is copied under the lock, thus the thread always works on one and the same job
+        pTask         = mpTask;
+        NumberOfTasks = mNumberOfTasks;
+        mNumberOfActiveWorkers++;
+      }
+
+      irr::u32 const NumberOfExecutedTasks = executeTasks(*pTask, NumberOfTasks);
+      bool IsJobFinished = false;
+
+      {
+        std::lock_guard<std::mutex> Lock(mMutex);
+
+        // only tasks of the current job are counted (run() waits for all active workers, thus it is always the same job)
+        if (LastJobNumber == mJobNumber)
+        {
+          mNumberOfFinishedTasks += NumberOfExecutedTasks;
+        }
+
+        mNumberOfActiveWorkers--;
+        IsJobFinished = (mNumberOfFinishedTasks == mNumberOfTasks) && (mNumberOfActiveWorkers == 0);
+      }
+
+      if (IsJobFinished)
+      {
+        mJobFinished.notify_one();
+      }
+    }
+  }
+
+  irr::u32 CWorkerPool::executeTasks(Task const &rTask, irr::u32 const NumberOfTasks)
+  {
+    irr::u32 NumberOfExecutedTasks = 0;
+
+    while (true)
+    {
+      irr::u32 const TaskIndex = mNextTask.fetch_add(1);
+      if (TaskIndex >= NumberOfTasks)
+      {
+        break;
+      }
+
+      rTask(TaskIndex);
+      NumberOfExecutedTasks++;
+    }
+
+    return NumberOfExecutedTasks;
+  }
+
+  void CWorkerPool::stopWorkers(void)
+  {
+    {
+      std::lock_guard<std::mutex> Lock(mMutex);
+      mIsStopped = true;
+    }
+    mJobStarted.notify_all();
+
+    for (std::thread &rWorker : mWorkers)
+    {
+      rWorker.join();
+    }
+
+    mWorkers.clear();
+    mIsStopped = false;
+
+    return;
+  }
+
+}
+}
@@ -29,14 +29,21 @@
  */
 
 // library includes
+#include <algorithm>
 #include <iostream>
 
 // module includes
 #include <IrrIMGUI/IrrIMGUI.h>
 #include "IIMGUIDriver.h"
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
 #include "COpenGLIMGUIDriver.h"
+#include "COpenGL3IMGUIDriver.h"
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
 #include "CIrrlichtIMGUIDriver.h"
+#include "private/CGUILayer.h"
+#include "private/CGUITexture.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUIProfiler_priv.h"
 #include <IrrIMGUI/IrrIMGUIConstants.h>
 
 /**
@@ -50,17 +57,38 @@ namespace Private
 {
 
   IIMGUIDriver *        IIMGUIDriver::mpInstance = nullptr;
+  ERenderBackend        IIMGUIDriver::mRenderBackend = ERB_DEFAULT;
   irr::u32              IIMGUIDriver::mInstances = 0;
   irr::IrrlichtDevice * IIMGUIDriver::mpDevice   = nullptr;
   SIMGUISettings        IIMGUIDriver::mSettings;
   IGUITexture         * IIMGUIDriver::mpFontTexture = nullptr;
   irr::u32              IIMGUIDriver::mTextureInstances = 0;
+  SIMGUIStatistics      IIMGUIDriver::mStatistics;
+  EBlendMode            IIMGUIDriver::mBlendMode = EBM_STANDARD;
+  bool                  IIMGUIDriver::mIsDrawDataRepeated = false;
+  CGUILayer           * IIMGUIDriver::mpGUILayer = nullptr;
+  irr::video::ITexture * IIMGUIDriver::mpRenderTarget = nullptr;
+  CDrawDataPipeline   * IIMGUIDriver::mpPipeline = nullptr;
+  CDrawDataPipeline::SFrame const  * IIMGUIDriver::mpPipelineFrame   = nullptr;
+  CDrawDataPipeline::PrepareFunction IIMGUIDriver::mpPrepareFunction = nullptr;
+  CStatisticsHistory    IIMGUIDriver::mStatisticsHistory;
+  irr::f32              IIMGUIDriver::mNewFrameTime = 0.0f;
+  CPerformanceOverlay   IIMGUIDriver::mPerformanceOverlay;
+  irr::u32              IIMGUIDriver::mTextureMemory = 0;
+  ImDrawData            IIMGUIDriver::mRenderedDrawData;
+  irr::u32              IIMGUIDriver::mNumberOfTextureAllocations = 0;
+  irr::u32              IIMGUIDriver::mNumberOfTextureUploads = 0;
 
   IIMGUIDriver::IIMGUIDriver(irr::IrrlichtDevice * const pDevice)
   {
     LOG_NOTE("{IrrIMGUI} Create Singleton Instance of IIMGUIDriver.\n");
     mInstances++;
     mTextureInstances = 0;
+    mStatistics.reset();
+    mStatisticsHistory.clear();
+    mNewFrameTime = 0.0f;
+    mNumberOfTextureAllocations = 0;
+    mNumberOfTextureUploads     = 0;
 
     FASSERT(mInstances == 1);
 
@@ -93,35 +121,40 @@ namespace Private
     return;
   }
 
-  IIMGUIDriver * IIMGUIDriver::getInstance(irr::IrrlichtDevice * const pDevice)
+  IIMGUIDriver * IIMGUIDriver::getInstance(irr::IrrlichtDevice * const pDevice, SIMGUISettings const * const pSettings)
   {
 
     if (mpInstance == nullptr)
     {
-#ifdef _IRRIMGUI_NATIVE_OPENGL_
-      irr::video::IVideoDriver * pDriver = pDevice->getVideoDriver();
-      irr::video::E_DRIVER_TYPE Type = pDriver->getDriverType();
+      ERenderBackend const RequestedBackend = (pSettings != nullptr) ? pSettings->mRenderBackend : ERB_DEFAULT;
+      mRenderBackend = selectRenderBackend(pDevice, RequestedBackend);
 
-      switch(Type)
+      switch (mRenderBackend)
       {
-        case irr::video::EDT_NULL: // for unit testing
-        case irr::video::EDT_OPENGL:
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+        case ERB_OPENGL3:
+          LOG_NOTE("{IrrIMGUI} Use the OpenGL 3.3 render backend.\n");
+          mpInstance = new Driver::COpenGL3IMGUIDriver(pDevice);
+          break;
+
+        case ERB_OPENGL:
+          LOG_NOTE("{IrrIMGUI} Use the OpenGL render backend.\n");
           mpInstance = new Driver::COpenGLIMGUIDriver(pDevice);
-          mpFontTexture = mpInstance->createFontTexture();
           break;
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
 
+        case ERB_IRRLICHT:
         default:
-          LOG_ERROR("Unknown driver type" << Type << "\n");
-          FASSERT(false);
+          LOG_NOTE("{IrrIMGUI} Use the Irrlicht render backend.\n");
+          mpInstance = new Driver::CIrrlichtIMGUIDriver(pDevice);
           break;
       }
-#else
-
-      mpInstance = new Driver::CIrrlichtIMGUIDriver(pDevice);
-      mpFontTexture = mpInstance->createFontTexture();
-
-#endif
 
+      {
+        CProfilerZone const Zone(EPZ_CREATE_TEXTURE);
+        mpFontTexture = mpInstance->createFontTexture();
+      }
+      setTextureSize(mpFontTexture, ImGui::GetIO().Fonts->TexWidth, ImGui::GetIO().Fonts->TexHeight);
     }
 
     ASSERT(mpInstance != nullptr);
@@ -129,6 +162,61 @@ namespace Private
     return mpInstance;
   }
 
+  ERenderBackend IIMGUIDriver::selectRenderBackend(irr::IrrlichtDevice * const pDevice, ERenderBackend const RequestedBackend)
+  {
+    ERenderBackend Backend = RequestedBackend;
+
+    if (Backend == ERB_DEFAULT)
+    {
+#ifdef _IRRIMGUI_NATIVE_OPENGL_
+      Backend = ERB_OPENGL;
+#else
+      Backend = ERB_IRRLICHT;
+#endif // _IRRIMGUI_NATIVE_OPENGL_
+    }
+
+#ifndef _IRRIMGUI_OPENGL_BACKENDS_
+    if ((Backend == ERB_OPENGL) || (Backend == ERB_OPENGL3))
+    {
+      LOG_WARNING("{IrrIMGUI} The OpenGL render backends have not been built into the library, use the Irrlicht render backend instead.\n");
+      Backend = ERB_IRRLICHT;
+    }
+#else
+    if (Backend == ERB_OPENGL3)
+    {
+      if (!Driver::COpenGL3IMGUIDriver::isSupported(pDevice))
+      {
+        LOG_WARNING("{IrrIMGUI} The OpenGL 3.3 render backend needs an OpenGL 3.3 context, use the OpenGL render backend instead.\n");
+        Backend = ERB_OPENGL;
+      }
+      else if (!Driver::COpenGL3IMGUIDriver::createShaderPipeline())
+      {
+        LOG_WARNING("{IrrIMGUI} The shader pipeline of the OpenGL 3.3 render backend cannot be created, use the OpenGL render backend instead.\n");
+        Backend = ERB_OPENGL;
+      }
+    }
+
+    if (Backend == ERB_OPENGL)
+    {
+      irr::video::E_DRIVER_TYPE const Type = pDevice->getVideoDriver()->getDriverType();
+
+      switch (Type)
+      {
+        case irr::video::EDT_NULL: // for unit testing
+        case irr::video::EDT_OPENGL:
+          break;
+
+        default:
+          LOG_WARNING("{IrrIMGUI} The OpenGL render backend cannot be used with the driver type " << Type << ", use the Irrlicht render backend instead.\n");
+          Backend = ERB_IRRLICHT;
+          break;
+      }
+    }
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
+
+    return Backend;
+  }
+
   bool IIMGUIDriver::deleteInstance(void)
   {
     bool WasDeleted = false;
@@ -137,9 +225,24 @@ namespace Private
     {
       LOG_NOTE("{IrrIMGUI} Delete Singleton Instance of IIMGUIDriver.\n");
 
+      // delete GUI layer and render pipeline
+      delete(mpGUILayer);
+      mpGUILayer = nullptr;
+      mpRenderTarget = nullptr;
+      mBlendMode = EBM_STANDARD;
+      mIsDrawDataRepeated = false;
+      delete(mpPipeline);
+      mpPipeline = nullptr;
+      mpPrepareFunction = nullptr;
+
       // delete font texture
-      mpInstance->deleteTexture(mpFontTexture);
-      mpFontTexture = nullptr;
+      {
+        CProfilerZone const Zone(EPZ_DELETE_TEXTURE);
+        setTextureSize(mpFontTexture, 0, 0);
+        mpInstance->deleteTexture(mpFontTexture);
+        mpFontTexture = nullptr;
+        mTextureMemory = 0;
+      }
 
       // delete instance
       delete(mpInstance);
@@ -171,6 +274,301 @@ namespace Private
     return mSettings;
   }
 
+  SIMGUIStatistics const &IIMGUIDriver::getStatistics(void)
+  {
+    return mStatistics;
+  }
+
+  SIMGUIStatisticsSummary const &IIMGUIDriver::getStatisticsSummary(void)
+  {
+    return mStatisticsHistory.getSummary();
+  }
+
+  void IIMGUIDriver::setNewFrameTime(irr::f32 const NewFrameTime)
+  {
+    mNewFrameTime = NewFrameTime;
+    return;
+  }
+
+  irr::f32 IIMGUIDriver::getMillisecondsSince(std::chrono::steady_clock::time_point const &rStart)
+  {
+    return std::chrono::duration<irr::f32, std::milli>(std::chrono::steady_clock::now() - rStart).count();
+  }
+
+  ERenderBackend IIMGUIDriver::getRenderBackend(void)
+  {
+    return mRenderBackend;
+  }
+
+  EBlendMode IIMGUIDriver::getBlendMode(void)
+  {
+    return mBlendMode;
+  }
+
+  void IIMGUIDriver::setBlendMode(EBlendMode const BlendMode)
+  {
+    mBlendMode = BlendMode;
+    return;
+  }
+
+  bool IIMGUIDriver::isDrawDataRepeated(void)
+  {
+    return mIsDrawDataRepeated;
+  }
+
+  void IIMGUIDriver::setDrawDataRepeated(bool const IsRepeated)
+  {
+    mIsDrawDataRepeated = IsRepeated;
+    return;
+  }
+
+  void IIMGUIDriver::drawGUI(void)
+  {
+    bool const IsPipelineUsed = mSettings.mIsPipelinedRenderingEnabled && (mpPrepareFunction != nullptr);
+
+    if (!IsPipelineUsed && (mpPipeline != nullptr))
+    {
+      delete(mpPipeline);
+      mpPipeline = nullptr;
+      mStatistics.mPipelineLatency  = 0.0f;
+      mStatistics.mPipelineWaitTime = 0.0f;
+    }
+
+    if (!mSettings.mIsGUILayerEnabled && (mpGUILayer != nullptr))
+    {
+      delete(mpGUILayer);
+      mpGUILayer = nullptr;
+    }
+
+    if (IsPipelineUsed && (mpPipeline == nullptr))
+    {
+      mpPipeline = new CDrawDataPipeline(mpPrepareFunction);
+    }
+
+    if (mSettings.mIsGUILayerEnabled && (mpGUILayer == nullptr))
+    {
+      mpGUILayer = new CGUILayer(this);
+      mStatistics.mNumberOfCachedLayerFrames   = 0;
+      mStatistics.mNumberOfRenderedLayerFrames = 0;
+    }
+
+    // the draw data is only created here, the pipeline and the GUI layer decide what must be rendered
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+    void (* const pRenderFunction)(ImDrawData *) = rGUIIO.RenderDrawListsFn;
+
+    if (mSettings.mIsPerformanceOverlayEnabled)
+    {
+      drawPerformanceOverlay();
+    }
+
+    std::chrono::steady_clock::time_point const RenderStart = std::chrono::steady_clock::now();
+    {
+      CProfilerZone const Zone(EPZ_RENDER);
+
+      // IMGUI does not call the render function, when there is nothing to render
+      mRenderedDrawData.CmdLists      = nullptr;
+      mRenderedDrawData.CmdListsCount = 0;
+      mRenderedDrawData.TotalVtxCount = 0;
+      mRenderedDrawData.TotalIdxCount = 0;
+
+      rGUIIO.RenderDrawListsFn = IIMGUIDriver::storeDrawData;
+      ImGui::Render();
+      rGUIIO.RenderDrawListsFn = pRenderFunction;
+    }
+    irr::f32 const RenderTime = getMillisecondsSince(RenderStart);
+
+    ImDrawData * pDrawData = &mRenderedDrawData;
+    bool const HasDrawData = (pDrawData->CmdListsCount > 0);
+
+    // the overlay is rendered after the GUI, thus it is neither counted by the statistics nor cached by the GUI layer
+    ImDrawList * const pOverlayDrawList = mPerformanceOverlay.removeDrawList(pDrawData);
+
+    if ((mpPipeline == nullptr) && (mpGUILayer == nullptr) && !HasDrawData)
+    {
+      // IMGUI has nothing to render in this frame (like ImGui::Render() does not call the driver in this case)
+      mStatistics.reset();
+      mStatistics.mNewFrameTime = mNewFrameTime;
+      mStatistics.mRenderTime   = RenderTime;
+      mStatistics.mTextureMemory              = mTextureMemory;
+      mStatistics.mNumberOfTextureAllocations = mNumberOfTextureAllocations;
+      mStatistics.mNumberOfTextureUploads     = mNumberOfTextureUploads;
+      mNumberOfTextureAllocations = 0;
+      mNumberOfTextureUploads     = 0;
+      mStatisticsHistory.setNumberOfFrames(mSettings.mNumberOfStatisticFrames);
+      mStatisticsHistory.addFrame(mStatistics);
+      return;
+    }
+
+    if (mpPipeline != nullptr)
+    {
+      CDrawDataPipeline::SFrame * const pFrame = mpPipeline->push(pDrawData);
+      pDrawData       = &pFrame->mDrawData;
+      mpPipelineFrame = pFrame;
+    }
+
+    {
+      // the drivers accumulate the statistics over all render passes of the frame (the GUI layer renders up to three times),
+      // but the layer statistics are counted over all frames
+      irr::u32 const NumberOfCachedLayerFrames   = mStatistics.mNumberOfCachedLayerFrames;
+      irr::u32 const NumberOfRenderedLayerFrames = mStatistics.mNumberOfRenderedLayerFrames;
+      mStatistics.reset();
+      mStatistics.mNumberOfCachedLayerFrames   = NumberOfCachedLayerFrames;
+      mStatistics.mNumberOfRenderedLayerFrames = NumberOfRenderedLayerFrames;
+    }
+
+    std::chrono::steady_clock::time_point const SubmissionStart = std::chrono::steady_clock::now();
+
+    {
+      CProfilerZone const Zone(EPZ_SUBMISSION);
+
+      if (mpGUILayer != nullptr)
+      {
+        bool const IsCached = mpGUILayer->draw(pDrawData, pRenderFunction);
+
+        mStatistics.mNumberOfCachedLayerFrames   += (IsCached ? 1 : 0);
+        mStatistics.mNumberOfRenderedLayerFrames += (IsCached ? 0 : 1);
+      }
+      else
+      {
+        pRenderFunction(pDrawData);
+      }
+    }
+
+    irr::f32 const SubmissionTime = getMillisecondsSince(SubmissionStart);
+
+    if (mpPipeline != nullptr)
+    {
+      mpPipelineFrame = nullptr;
+      mStatistics.mPipelineLatency  = mpPipeline->getLatency();
+      mStatistics.mPipelineWaitTime = mpPipeline->getWaitTime();
+    }
+
+    // the conversion is measured by the drivers for every render pass, with pipelined rendering it has been done on the worker thread
+    irr::f32 const SubmittedConversionTime = (mpPipeline != nullptr) ? 0.0f : mStatistics.mConversionTime;
+
+    if (pDrawData->CmdListsCount > 0)
+    {
+      mStatistics.mNumberOfCommandLists = static_cast<irr::u32>(pDrawData->CmdListsCount);
+      mStatistics.mNumberOfVertices     = static_cast<irr::u32>(pDrawData->TotalVtxCount);
+      mStatistics.mNumberOfIndices      = static_cast<irr::u32>(pDrawData->TotalIdxCount);
+    }
+
+    mStatistics.mNewFrameTime   = mNewFrameTime;
+    mStatistics.mRenderTime     = RenderTime;
+    mStatistics.mSubmissionTime = std::max(SubmissionTime - SubmittedConversionTime, 0.0f);
+
+    mStatistics.mTextureMemory              = mTextureMemory;
+    mStatistics.mNumberOfTextureAllocations = mNumberOfTextureAllocations;
+    mStatistics.mNumberOfTextureUploads     = mNumberOfTextureUploads;
+    mNumberOfTextureAllocations = 0;
+    mNumberOfTextureUploads     = 0;
+
+    mStatisticsHistory.setNumberOfFrames(mSettings.mNumberOfStatisticFrames);
+    mStatisticsHistory.addFrame(mStatistics);
+
+    if (pOverlayDrawList != nullptr)
+    {
+      drawPerformanceOverlayList(pOverlayDrawList, pRenderFunction);
+    }
+
+    return;
+  }
+
+  void IIMGUIDriver::drawPerformanceOverlayList(ImDrawList * const pDrawList, void (* const pRenderFunction)(ImDrawData *))
+  {
+    // the overlay is not counted by the statistics of the frame
+    SIMGUIStatistics const Statistics = mStatistics;
+
+    ImDrawList * pOverlay = pDrawList;
+    ImDrawData   OverlayData;
+    OverlayData.CmdLists      = &pOverlay;
+    OverlayData.CmdListsCount = 1;
+    OverlayData.TotalVtxCount = pDrawList->VtxBuffer.size();
+    OverlayData.TotalIdxCount = pDrawList->IdxBuffer.size();
+
+    pRenderFunction(&OverlayData);
+
+    mStatistics = Statistics;
+
+    return;
+  }
+
+  void IIMGUIDriver::storeDrawData(ImDrawData * const pDrawData)
+  {
+    mRenderedDrawData.CmdLists      = pDrawData->CmdLists;
+    mRenderedDrawData.CmdListsCount = pDrawData->CmdListsCount;
+    mRenderedDrawData.TotalVtxCount = pDrawData->TotalVtxCount;
+    mRenderedDrawData.TotalIdxCount = pDrawData->TotalIdxCount;
+    return;
+  }
+
+  void IIMGUIDriver::drawPerformanceOverlay(void)
+  {
+    mPerformanceOverlay.build(mStatistics, mStatisticsHistory.getSummary());
+    return;
+  }
+
+  void IIMGUIDriver::setTextureSize(IGUITexture * const pGUITexture, irr::u32 const Width, irr::u32 const Height)
+  {
+    if (pGUITexture == nullptr)
+    {
+      return;
+    }
+
+    CGUITexture * const pRealTexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    FASSERT(pRealTexture);
+
+    irr::u32 const SizeInBytes = Width * Height * 4;
+
+    mTextureMemory = mTextureMemory - pRealTexture->mSizeInBytes + SizeInBytes;
+    pRealTexture->mSizeInBytes = SizeInBytes;
+    pRealTexture->mWidth       = Width;
+    pRealTexture->mHeight      = Height;
+
+    return;
+  }
+
+  void IIMGUIDriver::invalidateGUILayer(void)
+  {
+    if (mpGUILayer != nullptr)
+    {
+      mpGUILayer->invalidate();
+    }
+
+    return;
+  }
+
+  void IIMGUIDriver::setRenderTarget(irr::video::ITexture * const pRenderTarget)
+  {
+    mpRenderTarget = pRenderTarget;
+    return;
+  }
+
+  irr::video::ITexture * IIMGUIDriver::getRenderTarget(void)
+  {
+    return mpRenderTarget;
+  }
+
+  void IIMGUIDriver::invalidateHostState(void)
+  {
+    return;
+  }
+
+  void IIMGUIDriver::flushPipeline(void)
+  {
+    if (mpPipeline != nullptr)
+    {
+      mpPipeline->flush();
+    }
+
+    return;
+  }
+
+  CDrawDataPipeline::SFrame const * IIMGUIDriver::getPipelineFrame(void)
+  {
+    return mpPipelineFrame;
+  }
+
   void IIMGUIDriver::setSettings(SIMGUISettings const &rSettings)
   {
     mSettings = rSettings;
@@ -244,7 +642,9 @@ namespace Private
   {
     FASSERT(mpFontTexture != nullptr);
 
+    CProfilerZone const Zone(EPZ_UPDATE_TEXTURE);
     updateFontTexture(mpFontTexture);
+    setTextureSize(mpFontTexture, ImGui::GetIO().Fonts->TexWidth, ImGui::GetIO().Fonts->TexHeight);
 
     return;
   }
@@ -39,9 +39,15 @@
  */
 
 // library includes
+#include <chrono>
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #include <IrrIMGUI/IrrIMGUI.h>
 
+// module includes
+#include "private/CDrawDataPipeline.h"
+#include "private/CPerformanceOverlay.h"
+#include "private/CStatisticsHistory.h"
+
 namespace IrrIMGUI
 {
 /// @brief Private definitions for the IMGUI Irrlicht binding. Do not use them outside, the interface may change a lot of times!
@@ -59,6 +65,23 @@ namespace Private
     ECF_A8
   };
 
+  /// @brief The blend modes, that are used by the drivers to render the GUI.
+  enum EBlendMode
+  {
+    /// @brief The GUI is blended over the content of the render target.
+    EBM_STANDARD,
+    /// @brief Like EBM_STANDARD, but the alpha channel of the render target is not written. It keeps the value 0 for the
+    ///        accumulation by EBM_ACCUMULATE_ALPHA (used to render the colors of the GUI into the GUI layer texture).
+    EBM_COLOR_ONLY,
+    /// @brief Only the alpha channel of the render target is written. The alpha values of the GUI are accumulated like
+    ///        the alpha values of premultiplied colors (used to render the GUI into the GUI layer texture).
+    EBM_ACCUMULATE_ALPHA,
+    /// @brief The colors of the textures are already multiplied with their alpha value (used to draw the GUI layer texture).
+    EBM_PREMULTIPLIED_ALPHA
+  };
+
+  class CGUILayer;
+
   /// @brief Interface for an IMGUI Driver to setup the IMGUI render system.
   /// @note  This is a singleton class, since IMGUI is a single instance system.
   class IIMGUIDriver
@@ -75,10 +98,12 @@ namespace Private
       /// @{
       /// @name Instance handling
 
-      /// @brief This method returns an instance of the driver. If no driver yet exists, it will create a new driver by it's own choice. Otherwise it will simply return the instance of the existing driver.
-      /// @param pDevice is a pointer to the Irrlicht Device to use.
+      /// @brief This method returns an instance of the driver. If no driver yet exists, it will create a new driver for the render backend of the settings.
+      ///        Otherwise it will simply return the instance of the existing driver.
+      /// @param pDevice   is a pointer to the Irrlicht Device to use.
+      /// @param pSettings is a pointer to the settings, that select the render backend. When it is nullptr, ERB_DEFAULT is used.
       /// @return Returns a pointer to the instance.
-      static IIMGUIDriver * getInstance(irr::IrrlichtDevice * pDevice);
+      static IIMGUIDriver * getInstance(irr::IrrlichtDevice * pDevice, SIMGUISettings const * pSettings = nullptr);
 
       /// @brief Tells the driver, that it is not needed anymore. It decided by it's own if it will delete the single instance or exist further. When the instance was deleted.
       /// @return Returns true, if the instance was destroyed by this calls. If there was not instance, or if the instance has not been destroyed, it will return false.
@@ -98,6 +123,65 @@ namespace Private
       /// @param rSettings is a reference of the new settings to apply. The settings will applied to the global IMGUI object.
       static void setSettings(SIMGUISettings const &rSettings);
 
+      /// @return Returns a constant reference to the render statistics of the last frame.
+      static SIMGUIStatistics const &getStatistics(void);
+
+      /// @return Returns a constant reference to the averages and percentiles of the render statistics of the last frames.
+      static SIMGUIStatisticsSummary const &getStatisticsSummary(void);
+
+      /// @param NewFrameTime Is the time in milliseconds of ImGui::NewFrame() in the current frame. It is added to the statistics of the frame.
+      static void setNewFrameTime(irr::f32 NewFrameTime);
+
+      /// @param rStart Is a point in time.
+      /// @return Returns the time in milliseconds, that has passed since this point in time.
+      static irr::f32 getMillisecondsSince(std::chrono::steady_clock::time_point const &rStart);
+
+      /// @return Returns the render backend of the driver instance.
+      static ERenderBackend getRenderBackend(void);
+
+      /// @return Returns the blend mode, that must be used by the driver to render the GUI.
+      static EBlendMode getBlendMode(void);
+
+      /// @param BlendMode Is the blend mode, that must be used by the driver to render the GUI.
+      static void setBlendMode(EBlendMode BlendMode);
+
+      /// @return Returns true, when the render function draws the same draw data like in the call before. The vertices of
+      ///         the draw data have already been converted by this call and must not be converted again.
+      static bool isDrawDataRepeated(void);
+
+      /// @param IsRepeated Is true, when the next calls of the render function draw the same draw data like the call before.
+      static void setDrawDataRepeated(bool IsRepeated);
+
+      /// @}
+
+      /// @{
+      /// @name Render methods
+
+      /// @brief Renders the GUI of the current frame. When the GUI layer is enabled, the GUI is only rendered into the
+      ///        GUI layer texture, when it has changed since the last frame. When pipelined rendering is enabled,
+      ///        the GUI of the frame before is rendered.
+      void drawGUI(void);
+
+      /// @brief Forces the GUI layer to render the GUI again in the next frame (for example because a texture has been updated).
+      static void invalidateGUILayer(void);
+
+      /// @brief Sets the render target, that is bound while the GUI is drawn. The GUI layer binds it again after it has updated its texture.
+      /// @param pRenderTarget Is the render target texture or nullptr for the frame buffer.
+      static void setRenderTarget(irr::video::ITexture * pRenderTarget);
+
+      /// @return Returns the render target, that is bound while the GUI is drawn (nullptr is the frame buffer).
+      static irr::video::ITexture * getRenderTarget(void);
+
+      /// @brief Forgets the state of the graphic API, that has been read before the GUI changed it. Drivers, that do not read it, ignore this call.
+      virtual void invalidateHostState(void);
+
+      /// @brief Builds the performance overlay window for the current frame (must be called between ImGui::NewFrame() and drawGUI()).
+      static void drawPerformanceOverlay(void);
+
+      /// @brief Removes the frame, that waits inside the render pipeline. Must be called before a texture is deleted,
+      ///        that might be used by this frame.
+      static void flushPipeline(void);
+
       /// @}
 
       /// @{
@@ -151,6 +235,18 @@ namespace Private
       /// @param pTexture    Is a pointer to an Irrlicht image object.
       virtual void updateTexture(IGUITexture * pGUITexture, irr::video::ITexture * pTexture) = 0;
 
+      /// @brief Writes raw data into a rectangle of a GUI texture without recreating the texture.
+      /// @param pGUITexture Is a pointer to the GUI texture object.
+      /// @param ColorFormat Is the format of the Color of every Pixel.
+      /// @param pPixelData  Is a pointer to the first pixel of the rectangle.
+      /// @param Pitch       Is the number of bytes between the begin of two rows in pPixelData.
+      /// @param X           Is the left border of the rectangle inside the texture.
+      /// @param Y           Is the upper border of the rectangle inside the texture.
+      /// @param Width       Is the number of Pixels in X direction.
+      /// @param Height      Is the number of Pixels in Y direction.
+      /// @note  The rectangle must be inside the texture.
+      virtual void updateTextureRegion(IGUITexture * pGUITexture, EColorFormat ColorFormat, irr::u8 const * pPixelData, irr::u32 Pitch, irr::u32 X, irr::u32 Y, irr::u32 Width, irr::u32 Height) = 0;
+
       /// @brief Updates a GUI texture with the currently loaded fonts.
       /// @param pGUITexture Is a pointer to the GUI texture object.
       virtual void updateFontTexture(IGUITexture * pGUITexture) = 0;
@@ -161,6 +257,13 @@ namespace Private
        */
       virtual void deleteTexture(IGUITexture * pGUITexture) = 0;
 
+      /// @brief Sets the size of a GUI texture for the texture memory statistics (see SIMGUIStatistics::mTextureMemory)
+      ///        and for the range check of region updates (see updateTextureRegion).
+      /// @param pGUITexture Is a pointer to the GUI texture object.
+      /// @param Width       Is the number of Pixels in X direction. Use 0, when the texture is deleted.
+      /// @param Height      Is the number of Pixels in Y direction. Use 0, when the texture is deleted.
+      static void setTextureSize(IGUITexture * pGUITexture, irr::u32 Width, irr::u32 Height);
+
       /// @}
 
     protected:
@@ -176,17 +279,58 @@ namespace Private
       /// @brief Setups the keyboard controls to fit to Irrlicht.
       void setupKeyControl(void);
 
+      /// @return Returns the frame of the render pipeline, that is currently rendered, or nullptr when the GUI is not rendered by the pipeline.
+      static CDrawDataPipeline::SFrame const * getPipelineFrame(void);
+
       static irr::u32              mTextureInstances;
+      static SIMGUIStatistics      mStatistics;
+
+      /// @brief The number of allocated GPU textures since the last frame (see SIMGUIStatistics::mNumberOfTextureAllocations).
+      static irr::u32              mNumberOfTextureAllocations;
+
+      /// @brief The number of in place texture updates since the last frame (see SIMGUIStatistics::mNumberOfTextureUploads).
+      static irr::u32              mNumberOfTextureUploads;
+
+      /// @brief The function, that prepares a frame of the render pipeline on the worker thread. When a driver does not
+      ///        set this function, pipelined rendering is not supported by this driver.
+      static CDrawDataPipeline::PrepareFunction mpPrepareFunction;
 
     private:
       /// @brief Updated the settings of IMGUI.
       static void updateSettings(void);
 
+      /// @brief Resolves ERB_DEFAULT and falls back to ERB_OPENGL or ERB_IRRLICHT, when a backend cannot be used with the video driver.
+      /// @param pDevice          is a pointer to the Irrlicht Device to use.
+      /// @param RequestedBackend is the render backend from the settings.
+      /// @return Returns the render backend, that can be used.
+      static ERenderBackend selectRenderBackend(irr::IrrlichtDevice * pDevice, ERenderBackend RequestedBackend);
+
+      /// @brief Renders the draw list of the performance overlay, without changing the render statistics of the frame.
+      /// @param pDrawList       Is the draw list of the overlay window.
+      /// @param pRenderFunction Is the render function of the driver.
+      static void drawPerformanceOverlayList(ImDrawList * pDrawList, void (*pRenderFunction)(ImDrawData *));
+
+      /// @brief Is called by ImGui::Render() instead of the render function of the driver and stores the draw data.
+      /// @param pDrawData Is the draw data of the frame. It is only valid until ImGui::Render() returns, but not the command lists.
+      static void storeDrawData(ImDrawData * pDrawData);
+
       static irr::IrrlichtDevice * mpDevice;
       static IIMGUIDriver        * mpInstance;
+      static ERenderBackend        mRenderBackend;
       static irr::u32              mInstances;
       static SIMGUISettings        mSettings;
       static IGUITexture         * mpFontTexture;
+      static EBlendMode            mBlendMode;
+      static bool                  mIsDrawDataRepeated;
+      static CGUILayer           * mpGUILayer;
+      static irr::video::ITexture * mpRenderTarget;
+      static CDrawDataPipeline   * mpPipeline;
+      static CDrawDataPipeline::SFrame const * mpPipelineFrame;
+      static CStatisticsHistory    mStatisticsHistory;
+      static irr::f32              mNewFrameTime;
+      static CPerformanceOverlay   mPerformanceOverlay;
+      static irr::u32              mTextureMemory;
+      static ImDrawData            mRenderedDrawData;
 
   };
 
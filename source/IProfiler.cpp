@@ -0,0 +1,63 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IProfiler.cpp
+ * @author Andre Netzeband
+ * @brief  Contains an interface to measure the frame phases of IrrIMGUI with an own profiler.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <IrrIMGUI/IProfiler.h>
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+
+  char const * getProfilerZoneName(EProfilerZone const Zone)
+  {
+    switch (Zone)
+    {
+      case EPZ_START_GUI:           return "StartGUI";
+      case EPZ_UPDATE_FRAME_VALUES: return "UpdateFrameValues";
+      case EPZ_NEW_FRAME:           return "NewFrame";
+      case EPZ_DRAW_ALL:            return "DrawAll";
+      case EPZ_RENDER:              return "Render";
+      case EPZ_CONVERSION:          return "Conversion";
+      case EPZ_SUBMISSION:          return "Submission";
+      case EPZ_CREATE_TEXTURE:      return "CreateTexture";
+      case EPZ_UPDATE_TEXTURE:      return "UpdateTexture";
+      case EPZ_DELETE_TEXTURE:      return "DeleteTexture";
+      default:                      return "Unknown";
+    }
+  }
+
+}
+
+/**
+ * @}
+ */
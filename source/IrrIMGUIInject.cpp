@@ -28,6 +28,9 @@
  * @addtogroup IrrIMGUIInject
  */
 
+// library includes
+#include <atomic>
+
 // module includes
 #include <IrrIMGUI/IrrIMGUI.h>
 #include <IrrIMGUI/Inject/IrrIMGUIInject.h>
@@ -71,6 +74,20 @@ namespace Inject
     return pIMGUIFactoryFunction;
   }
 
+  /// @brief Stores the profiler, that receives the zones of IrrIMGUI. It is read by the render thread and the worker thread of the render pipeline.
+  static std::atomic<IProfiler *> pProfilerInstance(nullptr);
+
+  void setProfiler(IProfiler * pProfiler)
+  {
+    pProfilerInstance.store(pProfiler, std::memory_order_release);
+    return;
+  }
+
+  IProfiler * getProfiler(void)
+  {
+    return pProfilerInstance.load(std::memory_order_acquire);
+  }
+
 }
 
   IIMGUIHandle * createIMGUI(irr::IrrlichtDevice * pDevice, CIMGUIEventStorage * pEventStorage, SIMGUISettings const * pSettings)
@@ -0,0 +1,651 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IrrIMGUIOpenGL.cpp
+ * @author Andre Netzeband
+ * @brief  Contains OpenGL definitions and helpers, that are shared by the native OpenGL render drivers.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+
+// library includes
+#include <cstdio>
+#include <stdint.h>
+#if defined(__APPLE__)
+#include <dlfcn.h>
+#endif // __APPLE__
+
+// module includes
+#include "private/IrrIMGUIOpenGL_priv.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUIIndices_priv.h"
+
+#if !defined(_IRRIMGUI_WINDOWS_) && !defined(__APPLE__)
+// declared here instead of including GL/glx.h, since the X11 headers define macros like None, Status or Bool
+extern "C" void (*glXGetProcAddressARB(GLubyte const * pProcName))(void);
+#endif
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace OpenGL
+{
+
+  void * getFunctionAddress(char const * const pName)
+  {
+#if defined(_IRRIMGUI_WINDOWS_)
+    void * const pFunction = reinterpret_cast<void *>(wglGetProcAddress(pName));
+
+    // some Windows drivers return small error codes instead of nullptr
+    intptr_t const ErrorCode = reinterpret_cast<intptr_t>(pFunction);
+    if ((ErrorCode >= -1) && (ErrorCode <= 3))
+    {
+      return nullptr;
+    }
+
+    return pFunction;
+#elif defined(__APPLE__)
+    return dlsym(RTLD_DEFAULT, pName);
+#else
+    return reinterpret_cast<void *>(glXGetProcAddressARB(reinterpret_cast<GLubyte const *>(pName)));
+#endif
+  }
+
+  bool getVersion(int &rMajor, int &rMinor)
+  {
+    char const * const pVersion = reinterpret_cast<char const *>(glGetString(GL_VERSION));
+    rMajor = 0;
+    rMinor = 0;
+
+    if (!pVersion)
+    {
+      return false;
+    }
+
+    // the version string starts with "<major>.<minor>", followed by vendor specific information
+    return (std::sscanf(pVersion, "%d.%d", &rMajor, &rMinor) == 2);
+  }
+
+  bool isUsing32BitIndices(ImDrawList const * const pCommandList)
+  {
+    // the 16 bit indices of lists with more than 65536 vertices have overflown and are restored as 32 bit indices
+    return (sizeof(ImDrawIdx) == sizeof(irr::u32)) || (pCommandList->VtxBuffer.size() > static_cast<int>(Indices::MaxBatchIndexRange + 1));
+  }
+
+  size_t getStreamedIndexBytes(ImDrawList const * const pCommandList)
+  {
+    size_t const IndexSize  = isUsing32BitIndices(pCommandList) ? sizeof(irr::u32) : sizeof(ImDrawIdx);
+    size_t const IndexBytes = pCommandList->IdxBuffer.size() * IndexSize;
+
+    return (IndexBytes + sizeof(irr::u32) - 1) & ~(sizeof(irr::u32) - 1);
+  }
+
+  CBufferObjectStream * CBufferObjectStream::createStream(irr::video::IVideoDriver * const pDriver, CStateShadow &rStateShadow)
+  {
+    if (pDriver->getDriverType() != irr::video::EDT_OPENGL)
+    {
+      return nullptr;
+    }
+
+    if (!pDriver->queryFeature(irr::video::EVDF_VERTEX_BUFFER_OBJECT))
+    {
+      return nullptr;
+    }
+
+    CBufferObjectStream * const pStream = new CBufferObjectStream();
+
+    bool IsLoaded = true;
+    IsLoaded = loadFunction(pStream->mpGenBuffers,    "glGenBuffers")    && IsLoaded;
+    IsLoaded = loadFunction(pStream->mpDeleteBuffers, "glDeleteBuffers") && IsLoaded;
+    IsLoaded = loadFunction(pStream->mpBindBuffer,    "glBindBuffer")    && IsLoaded;
+    IsLoaded = loadFunction(pStream->mpBufferData,    "glBufferData")    && IsLoaded;
+    IsLoaded = loadFunction(pStream->mpBufferSubData, "glBufferSubData") && IsLoaded;
+
+    if (!IsLoaded)
+    {
+      delete pStream;
+      return nullptr;
+    }
+
+    pStream->mpGenBuffers(1, &pStream->mVertexBuffer);
+    pStream->mpGenBuffers(1, &pStream->mIndexBuffer);
+
+    rStateShadow.setBindBufferFunction(pStream->mpBindBuffer);
+
+    return pStream;
+  }
+
+  CBufferObjectStream::CBufferObjectStream(void):
+    mpGenBuffers(nullptr),
+    mpDeleteBuffers(nullptr),
+    mpBindBuffer(nullptr),
+    mpBufferData(nullptr),
+    mpBufferSubData(nullptr),
+    mVertexBuffer(0),
+    mIndexBuffer(0),
+    mVertexBufferSize(0),
+    mIndexBufferSize(0)
+  {
+    return;
+  }
+
+  CBufferObjectStream::~CBufferObjectStream(void)
+  {
+    if (mpDeleteBuffers && mVertexBuffer)
+    {
+      mpDeleteBuffers(1, &mVertexBuffer);
+    }
+
+    if (mpDeleteBuffers && mIndexBuffer)
+    {
+      mpDeleteBuffers(1, &mIndexBuffer);
+    }
+
+    return;
+  }
+
+  size_t CBufferObjectStream::getBufferSize(size_t const Bytes, size_t const CurrentSize)
+  {
+    size_t const MinimumBufferSize = 65536;
+    size_t NewSize = (CurrentSize > 0) ? CurrentSize : MinimumBufferSize;
+
+    while (NewSize < Bytes)
+    {
+      NewSize *= 2;
+    }
+
+    return NewSize;
+  }
+
+  void CBufferObjectStream::beginFrame(size_t const VertexBytes, size_t const IndexBytes, CStateShadow &rStateShadow)
+  {
+    mVertexBufferSize = getBufferSize(VertexBytes, mVertexBufferSize);
+    mIndexBufferSize  = getBufferSize(IndexBytes,  mIndexBufferSize);
+
+    // orphaning: the buffers get new memory with the same size, thus the upload does not wait for the draw calls of the frame before
+    rStateShadow.bindBuffer(CStateShadow::ES_ARRAY_BUFFER_BINDING, mVertexBuffer);
+    mpBufferData(GL_ARRAY_BUFFER, static_cast<ptrdiff_t>(mVertexBufferSize), nullptr, GL_STREAM_DRAW);
+
+    rStateShadow.bindBuffer(CStateShadow::ES_ELEMENT_ARRAY_BUFFER_BINDING, mIndexBuffer);
+    mpBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<ptrdiff_t>(mIndexBufferSize), nullptr, GL_STREAM_DRAW);
+
+    return;
+  }
+
+  void CBufferObjectStream::uploadVertices(size_t const Offset, size_t const Bytes, void const * const pData)
+  {
+    FASSERT(Offset + Bytes <= mVertexBufferSize);
+    mpBufferSubData(GL_ARRAY_BUFFER, static_cast<ptrdiff_t>(Offset), static_cast<ptrdiff_t>(Bytes), pData);
+    return;
+  }
+
+  void CBufferObjectStream::uploadIndices(size_t const Offset, size_t const Bytes, void const * const pData)
+  {
+    FASSERT(Offset + Bytes <= mIndexBufferSize);
+    mpBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<ptrdiff_t>(Offset), static_cast<ptrdiff_t>(Bytes), pData);
+    return;
+  }
+
+  /// @brief The OpenGL capabilities of the states ES_BLEND to ES_COLOR_ARRAY.
+  static GLenum const StateCapabilities[] =
+  {
+    GL_BLEND,
+    GL_CULL_FACE,
+    GL_DEPTH_TEST,
+    GL_LIGHTING,
+    GL_SCISSOR_TEST,
+    GL_TEXTURE_2D,
+    GL_VERTEX_ARRAY,
+    GL_TEXTURE_COORD_ARRAY,
+    GL_COLOR_ARRAY
+  };
+
+  CStateShadow::CStateShadow(void):
+    mIsHostStatePersistent(false),
+    mNumberOfQueries(0),
+    mpBindBuffer(nullptr)
+  {
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      SState &rState = mStates[State];
+
+      for (int i = 0; i < MaxNumberOfValues; i++)
+      {
+        rState.mHostValue[i] = 0;
+        rState.mValue[i]     = 0;
+      }
+
+      rState.mIsHostValueKnown = false;
+      rState.mIsValueKnown     = false;
+      rState.mIsChanged        = false;
+    }
+
+    return;
+  }
+
+  void CStateShadow::setHostStatePersistent(bool const IsPersistent)
+  {
+    mIsHostStatePersistent = IsPersistent;
+    return;
+  }
+
+  void CStateShadow::begin(void)
+  {
+    mNumberOfQueries = 0;
+
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      SState &rState = mStates[State];
+
+      if (!mIsHostStatePersistent)
+      {
+        rState.mIsHostValueKnown = false;
+      }
+
+      // after restore() the current value is the host value
+      rState.mIsValueKnown = rState.mIsHostValueKnown;
+      rState.mIsChanged    = false;
+    }
+
+    return;
+  }
+
+  void CStateShadow::setEnabled(EState const State, bool const IsEnabled)
+  {
+    FASSERT(State <= ES_COLOR_ARRAY);
+
+    GLint const Values[MaxNumberOfValues] = {IsEnabled ? GL_TRUE : GL_FALSE, 0, 0, 0};
+    set(State, Values);
+
+    return;
+  }
+
+  void CStateShadow::setBlendFunction(GLenum const Source, GLenum const Destination)
+  {
+    GLint const Values[MaxNumberOfValues] = {static_cast<GLint>(Source), static_cast<GLint>(Destination), 0, 0};
+    set(ES_BLEND_FUNCTION, Values);
+    return;
+  }
+
+  void CStateShadow::setColorMask(GLboolean const Red, GLboolean const Green, GLboolean const Blue, GLboolean const Alpha)
+  {
+    GLint const Values[MaxNumberOfValues] = {Red, Green, Blue, Alpha};
+    set(ES_COLOR_MASK, Values);
+    return;
+  }
+
+  void CStateShadow::setMatrixMode(GLenum const Mode)
+  {
+    GLint const Values[MaxNumberOfValues] = {static_cast<GLint>(Mode), 0, 0, 0};
+    set(ES_MATRIX_MODE, Values);
+    return;
+  }
+
+  bool CStateShadow::bindTexture(GLuint const Texture)
+  {
+    GLint const Values[MaxNumberOfValues] = {static_cast<GLint>(Texture), 0, 0, 0};
+    return set(ES_TEXTURE_BINDING, Values);
+  }
+
+  void CStateShadow::setBindBufferFunction(TBindBufferFunction const pBindBuffer)
+  {
+    mpBindBuffer = pBindBuffer;
+    return;
+  }
+
+  bool CStateShadow::bindBuffer(EState const State, GLuint const Buffer)
+  {
+    FASSERT((State == ES_ARRAY_BUFFER_BINDING) || (State == ES_ELEMENT_ARRAY_BUFFER_BINDING));
+    FASSERT(mpBindBuffer);
+
+    GLint const Values[MaxNumberOfValues] = {static_cast<GLint>(Buffer), 0, 0, 0};
+    return set(State, Values);
+  }
+
+  void CStateShadow::setUnpackParameter(EState const State, GLint const Value)
+  {
+    FASSERT((State == ES_UNPACK_ROW_LENGTH) || (State == ES_UNPACK_ALIGNMENT));
+
+    GLint const Values[MaxNumberOfValues] = {Value, 0, 0, 0};
+    set(State, Values);
+
+    return;
+  }
+
+  void CStateShadow::onDeleteTexture(GLuint const Texture)
+  {
+    SState &rState = mStates[ES_TEXTURE_BINDING];
+
+    if (rState.mIsHostValueKnown && (rState.mHostValue[0] == static_cast<GLint>(Texture)))
+    {
+      rState.mHostValue[0] = 0;
+    }
+
+    if (rState.mIsValueKnown && (rState.mValue[0] == static_cast<GLint>(Texture)))
+    {
+      rState.mValue[0] = 0;
+    }
+
+    return;
+  }
+
+  void CStateShadow::invalidate(void)
+  {
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      mStates[State].mIsValueKnown = false;
+    }
+
+    return;
+  }
+
+  void CStateShadow::invalidateHostState(void)
+  {
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      mStates[State].mIsHostValueKnown = false;
+    }
+
+    return;
+  }
+
+  void CStateShadow::restore(void)
+  {
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      SState &rState = mStates[State];
+
+      if (!rState.mIsChanged)
+      {
+        continue;
+      }
+
+      if (!rState.mIsValueKnown || !isEqual(rState.mValue, rState.mHostValue))
+      {
+        apply(static_cast<EState>(State), rState.mHostValue);
+      }
+
+      for (int i = 0; i < MaxNumberOfValues; i++)
+      {
+        rState.mValue[i] = rState.mHostValue[i];
+      }
+
+      rState.mIsValueKnown = true;
+      rState.mIsChanged    = false;
+    }
+
+    return;
+  }
+
+  irr::u32 CStateShadow::validate(void)
+  {
+    irr::u32 NumberOfMismatches = 0;
+
+    for (int State = 0; State < ES_COUNT; State++)
+    {
+      SState &rState = mStates[State];
+
+      if (!rState.mIsValueKnown)
+      {
+        continue;
+      }
+
+      GLint RealValues[MaxNumberOfValues];
+      read(static_cast<EState>(State), RealValues);
+
+      if (!isEqual(rState.mValue, RealValues))
+      {
+        LOG_ERROR("{IrrIMGUI-GL} The shadow of the OpenGL state " << getName(static_cast<EState>(State)) << " is different from the real OpenGL state.\n");
+        NumberOfMismatches++;
+
+        for (int i = 0; i < MaxNumberOfValues; i++)
+        {
+          rState.mValue[i] = RealValues[i];
+
+          // the state has been changed outside of the shadow before begin()
+          if (!rState.mIsChanged)
+          {
+            rState.mHostValue[i] = RealValues[i];
+          }
+        }
+      }
+    }
+
+    return NumberOfMismatches;
+  }
+
+  irr::u32 CStateShadow::getNumberOfQueries(void) const
+  {
+    return mNumberOfQueries;
+  }
+
+  bool CStateShadow::set(EState const State, GLint const * const pValues)
+  {
+    SState &rState = mStates[State];
+
+    if (!rState.mIsHostValueKnown)
+    {
+      read(State, rState.mHostValue);
+      mNumberOfQueries++;
+      rState.mIsHostValueKnown = true;
+
+      if (!rState.mIsChanged)
+      {
+        for (int i = 0; i < MaxNumberOfValues; i++)
+        {
+          rState.mValue[i] = rState.mHostValue[i];
+        }
+        rState.mIsValueKnown = true;
+      }
+    }
+
+    rState.mIsChanged = true;
+
+    if (rState.mIsValueKnown && isEqual(rState.mValue, pValues))
+    {
+      return false;
+    }
+
+    apply(State, pValues);
+
+    for (int i = 0; i < MaxNumberOfValues; i++)
+    {
+      rState.mValue[i] = pValues[i];
+    }
+    rState.mIsValueKnown = true;
+
+    return true;
+  }
+
+  void CStateShadow::read(EState const State, GLint * const pValues)
+  {
+    // OpenGL does not write the values without a context (e.g. with the Irrlicht null driver)
+    for (int i = 0; i < MaxNumberOfValues; i++)
+    {
+      pValues[i] = 0;
+    }
+
+    switch (State)
+    {
+      case ES_BLEND_FUNCTION:
+        glGetIntegerv(GL_BLEND_SRC, &pValues[0]);
+        glGetIntegerv(GL_BLEND_DST, &pValues[1]);
+        break;
+
+      case ES_COLOR_MASK:
+      {
+        GLboolean ColorMask[MaxNumberOfValues] = {GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE};
+        glGetBooleanv(GL_COLOR_WRITEMASK, ColorMask);
+
+        for (int i = 0; i < MaxNumberOfValues; i++)
+        {
+          pValues[i] = ColorMask[i];
+        }
+        break;
+      }
+
+      case ES_MATRIX_MODE:
+        glGetIntegerv(GL_MATRIX_MODE, &pValues[0]);
+        break;
+
+      case ES_TEXTURE_BINDING:
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &pValues[0]);
+        break;
+
+      case ES_ARRAY_BUFFER_BINDING:
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &pValues[0]);
+        break;
+
+      case ES_ELEMENT_ARRAY_BUFFER_BINDING:
+        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &pValues[0]);
+        break;
+
+      case ES_UNPACK_ROW_LENGTH:
+        glGetIntegerv(GL_UNPACK_ROW_LENGTH, &pValues[0]);
+        break;
+
+      case ES_UNPACK_ALIGNMENT:
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &pValues[0]);
+        break;
+
+      default:
+        FASSERT(State <= ES_COLOR_ARRAY);
+        pValues[0] = (glIsEnabled(StateCapabilities[State]) == GL_TRUE) ? GL_TRUE : GL_FALSE;
+        break;
+    }
+
+    return;
+  }
+
+  void CStateShadow::apply(EState const State, GLint const * const pValues)
+  {
+    switch (State)
+    {
+      case ES_VERTEX_ARRAY:
+      case ES_TEXTURE_COORD_ARRAY:
+      case ES_COLOR_ARRAY:
+        if (pValues[0])
+        {
+          glEnableClientState(StateCapabilities[State]);
+        }
+        else
+        {
+          glDisableClientState(StateCapabilities[State]);
+        }
+        break;
+
+      case ES_BLEND_FUNCTION:
+        glBlendFunc(static_cast<GLenum>(pValues[0]), static_cast<GLenum>(pValues[1]));
+        break;
+
+      case ES_COLOR_MASK:
+        glColorMask(static_cast<GLboolean>(pValues[0]), static_cast<GLboolean>(pValues[1]), static_cast<GLboolean>(pValues[2]), static_cast<GLboolean>(pValues[3]));
+        break;
+
+      case ES_MATRIX_MODE:
+        glMatrixMode(static_cast<GLenum>(pValues[0]));
+        break;
+
+      case ES_TEXTURE_BINDING:
+        glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(pValues[0]));
+        break;
+
+      case ES_ARRAY_BUFFER_BINDING:
+        mpBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(pValues[0]));
+        break;
+
+      case ES_ELEMENT_ARRAY_BUFFER_BINDING:
+        mpBindBuffer(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLuint>(pValues[0]));
+        break;
+
+      case ES_UNPACK_ROW_LENGTH:
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, pValues[0]);
+        break;
+
+      case ES_UNPACK_ALIGNMENT:
+        glPixelStorei(GL_UNPACK_ALIGNMENT, pValues[0]);
+        break;
+
+      default:
+        FASSERT(State <= ES_COLOR_ARRAY);
+        if (pValues[0])
+        {
+          glEnable(StateCapabilities[State]);
+        }
+        else
+        {
+          glDisable(StateCapabilities[State]);
+        }
+        break;
+    }
+
+    return;
+  }
+
+  bool CStateShadow::isEqual(GLint const * const pFirstValues, GLint const * const pSecondValues)
+  {
+    for (int i = 0; i < MaxNumberOfValues; i++)
+    {
+      if (pFirstValues[i] != pSecondValues[i])
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  char const * CStateShadow::getName(EState const State)
+  {
+    static char const * const Names[ES_COUNT] =
+    {
+      "GL_BLEND",
+      "GL_CULL_FACE",
+      "GL_DEPTH_TEST",
+      "GL_LIGHTING",
+      "GL_SCISSOR_TEST",
+      "GL_TEXTURE_2D",
+      "GL_VERTEX_ARRAY",
+      "GL_TEXTURE_COORD_ARRAY",
+      "GL_COLOR_ARRAY",
+      "GL_BLEND_SRC/GL_BLEND_DST",
+      "GL_COLOR_WRITEMASK",
+      "GL_MATRIX_MODE",
+      "GL_TEXTURE_BINDING_2D",
+      "GL_ARRAY_BUFFER_BINDING",
+      "GL_ELEMENT_ARRAY_BUFFER_BINDING",
+      "GL_UNPACK_ROW_LENGTH",
+      "GL_UNPACK_ALIGNMENT"
+    };
+
+    return Names[State];
+  }
+
+}
+}
+}
+
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
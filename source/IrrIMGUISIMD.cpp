@@ -0,0 +1,762 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IrrIMGUISIMD.cpp
+ * @author Andre Netzeband
+ * @brief  Contains vectorized conversion functions for the render drivers.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <atomic>
+#include <cstddef>
+
+// module includes
+#include "private/IrrIMGUISIMD_priv.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+// detect the instruction sets the compiler can generate
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define _IRRIMGUI_SIMD_X86_
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _IRRIMGUI_COMPILER_MSVC_
+#include <intrin.h>
+#endif // _IRRIMGUI_COMPILER_MSVC_
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define _IRRIMGUI_SIMD_NEON_
+#include <arm_neon.h>
+#endif
+
+// GCC and CLang can only generate instructions for a function, when the target is enabled for it
+#if defined(__GNUC__)
+#define IRRIMGUI_SIMD_TARGET(Target) __attribute__((target(Target)))
+#else
+#define IRRIMGUI_SIMD_TARGET(Target)
+#endif
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+namespace SIMD
+{
+
+  // The vector kernels write the Irrlicht vertex as raw memory:
+  //   Byte  0..15: Pos.X, Pos.Y, Pos.Z, Normal.X
+  //   Byte 16..31: Normal.Y, Normal.Z, Color, TCoords.X
+  //   Byte 32..35: TCoords.Y
+  static_assert(sizeof(irr::video::S3DVertex) == 36,                         "Unexpected size of irr::video::S3DVertex.");
+  static_assert(offsetof(irr::video::S3DVertex, Pos)     == 0,               "Unexpected layout of irr::video::S3DVertex.");
+  static_assert(offsetof(irr::video::S3DVertex, Normal)  == 12,              "Unexpected layout of irr::video::S3DVertex.");
+  static_assert(offsetof(irr::video::S3DVertex, Color)   == 24,              "Unexpected layout of irr::video::S3DVertex.");
+  static_assert(offsetof(irr::video::S3DVertex, TCoords) == 28,              "Unexpected layout of irr::video::S3DVertex.");
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+  // the IMGUI vertices are used directly as Irrlicht vertices
+  static_assert(sizeof(ImDrawVert) == sizeof(irr::video::S3DVertex),                      "ImDrawVert has not the layout of irr::video::S3DVertex.");
+  static_assert(offsetof(ImDrawVert, pos) == offsetof(irr::video::S3DVertex, Pos),         "ImDrawVert has not the layout of irr::video::S3DVertex.");
+  static_assert(offsetof(ImDrawVert, normal) == offsetof(irr::video::S3DVertex, Normal),   "ImDrawVert has not the layout of irr::video::S3DVertex.");
+  static_assert(offsetof(ImDrawVert, col) == offsetof(irr::video::S3DVertex, Color),       "ImDrawVert has not the layout of irr::video::S3DVertex.");
+  static_assert(offsetof(ImDrawVert, uv) == offsetof(irr::video::S3DVertex, TCoords),      "ImDrawVert has not the layout of irr::video::S3DVertex.");
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+namespace Helper
+{
+  /// @brief The instruction set that is used at the moment.
+  /// @details It is read by the worker threads as well, thus it is atomic.
+  static std::atomic<EInstructionSet> ActiveInstructionSet(EIS_COUNT);
+
+  /// @brief Converts vertices without vector instructions.
+  /// @param pSource        Is a pointer to the first IMGUI vertex.
+  /// @param pDestination   Is a pointer to the first Irrlicht vertex.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  void convertVerticesScalar(ImDrawVert const * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+
+  /// @brief Swaps the Red and Blue channel of pixels without vector instructions.
+  /// @param pSource        Is a pointer to the first source pixel.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void convertColorsScalar(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Expands alpha values to white pixels without vector instructions.
+  /// @param pSource        Is a pointer to the first alpha value.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void expandAlphaScalar(irr::u8 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+#ifdef _IRRIMGUI_SIMD_X86_
+  /// @return Returns true, if the CPU and the operating system supports AVX2.
+  bool isAVX2Available(void);
+
+  /// @return Returns true, if the CPU supports SSE2.
+  bool isSSE2Available(void);
+
+  /// @brief Converts vertices with SSE2 instructions (4 colors per step).
+  /// @param pSource        Is a pointer to the first IMGUI vertex.
+  /// @param pDestination   Is a pointer to the first Irrlicht vertex.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  void convertVerticesSSE2(ImDrawVert const * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+
+  /// @brief Converts vertices with AVX2 instructions (8 colors per step).
+  /// @param pSource        Is a pointer to the first IMGUI vertex.
+  /// @param pDestination   Is a pointer to the first Irrlicht vertex.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  void convertVerticesAVX2(ImDrawVert const * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+
+  /// @brief Swaps the Red and Blue channel of pixels with SSE2 instructions (4 pixels per step).
+  /// @param pSource        Is a pointer to the first source pixel.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void convertColorsSSE2(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Swaps the Red and Blue channel of pixels with AVX2 instructions (8 pixels per step).
+  /// @param pSource        Is a pointer to the first source pixel.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void convertColorsAVX2(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Expands alpha values to white pixels with SSE2 instructions (16 pixels per step).
+  /// @param pSource        Is a pointer to the first alpha value.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void expandAlphaSSE2(irr::u8 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Expands alpha values to white pixels with AVX2 instructions (8 pixels per step).
+  /// @param pSource        Is a pointer to the first alpha value.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void expandAlphaAVX2(irr::u8 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+  /// @brief Converts vertices with NEON instructions (4 colors per step).
+  /// @param pSource        Is a pointer to the first IMGUI vertex.
+  /// @param pDestination   Is a pointer to the first Irrlicht vertex.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  void convertVerticesNEON(ImDrawVert const * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+
+  /// @brief Swaps the Red and Blue channel of pixels with NEON instructions (16 pixels per step).
+  /// @param pSource        Is a pointer to the first source pixel.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void convertColorsNEON(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Expands alpha values to white pixels with NEON instructions (16 pixels per step).
+  /// @param pSource        Is a pointer to the first alpha value.
+  /// @param pDestination   Is a pointer to the first destination pixel.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  void expandAlphaNEON(irr::u8 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+#endif // _IRRIMGUI_SIMD_NEON_
+}
+
+  EInstructionSet detectInstructionSet(void)
+  {
+#ifdef _IRRIMGUI_SIMD_X86_
+    // The vertex conversion is limited by the 36 byte stores of the Irrlicht vertices. The wider AVX2
+    // swizzle does not help there, but the extraction of the colors costs time (see benchmark VertexConversion).
+    // Thus SSE2 is preferred and AVX2 must be selected explicitly.
+    if (Helper::isSSE2Available())
+    {
+      return EIS_SSE2;
+    }
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+    return EIS_NEON;
+#endif // _IRRIMGUI_SIMD_NEON_
+
+    return EIS_SCALAR;
+  }
+
+  bool isInstructionSetSupported(EInstructionSet const InstructionSet)
+  {
+    switch (InstructionSet)
+    {
+      case EIS_SCALAR:
+        return true;
+
+#ifdef _IRRIMGUI_SIMD_X86_
+      case EIS_SSE2:
+        return Helper::isSSE2Available();
+
+      case EIS_AVX2:
+        return Helper::isAVX2Available();
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+      case EIS_NEON:
+        return true;
+#endif // _IRRIMGUI_SIMD_NEON_
+
+      default:
+        return false;
+    }
+  }
+
+  EInstructionSet getInstructionSet(void)
+  {
+    EInstructionSet InstructionSet = Helper::ActiveInstructionSet.load();
+
+    if (InstructionSet == EIS_COUNT)
+    {
+      // only the first thread, that selects the instruction set, prints the note
+      EInstructionSet const DetectedInstructionSet = detectInstructionSet();
+      if (Helper::ActiveInstructionSet.compare_exchange_strong(InstructionSet, DetectedInstructionSet))
+      {
+        InstructionSet = DetectedInstructionSet;
+        LOG_NOTE("{IrrIMGUI} Use " << getInstructionSetName(InstructionSet) << " instructions for data conversion.\n");
+      }
+    }
+
+    return InstructionSet;
+  }
+
+  bool setInstructionSet(EInstructionSet const InstructionSet)
+  {
+    if (!isInstructionSetSupported(InstructionSet))
+    {
+      LOG_WARNING("{IrrIMGUI} The instruction set " << getInstructionSetName(InstructionSet) << " is not supported on this machine.\n");
+      return false;
+    }
+
+    Helper::ActiveInstructionSet.store(InstructionSet);
+    return true;
+  }
+
+  char const * getInstructionSetName(EInstructionSet const InstructionSet)
+  {
+    switch (InstructionSet)
+    {
+      case EIS_SCALAR:
+        return "Scalar";
+
+      case EIS_SSE2:
+        return "SSE2";
+
+      case EIS_AVX2:
+        return "AVX2";
+
+      case EIS_NEON:
+        return "NEON";
+
+      default:
+        return "Unknown";
+    }
+  }
+
+  void convertVertices(ImDrawVert const * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    switch (getInstructionSet())
+    {
+#ifdef _IRRIMGUI_SIMD_X86_
+      case EIS_AVX2:
+        Helper::convertVerticesAVX2(pSource, pDestination, NumberOfVertex, rOffset);
+        break;
+
+      case EIS_SSE2:
+        Helper::convertVerticesSSE2(pSource, pDestination, NumberOfVertex, rOffset);
+        break;
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+      case EIS_NEON:
+        Helper::convertVerticesNEON(pSource, pDestination, NumberOfVertex, rOffset);
+        break;
+#endif // _IRRIMGUI_SIMD_NEON_
+
+      default:
+        Helper::convertVerticesScalar(pSource, pDestination, NumberOfVertex, rOffset);
+        break;
+    }
+
+    return;
+  }
+
+  void convertColors(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    switch (getInstructionSet())
+    {
+#ifdef _IRRIMGUI_SIMD_X86_
+      case EIS_AVX2:
+        Helper::convertColorsAVX2(pSource, pDestination, NumberOfPixels);
+        break;
+
+      case EIS_SSE2:
+        Helper::convertColorsSSE2(pSource, pDestination, NumberOfPixels);
+        break;
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+      case EIS_NEON:
+        Helper::convertColorsNEON(pSource, pDestination, NumberOfPixels);
+        break;
+#endif // _IRRIMGUI_SIMD_NEON_
+
+      default:
+        Helper::convertColorsScalar(pSource, pDestination, NumberOfPixels);
+        break;
+    }
+
+    return;
+  }
+
+  void expandAlpha(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    switch (getInstructionSet())
+    {
+#ifdef _IRRIMGUI_SIMD_X86_
+      case EIS_AVX2:
+        Helper::expandAlphaAVX2(pSource, pDestination, NumberOfPixels);
+        break;
+
+      case EIS_SSE2:
+        Helper::expandAlphaSSE2(pSource, pDestination, NumberOfPixels);
+        break;
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+      case EIS_NEON:
+        Helper::expandAlphaNEON(pSource, pDestination, NumberOfPixels);
+        break;
+#endif // _IRRIMGUI_SIMD_NEON_
+
+      default:
+        Helper::expandAlphaScalar(pSource, pDestination, NumberOfPixels);
+        break;
+    }
+
+    return;
+  }
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+  irr::video::S3DVertex * convertVerticesInPlace(ImDrawVert * const pVertices, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    irr::video::S3DVertex * const pIrrVertices = reinterpret_cast<irr::video::S3DVertex *>(pVertices);
+
+    // position and texture coordinates are already at the right place, only the
+    // color must be swizzled and the fields unknown to IMGUI must be initialized
+    for (irr::u32 i = 0; i < NumberOfVertex; i++)
+    {
+      irr::video::S3DVertex &rIrrVertex = pIrrVertices[i];
+
+      rIrrVertex.Pos.X       += rOffset.X;
+      rIrrVertex.Pos.Y       += rOffset.Y;
+      rIrrVertex.Pos.Z        = rOffset.Z;
+      rIrrVertex.Normal.X     = 0.0f;
+      rIrrVertex.Normal.Y     = 0.0f;
+      rIrrVertex.Normal.Z     = 1.0f;
+      rIrrVertex.Color.color  = convertColor(rIrrVertex.Color.color);
+    }
+
+    return pIrrVertices;
+  }
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+namespace Helper
+{
+
+  void convertVerticesScalar(ImDrawVert const * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    for (irr::u32 i = 0; i < NumberOfVertex; i++)
+    {
+      ImDrawVert const &rImGuiVertex = pSource[i];
+      irr::video::S3DVertex &rIrrVertex = pDestination[i];
+
+      rIrrVertex.Pos.X       = rImGuiVertex.pos.x + rOffset.X;
+      rIrrVertex.Pos.Y       = rImGuiVertex.pos.y + rOffset.Y;
+      rIrrVertex.Pos.Z       = rOffset.Z;
+      rIrrVertex.Normal.X    = 0.0f;
+      rIrrVertex.Normal.Y    = 0.0f;
+      rIrrVertex.Normal.Z    = 1.0f;
+      rIrrVertex.Color.color = convertColor(rImGuiVertex.col);
+      rIrrVertex.TCoords.X   = rImGuiVertex.uv.x;
+      rIrrVertex.TCoords.Y   = rImGuiVertex.uv.y;
+    }
+
+    return;
+  }
+
+  void convertColorsScalar(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    for (irr::u32 i = 0; i < NumberOfPixels; i++)
+    {
+      pDestination[i] = convertColor(pSource[i]);
+    }
+
+    return;
+  }
+
+  void expandAlphaScalar(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    for (irr::u32 i = 0; i < NumberOfPixels; i++)
+    {
+      pDestination[i] = (static_cast<irr::u32>(pSource[i]) << 24) | 0x00FFFFFF;
+    }
+
+    return;
+  }
+
+#ifdef _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_COMPILER_MSVC_
+  bool isAVX2Available(void)
+  {
+    int CPUInfo[4];
+
+    __cpuid(CPUInfo, 0);
+    if (CPUInfo[0] < 7)
+    {
+      return false;
+    }
+
+    // the OS must save the AVX registers (OSXSAVE and AVX bit)
+    __cpuid(CPUInfo, 1);
+    bool const IsOSXSAVE = (CPUInfo[2] & (1 << 27)) != 0;
+    bool const IsAVX     = (CPUInfo[2] & (1 << 28)) != 0;
+    if (!IsOSXSAVE || !IsAVX)
+    {
+      return false;
+    }
+
+    if ((_xgetbv(0) & 0x6) != 0x6)
+    {
+      return false;
+    }
+
+    __cpuidex(CPUInfo, 7, 0);
+    return (CPUInfo[1] & (1 << 5)) != 0;
+  }
+
+  bool isSSE2Available(void)
+  {
+    int CPUInfo[4];
+    __cpuid(CPUInfo, 1);
+    return (CPUInfo[3] & (1 << 26)) != 0;
+  }
+#else // _IRRIMGUI_COMPILER_MSVC_
+  bool isAVX2Available(void)
+  {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }
+
+  bool isSSE2Available(void)
+  {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2") != 0;
+  }
+#endif // _IRRIMGUI_COMPILER_MSVC_
+
+  /// @brief Swaps the Red and Blue channel of 4 colors.
+  /// @param Colors Are 4 IMGUI colors.
+  /// @return Returns 4 Irrlicht colors.
+  IRRIMGUI_SIMD_TARGET("sse2")
+  static inline __m128i swizzleColorsSSE2(__m128i const Colors)
+  {
+    __m128i const MaskAG = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    __m128i const MaskRB = _mm_set1_epi32(0x000000FF);
+
+    __m128i const AG = _mm_and_si128(Colors, MaskAG);
+    __m128i const R  = _mm_slli_epi32(_mm_and_si128(Colors, MaskRB), 16);
+    __m128i const B  = _mm_and_si128(_mm_srli_epi32(Colors, 16), MaskRB);
+
+    return _mm_or_si128(AG, _mm_or_si128(R, B));
+  }
+
+  /// @brief Writes a single Irrlicht vertex with two 16 byte stores and one 4 byte store.
+  /// @param rSource      Is the IMGUI vertex.
+  /// @param pDestination Is the memory of the Irrlicht vertex.
+  /// @param Offset       Is the position offset as (X, Y, Z, 0).
+  /// @param NormalYZ     Is the constant (0, 1, 0, 0).
+  /// @param Color        Is the already converted Irrlicht color.
+  IRRIMGUI_SIMD_TARGET("sse2")
+  static inline void storeVertexSSE2(ImDrawVert const &rSource, irr::f32 * const pDestination, __m128 const Offset, __m128 const NormalYZ, irr::u32 const Color)
+  {
+    __m128 const Position = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const *>(&rSource.pos.x)));
+    __m128 const UV       = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const *>(&rSource.uv.x)));
+    __m128 const ColorUV  = _mm_unpacklo_ps(_mm_castsi128_ps(_mm_cvtsi32_si128(static_cast<int>(Color))), UV);
+
+    _mm_storeu_ps(&pDestination[0], _mm_add_ps(Position, Offset));
+    _mm_storeu_ps(&pDestination[4], _mm_movelh_ps(NormalYZ, ColorUV));
+    pDestination[8] = rSource.uv.y;
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("sse2")
+  void convertVerticesSSE2(ImDrawVert const * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    __m128 const Offset   = _mm_setr_ps(rOffset.X, rOffset.Y, rOffset.Z, 0.0f);
+    __m128 const NormalYZ = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+
+    irr::u32 i = 0;
+    for (; (i + 4) <= NumberOfVertex; i += 4)
+    {
+      __m128i const ImGuiColors = _mm_setr_epi32(
+          static_cast<int>(pSource[i+0].col),
+          static_cast<int>(pSource[i+1].col),
+          static_cast<int>(pSource[i+2].col),
+          static_cast<int>(pSource[i+3].col));
+
+      __m128i const IrrColors = swizzleColorsSSE2(ImGuiColors);
+
+      storeVertexSSE2(pSource[i+0], reinterpret_cast<irr::f32 *>(&pDestination[i+0]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(IrrColors)));
+      storeVertexSSE2(pSource[i+1], reinterpret_cast<irr::f32 *>(&pDestination[i+1]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(_mm_srli_si128(IrrColors, 4))));
+      storeVertexSSE2(pSource[i+2], reinterpret_cast<irr::f32 *>(&pDestination[i+2]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(_mm_srli_si128(IrrColors, 8))));
+      storeVertexSSE2(pSource[i+3], reinterpret_cast<irr::f32 *>(&pDestination[i+3]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(_mm_srli_si128(IrrColors, 12))));
+    }
+
+    convertVerticesScalar(&pSource[i], &pDestination[i], NumberOfVertex - i, rOffset);
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("avx2")
+  void convertVerticesAVX2(ImDrawVert const * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    // swaps byte 0 and 2 of every 32 bit word
+    __m256i const SwizzleMask = _mm256_setr_epi8(
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15,
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15);
+
+    __m128 const Offset   = _mm_setr_ps(rOffset.X, rOffset.Y, rOffset.Z, 0.0f);
+    __m128 const NormalYZ = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+
+    irr::u32 i = 0;
+    for (; (i + 8) <= NumberOfVertex; i += 8)
+    {
+      __m256i const ImGuiColors = _mm256_setr_epi32(
+          static_cast<int>(pSource[i+0].col),
+          static_cast<int>(pSource[i+1].col),
+          static_cast<int>(pSource[i+2].col),
+          static_cast<int>(pSource[i+3].col),
+          static_cast<int>(pSource[i+4].col),
+          static_cast<int>(pSource[i+5].col),
+          static_cast<int>(pSource[i+6].col),
+          static_cast<int>(pSource[i+7].col));
+
+      __m256i const IrrColors = _mm256_shuffle_epi8(ImGuiColors, SwizzleMask);
+      __m128i const IrrColorsLow  = _mm256_castsi256_si128(IrrColors);
+      __m128i const IrrColorsHigh = _mm256_extracti128_si256(IrrColors, 1);
+
+      storeVertexSSE2(pSource[i+0], reinterpret_cast<irr::f32 *>(&pDestination[i+0]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(IrrColorsLow)));
+      storeVertexSSE2(pSource[i+1], reinterpret_cast<irr::f32 *>(&pDestination[i+1]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsLow, 1)));
+      storeVertexSSE2(pSource[i+2], reinterpret_cast<irr::f32 *>(&pDestination[i+2]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsLow, 2)));
+      storeVertexSSE2(pSource[i+3], reinterpret_cast<irr::f32 *>(&pDestination[i+3]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsLow, 3)));
+      storeVertexSSE2(pSource[i+4], reinterpret_cast<irr::f32 *>(&pDestination[i+4]), Offset, NormalYZ, static_cast<irr::u32>(_mm_cvtsi128_si32(IrrColorsHigh)));
+      storeVertexSSE2(pSource[i+5], reinterpret_cast<irr::f32 *>(&pDestination[i+5]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsHigh, 1)));
+      storeVertexSSE2(pSource[i+6], reinterpret_cast<irr::f32 *>(&pDestination[i+6]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsHigh, 2)));
+      storeVertexSSE2(pSource[i+7], reinterpret_cast<irr::f32 *>(&pDestination[i+7]), Offset, NormalYZ, static_cast<irr::u32>(_mm_extract_epi32(IrrColorsHigh, 3)));
+    }
+
+    convertVerticesScalar(&pSource[i], &pDestination[i], NumberOfVertex - i, rOffset);
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("sse2")
+  void convertColorsSSE2(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    irr::u32 i = 0;
+    for (; (i + 4) <= NumberOfPixels; i += 4)
+    {
+      __m128i const Colors = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&pSource[i]));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDestination[i]), swizzleColorsSSE2(Colors));
+    }
+
+    convertColorsScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("avx2")
+  void convertColorsAVX2(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    // swaps byte 0 and 2 of every 32 bit word
+    __m256i const SwizzleMask = _mm256_setr_epi8(
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15,
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15);
+
+    irr::u32 i = 0;
+    for (; (i + 8) <= NumberOfPixels; i += 8)
+    {
+      __m256i const Colors = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(&pSource[i]));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(&pDestination[i]), _mm256_shuffle_epi8(Colors, SwizzleMask));
+    }
+
+    convertColorsScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("sse2")
+  void expandAlphaSSE2(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    __m128i const White = _mm_set1_epi8(static_cast<char>(0xFF));
+
+    irr::u32 i = 0;
+    for (; (i + 16) <= NumberOfPixels; i += 16)
+    {
+      __m128i const Alpha = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&pSource[i]));
+
+      // the first unpack puts a white byte in front of every alpha value, the second one
+      // puts two white bytes in front of it, which results in the pixel 0xAAFFFFFF
+      __m128i const WhiteAlphaLow  = _mm_unpacklo_epi8(White, Alpha);
+      __m128i const WhiteAlphaHigh = _mm_unpackhi_epi8(White, Alpha);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDestination[i+0]),  _mm_unpacklo_epi16(White, WhiteAlphaLow));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDestination[i+4]),  _mm_unpackhi_epi16(White, WhiteAlphaLow));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDestination[i+8]),  _mm_unpacklo_epi16(White, WhiteAlphaHigh));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDestination[i+12]), _mm_unpackhi_epi16(White, WhiteAlphaHigh));
+    }
+
+    expandAlphaScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+  IRRIMGUI_SIMD_TARGET("avx2")
+  void expandAlphaAVX2(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    __m256i const White = _mm256_set1_epi32(0x00FFFFFF);
+
+    irr::u32 i = 0;
+    for (; (i + 8) <= NumberOfPixels; i += 8)
+    {
+      __m256i const Alpha = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(&pSource[i])));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(&pDestination[i]), _mm256_or_si256(_mm256_slli_epi32(Alpha, 24), White));
+    }
+
+    expandAlphaScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+#endif // _IRRIMGUI_SIMD_X86_
+
+#ifdef _IRRIMGUI_SIMD_NEON_
+
+  void convertVerticesNEON(ImDrawVert const * const pSource, irr::video::S3DVertex * const pDestination, irr::u32 const NumberOfVertex, irr::core::vector3df const &rOffset)
+  {
+    irr::f32 const OffsetXYValues[2] = {rOffset.X, rOffset.Y};
+    irr::f32 const OffsetZValues[2]  = {rOffset.Z, 0.0f};
+    irr::f32 const NormalYZValues[2] = {0.0f, 1.0f};
+
+    float32x2_t const OffsetXY = vld1_f32(OffsetXYValues);
+    float32x2_t const OffsetZ  = vld1_f32(OffsetZValues);
+    float32x2_t const NormalYZ = vld1_f32(NormalYZValues);
+    uint32x4_t  const MaskAG   = vdupq_n_u32(0xFF00FF00);
+    uint32x4_t  const MaskRB   = vdupq_n_u32(0x000000FF);
+
+    irr::u32 i = 0;
+    for (; (i + 4) <= NumberOfVertex; i += 4)
+    {
+      irr::u32 const ImGuiColorValues[4] = {pSource[i+0].col, pSource[i+1].col, pSource[i+2].col, pSource[i+3].col};
+      uint32x4_t const ImGuiColors = vld1q_u32(ImGuiColorValues);
+
+      uint32x4_t const AG = vandq_u32(ImGuiColors, MaskAG);
+      uint32x4_t const R  = vshlq_n_u32(vandq_u32(ImGuiColors, MaskRB), 16);
+      uint32x4_t const B  = vandq_u32(vshrq_n_u32(ImGuiColors, 16), MaskRB);
+
+      irr::u32 IrrColors[4];
+      vst1q_u32(IrrColors, vorrq_u32(AG, vorrq_u32(R, B)));
+
+      for (irr::u32 Lane = 0; Lane < 4; Lane++)
+      {
+        ImDrawVert const &rSource = pSource[i + Lane];
+        irr::f32 * const pVertex  = reinterpret_cast<irr::f32 *>(&pDestination[i + Lane]);
+
+        float32x2_t const Position = vadd_f32(vld1_f32(&rSource.pos.x), OffsetXY);
+        float32x2_t const ColorU   = vset_lane_f32(rSource.uv.x, vreinterpret_f32_u32(vdup_n_u32(IrrColors[Lane])), 1);
+
+        vst1q_f32(&pVertex[0], vcombine_f32(Position, OffsetZ));
+        vst1q_f32(&pVertex[4], vcombine_f32(NormalYZ, ColorU));
+        pVertex[8] = rSource.uv.y;
+      }
+    }
+
+    convertVerticesScalar(&pSource[i], &pDestination[i], NumberOfVertex - i, rOffset);
+
+    return;
+  }
+
+  void convertColorsNEON(irr::u32 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    irr::u32 i = 0;
+    for (; (i + 16) <= NumberOfPixels; i += 16)
+    {
+      // the structured load splits the pixels into one register per channel
+      uint8x16x4_t Channels = vld4q_u8(reinterpret_cast<irr::u8 const *>(&pSource[i]));
+      uint8x16_t const Channel0 = Channels.val[0];
+      Channels.val[0] = Channels.val[2];
+      Channels.val[2] = Channel0;
+      vst4q_u8(reinterpret_cast<irr::u8 *>(&pDestination[i]), Channels);
+    }
+
+    convertColorsScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+  void expandAlphaNEON(irr::u8 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfPixels)
+  {
+    uint8x16x4_t Channels;
+    Channels.val[0] = vdupq_n_u8(0xFF);
+    Channels.val[1] = vdupq_n_u8(0xFF);
+    Channels.val[2] = vdupq_n_u8(0xFF);
+
+    irr::u32 i = 0;
+    for (; (i + 16) <= NumberOfPixels; i += 16)
+    {
+      Channels.val[3] = vld1q_u8(&pSource[i]);
+      vst4q_u8(reinterpret_cast<irr::u8 *>(&pDestination[i]), Channels);
+    }
+
+    expandAlphaScalar(&pSource[i], &pDestination[i], NumberOfPixels - i);
+
+    return;
+  }
+
+#endif // _IRRIMGUI_SIMD_NEON_
+
+}
+}
+}
+}
+
+/**
+ * @}
+ */
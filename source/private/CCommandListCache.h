@@ -0,0 +1,157 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CCommandListCache.h
+ * @author Andre Netzeband
+ * @brief  Contains a cache for the converted vertices of IMGUI command lists.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCACHE_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCACHE_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+// module includes
+#include "private/CCommandListCopy.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Keeps the converted vertices of IMGUI command lists from the frames before.
+  /// @details Most windows do not change from frame to frame. The vertices, indices and commands of such a command list
+  ///          are compared with a copy from the frame before and the converted vertices are reused, when nothing has changed.
+  ///          Comparing the memory is much cheaper than the conversion (or a hash over all vertices).
+  ///          The memory of the cache is limited by a maximum number of cached vertices. Command lists, that change
+  ///          in every frame, are only checked from time to time, since comparing and copying them is a waste of time.
+  class CCommandListCache
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CCommandListCache(void);
+
+      /// @brief Destructor.
+      ~CCommandListCache(void);
+
+      /// @}
+
+      /// @{
+      /// @name Cache access
+
+      /// @brief Looks for the converted vertices of a command list.
+      /// @param pCommandList Is the command list.
+      /// @return Returns the converted vertices or nullptr, when the command list has changed since it was added to the cache.
+      irr::video::S3DVertex * findVertices(ImDrawList const * pCommandList);
+
+      /// @brief Adds a command list to the cache or replaces the old content of this command list.
+      /// @param pCommandList Is the command list.
+      /// @return Returns a buffer for the converted vertices, that must be filled by the caller. When the command list does
+      ///         not fit into the cache or when it changes too often, nullptr is returned.
+      irr::video::S3DVertex * addCommandList(ImDrawList const * pCommandList);
+
+      /// @brief Must be called at the begin of every frame. It removes command lists, that have not been used for some frames.
+      void startFrame(void);
+
+      /// @}
+
+      /// @{
+      /// @name Memory handling
+
+      /// @brief Sets the maximum number of vertices in the cache. Command lists are removed, when there are more vertices.
+      /// @param MaxNumberOfVertices Is the maximum number of vertices.
+      void setMaxNumberOfVertices(irr::u32 MaxNumberOfVertices);
+
+      /// @return Returns the number of vertices of all cached command lists.
+      irr::u32 getNumberOfVertices(void) const;
+
+      /// @return Returns the number of cached command lists.
+      irr::u32 getNumberOfCommandLists(void) const;
+
+      /// @brief Removes all command lists from the cache.
+      void clear(void);
+
+      /// @}
+
+    private:
+      /// @brief The content of a single command list.
+      struct SEntry
+      {
+        ImDrawList const *                 mpCommandList;
+        irr::u32                           mLastUsedFrame;
+        irr::u32                           mNumberOfChanges;
+        CCommandListCopy                   mSource;
+        std::vector<irr::video::S3DVertex> mVertices;
+      };
+
+      /// @param pCommandList Is the command list.
+      /// @return Returns the index of the entry of a command list or the number of entries, when it is not cached.
+      size_t findEntry(ImDrawList const * pCommandList) const;
+
+      /// @brief Removes the entry, that has not been used for the longest time.
+      /// @param pKeptEntry Is an entry that must not be removed.
+      /// @return Returns false, when there was no entry to remove.
+      bool removeOldestEntry(SEntry const * pKeptEntry);
+
+      /// @brief Removes an entry from the cache.
+      /// @param Index Is the index of the entry.
+      void removeEntry(size_t Index);
+
+      /// @param rEntry Is the cache entry.
+      /// @return Returns true, if the command list of the entry has changed too often and is not checked in this frame.
+      bool isSkipped(SEntry const &rEntry) const;
+
+      /// @brief This class can not be copied.
+      CCommandListCache(CCommandListCache const &) = delete;
+
+      /// @brief This class can not be copied.
+      CCommandListCache &operator=(CCommandListCache const &) = delete;
+
+      std::vector<SEntry *> mEntries;
+      irr::u32              mMaxNumberOfVertices;
+      irr::u32              mNumberOfVertices;
+      irr::u32              mFrame;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCACHE_H_ */
@@ -0,0 +1,83 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CCommandListCopy.h
+ * @author Andre Netzeband
+ * @brief  Contains a copy of an IMGUI command list, that is used to detect changes from frame to frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCOPY_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCOPY_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Keeps a copy of the vertices, indices and commands of an IMGUI command list.
+  /// @details The copy is compared byte by byte with the command list of a later frame, which is much cheaper
+  ///          than computing a hash over all vertices.
+  class CCommandListCopy
+  {
+    public:
+      /// @brief Replaces the content of the copy with the content of a command list.
+      /// @param pCommandList Is the command list.
+      void assign(ImDrawList const * pCommandList);
+
+      /// @param pCommandList Is the command list.
+      /// @return Returns true, if the command list has the same content like the copy.
+      bool isEqual(ImDrawList const * pCommandList) const;
+
+      /// @return Returns the number of vertices of the copy.
+      irr::u32 getNumberOfVertices(void) const;
+
+      /// @brief Removes the content and gives back the memory.
+      void clear(void);
+
+    private:
+      std::vector<ImDrawVert> mVertices;
+      std::vector<ImDrawIdx>  mIndices;
+      std::vector<ImDrawCmd>  mCommands;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CCOMMANDLISTCOPY_H_ */
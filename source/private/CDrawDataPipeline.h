@@ -0,0 +1,164 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CDrawDataPipeline.h
+ * @author Andre Netzeband
+ * @brief  Contains a double buffered copy of the IMGUI draw data, that is prepared for rendering by a worker thread.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CDRAWDATAPIPELINE_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CDRAWDATAPIPELINE_H_
+
+// library includes
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Renders the GUI one frame delayed, thus the draw data of a frame can be prepared while the frame before is submitted.
+  /// @details Every frame the draw data is copied into one of two frame buffers. A worker thread prepares this copy (e.g. converts
+  ///          the vertices), while the render thread submits the copy of the frame before. This trades one frame of GUI latency
+  ///          for a shorter render thread.
+  class CDrawDataPipeline
+  {
+    public:
+      /// @brief A copy of the draw data of a frame.
+      struct SFrame
+      {
+        /// @brief The copied command lists (owned by the frame).
+        std::vector<ImDrawList *>            mCommandLists;
+
+        /// @brief The draw data, that points to the copied command lists.
+        ImDrawData                           mDrawData;
+
+        /// @brief Storage for the converted vertices of all command lists (filled by the prepare function).
+        std::vector<irr::video::S3DVertex>   mVertices;
+
+        /// @brief The converted vertices of every command list (filled by the prepare function).
+        std::vector<irr::video::S3DVertex *> mVertexArrays;
+
+        /// @brief The time, when the draw data has been copied.
+        std::chrono::steady_clock::time_point mCreationTime;
+
+        /// @brief The time in milliseconds, that the prepare function has needed on the worker thread.
+        irr::f32                             mConversionTime;
+
+        /// @brief The number of bytes, that have been converted by the prepare function (set by the prepare function).
+        irr::u32                             mNumberOfConvertedBytes;
+      };
+
+      /// @brief A function, that prepares a frame for rendering. It is called by the worker thread.
+      typedef void (*PrepareFunction)(SFrame &rFrame);
+
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor. Starts the worker thread.
+      /// @param pPrepareFunction Is the function, that prepares a frame for rendering.
+      CDrawDataPipeline(PrepareFunction pPrepareFunction);
+
+      /// @brief Destructor. Stops the worker thread.
+      ~CDrawDataPipeline(void);
+
+      /// @}
+
+      /// @{
+      /// @name Pipeline methods
+
+      /// @brief Copies the draw data of the current frame into the pipeline and starts to prepare it.
+      /// @param pDrawData Is the draw data of the current frame.
+      /// @return Returns the prepared frame, that must be rendered now. This is the frame before, or the current frame,
+      ///         when the pipeline was empty. In the second case the frame is rendered again in the next frame.
+      SFrame * push(ImDrawData * pDrawData);
+
+      /// @brief Waits for the worker thread and removes the frame, that waits to be rendered.
+      ///        Must be called when a texture, that could be used by this frame, is deleted.
+      void flush(void);
+
+      /// @return Returns the time in milliseconds between the copy of the frame returned by push() and its rendering.
+      irr::f32 getLatency(void) const;
+
+      /// @return Returns the time in milliseconds, the render thread has waited in the last push() for the worker thread.
+      irr::f32 getWaitTime(void) const;
+
+      /// @}
+
+    private:
+      /// @brief The main function of the worker thread.
+      void runWorker(void);
+
+      /// @brief Waits until the worker thread has prepared the last frame.
+      void waitForWorker(void);
+
+      /// @brief Copies the draw data into a frame.
+      /// @param pDrawData Is the draw data.
+      /// @param rFrame    Is the frame.
+      static void copyDrawData(ImDrawData const * pDrawData, SFrame &rFrame);
+
+      /// @brief Removes all command lists of a frame.
+      /// @param rFrame Is the frame.
+      static void clearFrame(SFrame &rFrame);
+
+      /// @brief This class can not be copied.
+      CDrawDataPipeline(CDrawDataPipeline const &) = delete;
+
+      /// @brief This class can not be copied.
+      CDrawDataPipeline &operator=(CDrawDataPipeline const &) = delete;
+
+      PrepareFunction         mpPrepareFunction;
+      SFrame                  mFrames[2];
+      SFrame                * mpPendingFrame;
+      SFrame                * mpPreparedFrame;
+      irr::f32                mLatency;
+      irr::f32                mWaitTime;
+      std::thread             mWorker;
+      std::mutex              mMutex;
+      std::condition_variable mWorkStarted;
+      std::condition_variable mWorkFinished;
+      bool                    mIsStopped;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CDRAWDATAPIPELINE_H_ */
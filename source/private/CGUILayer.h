@@ -0,0 +1,132 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CGUILayer.h
+ * @author Andre Netzeband
+ * @brief  Contains a render target texture, that keeps the rendered GUI as long as it does not change.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CGUILAYER_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CGUILAYER_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+// module includes
+#include "private/CCommandListCopy.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+class IGUITexture;
+
+namespace Private
+{
+  class IIMGUIDriver;
+
+  /// @brief Keeps the rendered GUI inside a render target texture.
+  /// @details The GUI is only rendered into the texture, when the draw data has changed since the frame before.
+  ///          In all other frames the texture is drawn with a single quad. The texture contains premultiplied colors,
+  ///          since only those can be blended correctly over the scene after the GUI has been blended into the texture.
+  class CGUILayer
+  {
+    public:
+      /// @brief The render function of a GUI driver.
+      typedef void (*RenderFunction)(ImDrawData * pDrawData);
+
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      /// @param pDriver Is a pointer to the GUI driver, that renders the GUI and owns the layer texture.
+      CGUILayer(IIMGUIDriver * pDriver);
+
+      /// @brief Destructor.
+      ~CGUILayer(void);
+
+      /// @}
+
+      /// @{
+      /// @name Render methods
+
+      /// @brief Renders the draw data into the layer texture, when it has changed, and draws the layer texture.
+      ///        When the render driver does not support render targets, the draw data is rendered directly.
+      /// @param pDrawData       Is the draw data of the current frame.
+      /// @param pRenderFunction Is the render function of the GUI driver.
+      /// @return Returns true, when the GUI has been drawn from the layer texture without rendering the draw data.
+      bool draw(ImDrawData * pDrawData, RenderFunction pRenderFunction);
+
+      /// @brief Forces the layer to render the draw data again in the next frame.
+      void invalidate(void);
+
+      /// @}
+
+    private:
+      /// @param pDrawData Is the draw data of the current frame.
+      /// @return Returns true, when the draw data is different from the draw data of the frame before.
+      bool hasChanged(ImDrawData const * pDrawData);
+
+      /// @brief Creates the layer texture, when it does not exist or when its size differs from the screen size.
+      /// @param Width  Is the width of the screen.
+      /// @param Height Is the height of the screen.
+      /// @return Returns false, when the texture could not be created.
+      bool updateTexture(irr::u32 Width, irr::u32 Height);
+
+      /// @brief Removes the layer texture from the GUI driver and from the graphic memory.
+      void removeTexture(void);
+
+      /// @brief Draws the layer texture with a single quad over the whole screen.
+      /// @param pRenderFunction Is the render function of the GUI driver.
+      void drawTexture(RenderFunction pRenderFunction);
+
+      /// @brief This class can not be copied.
+      CGUILayer(CGUILayer const &) = delete;
+
+      /// @brief This class can not be copied.
+      CGUILayer &operator=(CGUILayer const &) = delete;
+
+      IIMGUIDriver                * mpDriver;
+      irr::video::ITexture        * mpTexture;
+      IGUITexture                 * mpGUITexture;
+      std::vector<CCommandListCopy> mCommandLists;
+      ImDrawList                    mQuad;
+      bool                          mIsInvalid;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CGUILAYER_H_ */
@@ -76,6 +76,10 @@ namespace Private
       TextureSource       mSource;
       bool                mIsValid;
       ImTextureID         mGPUTextureID;
+      irr::u32            mSizeInBytes;
+      irr::u32            mWidth;
+      irr::u32            mHeight;
+      bool                mIsStreaming;
 
     protected:
   };
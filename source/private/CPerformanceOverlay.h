@@ -0,0 +1,98 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CPerformanceOverlay.h
+ * @author Andre Netzeband
+ * @brief  Contains a small window, that shows the render statistics of the GUI.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CPERFORMANCEOVERLAY_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CPERFORMANCEOVERLAY_H_
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/SIMGUIStatistics.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief A window in the upper left corner, that shows graphs of the frame time and the GUI time and the render statistics.
+  /// @details The window is built like every other IMGUI window, but its draw list is removed from the draw data before the
+  ///          GUI is rendered. Thus it can be rendered separately, without being counted by the render statistics and
+  ///          without invalidating the GUI layer in every frame.
+  class CPerformanceOverlay
+  {
+    public:
+      /// @{
+      /// @name Constructor
+
+      /// @brief Constructor.
+      CPerformanceOverlay(void);
+
+      /// @}
+
+      /// @{
+      /// @name Overlay methods
+
+      /// @brief Builds the overlay window for the current frame (must be called between ImGui::NewFrame() and ImGui::Render()).
+      ///        When it is called several times in a frame, the window is only built once.
+      /// @param rStatistics Are the render statistics of the last frame.
+      /// @param rSummary    Are the averages and percentiles of the last frames.
+      void build(SIMGUIStatistics const &rStatistics, SIMGUIStatisticsSummary const &rSummary);
+
+      /// @brief Removes the draw list of the overlay window from the draw data (must be called after ImGui::Render()).
+      /// @param pDrawData Is the draw data of the current frame.
+      /// @return Returns the draw list of the overlay window or nullptr, when the overlay has not been built in this frame.
+      ImDrawList * removeDrawList(ImDrawData * pDrawData);
+
+      /// @}
+
+    private:
+      /// @brief The number of frames, that are shown by the graphs.
+      static irr::u32 const NumberOfGraphValues = 120;
+
+      irr::f32     mFrameTimes[NumberOfGraphValues];
+      irr::f32     mGUITimes[NumberOfGraphValues];
+      irr::u32     mNextValue;
+      int          mLastFrame;
+      ImDrawList * mpDrawList;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CPERFORMANCEOVERLAY_H_ */
@@ -0,0 +1,184 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CStagingBuffer.h
+ * @author Andre Netzeband
+ * @brief  Contains a growable buffer that is reused between frames.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CSTAGINGBUFFER_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CSTAGINGBUFFER_H_
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief A buffer that only grows up to the highest requested size and is reused afterwards.
+  /// @details It is used to avoid heap allocations for temporary data during rendering.
+  ///          The memory is only released on request (trim, shrink, clear) or at destruction.
+  /// @tparam T Is the element type of the buffer. It must be default constructible.
+  template <typename T>
+  class CStagingBuffer
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CStagingBuffer(void):
+        mpData(nullptr),
+        mCapacity(0),
+        mHighWaterMark(0)
+      {
+        return;
+      }
+
+      /// @brief Destructor.
+      ~CStagingBuffer(void)
+      {
+        clear();
+        return;
+      }
+
+      /// @}
+
+      /// @{
+      /// @name Buffer access
+
+      /// @brief Returns a buffer for at least NumberOfElements elements. The content of the buffer is undefined.
+      /// @param NumberOfElements Is the number of elements that are needed.
+      /// @return Returns a pointer to the buffer memory. It is valid until the next call of a non-const method.
+      T * getBuffer(irr::u32 const NumberOfElements)
+      {
+        if (NumberOfElements > mHighWaterMark)
+        {
+          mHighWaterMark = NumberOfElements;
+        }
+
+        if (NumberOfElements > mCapacity)
+        {
+          reallocate(NumberOfElements);
+        }
+
+        return mpData;
+      }
+
+      /// @return Returns the number of elements, that fits into the buffer without a new allocation.
+      irr::u32 getCapacity(void) const
+      {
+        return mCapacity;
+      }
+
+      /// @return Returns the highest number of elements requested since the last call of shrink() or clear().
+      irr::u32 getHighWaterMark(void) const
+      {
+        return mHighWaterMark;
+      }
+
+      /// @}
+
+      /// @{
+      /// @name Memory handling
+
+      /// @brief Releases memory, when the capacity is bigger than a maximum.
+      /// @param MaxCapacity Is the maximum number of elements the buffer should keep.
+      void trim(irr::u32 const MaxCapacity)
+      {
+        if (mCapacity > MaxCapacity)
+        {
+          reallocate(MaxCapacity);
+        }
+
+        if (mHighWaterMark > MaxCapacity)
+        {
+          mHighWaterMark = MaxCapacity;
+        }
+
+        return;
+      }
+
+      /// @brief Reduces the capacity to the high water mark since the last shrink and resets the high water mark.
+      /// @details When this is called regularly (for example every few hundred frames), the buffer shrinks after a spike of usage.
+      void shrink(void)
+      {
+        trim(mHighWaterMark);
+        mHighWaterMark = 0;
+
+        return;
+      }
+
+      /// @brief Releases the whole memory.
+      void clear(void)
+      {
+        delete[] mpData;
+        mpData         = nullptr;
+        mCapacity      = 0;
+        mHighWaterMark = 0;
+
+        return;
+      }
+
+      /// @}
+
+    private:
+      /// @brief Replaces the memory with a new block. The old content is not copied.
+      /// @param NewCapacity Is the new number of elements.
+      void reallocate(irr::u32 const NewCapacity)
+      {
+        delete[] mpData;
+        mpData    = (NewCapacity > 0) ? new T[NewCapacity] : nullptr;
+        mCapacity = NewCapacity;
+
+        return;
+      }
+
+      /// @brief This class can not be copied.
+      CStagingBuffer(CStagingBuffer const &) = delete;
+
+      /// @brief This class can not be copied.
+      CStagingBuffer &operator=(CStagingBuffer const &) = delete;
+
+      T *      mpData;
+      irr::u32 mCapacity;
+      irr::u32 mHighWaterMark;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CSTAGINGBUFFER_H_ */
@@ -0,0 +1,108 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   CStatisticsHistory.h
+ * @author Andre Netzeband
+ * @brief  Contains the render statistics of the last frames.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CSTATISTICSHISTORY_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CSTATISTICSHISTORY_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/SIMGUIStatistics.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Keeps the render statistics of the last frames in a ring buffer and calculates their averages and percentiles.
+  /// @details The summary is only calculated, when it is requested after a new frame has been added. Thus adding
+  ///          a frame is cheap, even when nobody reads the summary.
+  class CStatisticsHistory
+  {
+    public:
+      /// @{
+      /// @name Constructor
+
+      /// @brief Constructor.
+      CStatisticsHistory(void);
+
+      /// @}
+
+      /// @{
+      /// @name History handling
+
+      /// @brief Sets the number of frames, that are kept. Changing the number removes all frames.
+      /// @param NumberOfFrames Is the number of frames. The value 0 disables the history.
+      void setNumberOfFrames(irr::u32 NumberOfFrames);
+
+      /// @return Returns the maximum number of frames, that are kept.
+      irr::u32 getNumberOfFrames(void) const;
+
+      /// @brief Adds the statistics of a frame. When the history is full, the oldest frame is replaced.
+      /// @param rStatistics Are the statistics of the frame.
+      void addFrame(SIMGUIStatistics const &rStatistics);
+
+      /// @brief Removes all frames.
+      void clear(void);
+
+      /// @return Returns the averages and percentiles of all kept frames.
+      SIMGUIStatisticsSummary const &getSummary(void);
+
+      /// @}
+
+    private:
+      /// @brief Returns a value of the statistics of a frame.
+      typedef irr::f32 (*TValueFunction)(SIMGUIStatistics const &rStatistics);
+
+      /// @brief Calculates the average and the percentiles of a single value over all frames.
+      /// @param pValueFunction Returns the value of a frame.
+      /// @param rValue         Returns the result.
+      void summarize(TValueFunction pValueFunction, SIMGUIStatisticValue &rValue);
+
+      std::vector<SIMGUIStatistics> mFrames;
+      std::vector<irr::f32>         mSortedValues;
+      irr::u32                      mMaxNumberOfFrames;
+      irr::u32                      mNextFrame;
+      bool                          mIsSummaryValid;
+      SIMGUIStatisticsSummary       mSummary;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CSTATISTICSHISTORY_H_ */
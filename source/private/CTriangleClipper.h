@@ -0,0 +1,175 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CTriangleClipper.h
+ * @author Andre Netzeband
+ * @brief  Contains a class that clips triangles at clipping rectangles on the CPU.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CTRIANGLECLIPPER_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CTRIANGLECLIPPER_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Clips triangles at the clipping rectangles of their draw commands and collects them in a single triangle list.
+  /// @details Triangles inside the clipping rectangle keep their vertices, triangles outside are removed and triangles, that
+  ///          cross the border, are cut with interpolated texture coordinates and colors. Thus draw commands with different
+  ///          clipping rectangles can be drawn with a single draw call and without any clipping state of the render driver.
+  ///          A batch never contains more vertices than can be addressed with 16 bit indices.
+  class CTriangleClipper
+  {
+    public:
+      /// @{
+      /// @name Constructor
+
+      /// @brief Constructor.
+      CTriangleClipper(void);
+
+      /// @}
+
+      /// @{
+      /// @name Clipping
+
+      /// @brief Starts a new batch of triangles. The vertices of the batch before are removed.
+      /// @param pVertices        Is a pointer to the vertices, that are addressed by the indices.
+      /// @param NumberOfVertices Is the number of vertices.
+      /// @param rOffset          Is the offset, that has been applied to the position of every vertex.
+      void begin(irr::video::S3DVertex const * pVertices, irr::u32 NumberOfVertices, irr::core::vector3df const &rOffset);
+
+      /// @brief Starts a new batch of triangles with the same vertices (e.g. after the batch before has been drawn).
+      void startNextBatch(void);
+
+      /// @brief Clips triangles and adds them to the batch.
+      /// @param pIndices        Is a pointer to the first index of the triangles.
+      /// @param NumberOfIndices Is the number of indices (a multiple of 3).
+      /// @param rClippingRect   Is the IMGUI clipping rectangle of the triangles.
+      /// @return Returns the number of indices, that have been processed. When it is smaller than NumberOfIndices,
+      ///         the batch is full and must be drawn before the remaining triangles can be added to a new batch.
+      irr::u32 addTriangles(irr::u16 const * pIndices, irr::u32 NumberOfIndices, ImVec4 const &rClippingRect);
+
+      /// @copydoc addTriangles
+      irr::u32 addTriangles(irr::u32 const * pIndices, irr::u32 NumberOfIndices, ImVec4 const &rClippingRect);
+
+      /// @}
+
+      /// @{
+      /// @name Batch access
+
+      /// @return Returns a pointer to the vertices of the batch.
+      irr::video::S3DVertex const * getVertices(void) const;
+
+      /// @return Returns the number of vertices of the batch.
+      irr::u32 getNumberOfVertices(void) const;
+
+      /// @return Returns a pointer to the 16 bit indices of the batch.
+      irr::u16 const * getIndices(void) const;
+
+      /// @return Returns the number of indices of the batch.
+      irr::u32 getNumberOfIndices(void) const;
+
+      /// @return Returns the number of triangles since begin(), that have been cut at the border of their clipping rectangle.
+      irr::u32 getNumberOfCutTriangles(void) const;
+
+      /// @return Returns the number of triangles since begin(), that have been removed, because they are outside of their clipping rectangle.
+      irr::u32 getNumberOfRemovedTriangles(void) const;
+
+      /// @}
+
+    private:
+      /// @brief Clips triangles and adds them to the batch.
+      /// @tparam TIndex Is the type of the indices.
+      template <typename TIndex>
+      irr::u32 addTrianglesOfType(TIndex const * pIndices, irr::u32 NumberOfIndices, ImVec4 const &rClippingRect);
+
+      /// @param SourceIndex Is the index of a vertex of the source vertex array.
+      /// @return Returns the index of the vertex inside the batch. The vertex is copied into the batch, when necessary.
+      irr::u16 getBatchIndex(irr::u32 SourceIndex);
+
+      /// @brief Cuts a triangle at the clipping rectangle and adds the visible part as triangle fan.
+      /// @param pIndices Is a pointer to the three source indices of the triangle.
+      template <typename TIndex>
+      void addCutTriangle(TIndex const * pIndices);
+
+      /// @brief The vertices, that are addressed by the indices of the triangles.
+      irr::video::S3DVertex const      * mpSourceVertices;
+
+      /// @brief The number of source vertices.
+      irr::u32                           mNumberOfSourceVertices;
+
+      /// @brief The offset, that has been applied to the source vertices.
+      irr::core::vector3df               mOffset;
+
+      /// @{
+      /// @name The borders of the current clipping rectangle (including the offset).
+      irr::f32                           mClipLeft;
+      irr::f32                           mClipTop;
+      irr::f32                           mClipRight;
+      irr::f32                           mClipBottom;
+      /// @}
+
+      /// @brief The vertices of the batch.
+      std::vector<irr::video::S3DVertex> mVertices;
+
+      /// @brief The indices of the batch.
+      std::vector<irr::u16>              mIndices;
+
+      /// @brief The batch index of every source vertex, that has been copied into the batch.
+      std::vector<irr::u16>              mBatchIndices;
+
+      /// @brief The number of the batch, where the batch index of a source vertex is valid.
+      std::vector<irr::u32>              mBatchNumbers;
+
+      /// @brief The number of the current batch.
+      irr::u32                           mBatchNumber;
+
+      /// @brief The number of cut triangles since begin().
+      irr::u32                           mNumberOfCutTriangles;
+
+      /// @brief The number of removed triangles since begin().
+      irr::u32                           mNumberOfRemovedTriangles;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CTRIANGLECLIPPER_H_ */
@@ -0,0 +1,125 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CVertexConverter.h
+ * @author Andre Netzeband
+ * @brief  Contains a converter, that converts the vertices of several IMGUI command lists in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CVERTEXCONVERTER_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CVERTEXCONVERTER_H_
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+// module includes
+#include "private/CWorkerPool.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Collects the vertices of several command lists and converts them to Irrlicht vertices.
+  /// @details The vertices are split into chunks of equal size, which are converted by a pool of worker threads.
+  ///          Small amounts of vertices are converted by the calling thread only, since waking up the workers
+  ///          would take longer than the conversion itself.
+  class CVertexConverter
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor. The vertices are converted by the calling thread only.
+      CVertexConverter(void);
+
+      /// @}
+
+      /// @{
+      /// @name Thread handling
+
+      /// @param NumberOfThreads Is the number of threads, that convert the vertices (including the calling thread).
+      ///                        0 means one thread per CPU core.
+      void setNumberOfThreads(irr::u32 NumberOfThreads);
+
+      /// @return Returns the number of threads, that convert the vertices (including the calling thread).
+      irr::u32 getNumberOfThreads(void) const;
+
+      /// @}
+
+      /// @{
+      /// @name Conversion
+
+      /// @brief Adds vertices to the next conversion.
+      /// @param pSource          Is a pointer to the first IMGUI vertex.
+      /// @param pDestination     Is a pointer to the first Irrlicht vertex. It is ignored, when IMGUI uses the Irrlicht
+      ///                         vertex layout, since the vertices are converted in place then.
+      /// @param NumberOfVertices Is the number of vertices.
+      void addVertices(ImDrawVert * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertices);
+
+      /// @brief Converts all added vertices and removes them from the converter.
+      /// @param rOffset Is an offset that is applied to the position of every vertex.
+      void convert(irr::core::vector3df const &rOffset);
+
+      /// @return Returns the number of vertices, that have been added since the last conversion.
+      irr::u32 getNumberOfVertices(void) const;
+
+      /// @}
+
+    private:
+      /// @brief A range of vertices, that is converted by a single task.
+      struct SChunk
+      {
+        ImDrawVert            * mpSource;
+        irr::video::S3DVertex * mpDestination;
+        irr::u32                mNumberOfVertices;
+      };
+
+      /// @brief Converts the vertices of a chunk.
+      /// @param rChunk  Is the chunk.
+      /// @param rOffset Is an offset that is applied to the position of every vertex.
+      static void convertChunk(SChunk const &rChunk, irr::core::vector3df const &rOffset);
+
+      std::vector<SChunk> mChunks;
+      irr::u32            mNumberOfVertices;
+      CWorkerPool         mWorkerPool;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CVERTEXCONVERTER_H_ */
@@ -0,0 +1,137 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   CWorkerPool.h
+ * @author Andre Netzeband
+ * @brief  Contains a pool of worker threads, that execute a number of tasks in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_CWORKERPOOL_H_
+#define IRRIMGUI_SOURCE_PRIVATE_CWORKERPOOL_H_
+
+// library includes
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief A pool of worker threads, that execute the tasks of a job in parallel.
+  /// @details The calling thread executes tasks as well and returns, when all tasks are finished. The worker threads
+  ///          sleep between the jobs.
+  class CWorkerPool
+  {
+    public:
+      /// @brief A task of a job.
+      /// @param TaskIndex Is the index of the task inside the job.
+      typedef std::function<void(irr::u32 TaskIndex)> Task;
+
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor. The pool starts without worker threads.
+      CWorkerPool(void);
+
+      /// @brief Destructor. Stops all worker threads.
+      ~CWorkerPool(void);
+
+      /// @}
+
+      /// @{
+      /// @name Thread handling
+
+      /// @brief Starts or stops worker threads.
+      /// @param NumberOfThreads Is the number of threads including the calling thread. 0 means one thread per CPU core.
+      void setNumberOfThreads(irr::u32 NumberOfThreads);
+
+      /// @return Returns the number of threads including the calling thread.
+      irr::u32 getNumberOfThreads(void) const;
+
+      /// @}
+
+      /// @{
+      /// @name Execution
+
+      /// @brief Executes all tasks of a job and returns, when all tasks are finished.
+      /// @param NumberOfTasks Is the number of tasks.
+      /// @param rTask         Is the function, that is called for every task index from 0 to NumberOfTasks-1.
+      void run(irr::u32 NumberOfTasks, Task const &rTask);
+
+      /// @}
+
+    private:
+      /// @brief The main function of the worker threads.
+      void runWorker(void);
+
+      /// @brief Executes tasks of the current job until there is no task left.
+      /// @param rTask         Is the task function of the job.
+      /// @param NumberOfTasks Is the number of tasks of the job.
+      /// @return Returns the number of tasks, that have been executed by the calling thread.
+      irr::u32 executeTasks(Task const &rTask, irr::u32 NumberOfTasks);
+
+      /// @brief Stops all worker threads.
+      void stopWorkers(void);
+
+      /// @brief This class can not be copied.
+      CWorkerPool(CWorkerPool const &) = delete;
+
+      /// @brief This class can not be copied.
+      CWorkerPool &operator=(CWorkerPool const &) = delete;
+
+      std::vector<std::thread> mWorkers;
+      std::mutex               mMutex;
+      std::condition_variable  mJobStarted;
+      std::condition_variable  mJobFinished;
+      Task const             * mpTask;
+      irr::u32                 mNumberOfTasks;
+      std::atomic<irr::u32>    mNextTask;
+      irr::u32                 mNumberOfFinishedTasks;
+      irr::u32                 mNumberOfActiveWorkers;
+      irr::u32                 mJobNumber;
+      bool                     mIsStopped;
+      irr::u32                 mRequestedNumberOfThreads;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_CWORKERPOOL_H_ */
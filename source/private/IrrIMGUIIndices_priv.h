@@ -0,0 +1,157 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file   IrrIMGUIIndices_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains functions to prepare IMGUI vertex indices for 16 bit draw calls.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIINDICES_PRIV_H_
+#define IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIINDICES_PRIV_H_
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+/// @brief Contains functions to prepare IMGUI vertex indices for 16 bit draw calls.
+namespace Indices
+{
+
+  /// @brief The highest difference between two indices of a single 16 bit draw call.
+  irr::u32 const MaxBatchIndexRange = 0xFFFF;
+
+  /// @brief Determines the biggest batch of triangles at the begin of an index array, which vertices can be addressed with 16 bit indices.
+  /// @param pIndices        Is a pointer to the first index.
+  /// @param NumberOfIndices Is the number of indices (must be a multiple of 3 and greater than 0).
+  /// @param rMinIndex       Returns the smallest index of the batch.
+  /// @param rMaxIndex       Returns the biggest index of the batch.
+  /// @return Returns the number of indices of the batch. It is NumberOfIndices, when all triangles fit into a single batch.
+  /// @tparam TIndex Is the type of the indices.
+  template <typename TIndex>
+  irr::u32 getBatch(TIndex const * const pIndices, irr::u32 const NumberOfIndices, irr::u32 &rMinIndex, irr::u32 &rMaxIndex)
+  {
+    irr::u32 MinIndex = pIndices[0];
+    irr::u32 MaxIndex = pIndices[0];
+    irr::u32 i        = 0;
+
+    for (; (i + 3) <= NumberOfIndices; i += 3)
+    {
+      irr::u32 NewMinIndex = MinIndex;
+      irr::u32 NewMaxIndex = MaxIndex;
+
+      for (irr::u32 Corner = 0; Corner < 3; Corner++)
+      {
+        irr::u32 const Index = pIndices[i + Corner];
+        NewMinIndex = (Index < NewMinIndex) ? Index : NewMinIndex;
+        NewMaxIndex = (Index > NewMaxIndex) ? Index : NewMaxIndex;
+      }
+
+      // the first triangle is always part of the batch, otherwise the caller would never finish
+      if ((i > 0) && ((NewMaxIndex - NewMinIndex) > MaxBatchIndexRange))
+      {
+        break;
+      }
+
+      MinIndex = NewMinIndex;
+      MaxIndex = NewMaxIndex;
+    }
+
+    rMinIndex = MinIndex;
+    rMaxIndex = MaxIndex;
+
+    return i;
+  }
+
+  /// @brief Subtracts a base index from every index of an index array and stores the result as 16 bit indices.
+  /// @param pSource         Is a pointer to the first index.
+  /// @param pDestination    Is a pointer to the array for the rebased indices.
+  /// @param NumberOfIndices Is the number of indices.
+  /// @param BaseIndex       Is the index that is subtracted (must not be greater than the smallest index).
+  /// @tparam TIndex Is the type of the source indices.
+  template <typename TIndex>
+  void rebaseIndices(TIndex const * const pSource, irr::u16 * const pDestination, irr::u32 const NumberOfIndices, irr::u32 const BaseIndex)
+  {
+    for (irr::u32 i = 0; i < NumberOfIndices; i++)
+    {
+      pDestination[i] = static_cast<irr::u16>(pSource[i] - BaseIndex);
+    }
+
+    return;
+  }
+
+  /// @brief Restores the real vertex indices of a draw list with more than 65536 vertices, which 16 bit indices have overflown.
+  /// @details IMGUI adds the vertices of every primitive directly after the vertices of the primitive before. Thus the real
+  ///          index is the one, that is closest to the highest index seen so far. This is correct as long as no triangle
+  ///          references a vertex, that is more than 32768 vertices away. Use 32 bit indices (_IRRIMGUI_32BIT_INDICES_),
+  ///          when a GUI breaks this rule.
+  /// @param pSource         Is a pointer to the first (overflown) 16 bit index.
+  /// @param pDestination    Is a pointer to the array for the 32 bit indices.
+  /// @param NumberOfIndices Is the number of indices.
+  inline void unwrapIndices(irr::u16 const * const pSource, irr::u32 * const pDestination, irr::u32 const NumberOfIndices)
+  {
+    irr::u32 const WrapSize = 0x10000;
+    irr::u32 const HalfWrapSize = WrapSize / 2;
+    irr::u32 HighestIndex = 0;
+
+    for (irr::u32 i = 0; i < NumberOfIndices; i++)
+    {
+      irr::u32 Index = (HighestIndex & ~(WrapSize - 1)) | pSource[i];
+
+      if ((Index + HalfWrapSize) < HighestIndex)
+      {
+        // the 16 bit index has overflown since the last index
+        Index += WrapSize;
+      }
+      else if ((Index > (HighestIndex + HalfWrapSize)) && (Index >= WrapSize))
+      {
+        // the index references a vertex before the last overflow
+        Index -= WrapSize;
+      }
+
+      pDestination[i] = Index;
+      HighestIndex = (Index > HighestIndex) ? Index : HighestIndex;
+    }
+
+    return;
+  }
+
+}
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIINDICES_PRIV_H_ */
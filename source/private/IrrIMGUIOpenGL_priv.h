@@ -0,0 +1,355 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IrrIMGUIOpenGL_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains OpenGL definitions and helpers, that are shared by the native OpenGL render drivers.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIOPENGL_PRIV_H_
+#define IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIOPENGL_PRIV_H_
+
+// library includes
+#include <cstddef>
+#include <string>
+#include <IrrIMGUI/IrrIMGUIConfig.h>
+#ifdef _IRRIMGUI_WINDOWS_
+#include <windows.h>
+#endif // _IRRIMGUI_WINDOWS_
+#include <GL/gl.h>
+
+// module includes
+#include <IrrIMGUI/IrrIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+// OpenGL definitions, which are missing in the OpenGL 1.1 headers of some platforms
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                 0x8892
+#endif // GL_ARRAY_BUFFER
+#ifndef GL_ELEMENT_ARRAY_BUFFER
+#define GL_ELEMENT_ARRAY_BUFFER         0x8893
+#endif // GL_ELEMENT_ARRAY_BUFFER
+#ifndef GL_ARRAY_BUFFER_BINDING
+#define GL_ARRAY_BUFFER_BINDING         0x8894
+#endif // GL_ARRAY_BUFFER_BINDING
+#ifndef GL_ELEMENT_ARRAY_BUFFER_BINDING
+#define GL_ELEMENT_ARRAY_BUFFER_BINDING 0x8895
+#endif // GL_ELEMENT_ARRAY_BUFFER_BINDING
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW                  0x88E0
+#endif // GL_STREAM_DRAW
+#ifndef GL_R8
+#define GL_R8                           0x8229
+#endif // GL_R8
+#ifndef GL_BGRA
+#define GL_BGRA                         0x80E1
+#endif // GL_BGRA
+#ifndef GL_UNSIGNED_INT_8_8_8_8_REV
+#define GL_UNSIGNED_INT_8_8_8_8_REV     0x8367
+#endif // GL_UNSIGNED_INT_8_8_8_8_REV
+#ifndef GL_TEXTURE_SWIZZLE_RGBA
+#define GL_TEXTURE_SWIZZLE_RGBA         0x8E46
+#endif // GL_TEXTURE_SWIZZLE_RGBA
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+/// @brief Contains OpenGL definitions and helpers, that are shared by the native OpenGL render drivers.
+namespace OpenGL
+{
+
+  /// @{
+  /// @name Buffer object functions (OpenGL 1.5 or ARB_vertex_buffer_object)
+
+  typedef void (APIENTRY * TGenBuffersFunction)(GLsizei Number, GLuint * pBuffers);
+  typedef void (APIENTRY * TDeleteBuffersFunction)(GLsizei Number, GLuint const * pBuffers);
+  typedef void (APIENTRY * TBindBufferFunction)(GLenum Target, GLuint Buffer);
+  typedef void (APIENTRY * TBufferDataFunction)(GLenum Target, ptrdiff_t Size, void const * pData, GLenum Usage);
+  typedef void (APIENTRY * TBufferSubDataFunction)(GLenum Target, ptrdiff_t Offset, ptrdiff_t Size, void const * pData);
+
+  /// @}
+
+  /// @{
+  /// @name Context functions
+
+  /// @brief Returns the address of an OpenGL function of the current context.
+  /// @param pName Is the name of the function.
+  /// @return Returns the function address or nullptr, when the function is not available.
+  void * getFunctionAddress(char const * pName);
+
+  /// @brief Loads an OpenGL function of the current context. When the core function is not available, the ARB extension function is used.
+  /// @param rFunction Is the function pointer to set.
+  /// @param pName     Is the name of the core function.
+  /// @return Returns true, when the function has been loaded.
+  /// @tparam TFunction Is the type of the function pointer.
+  template <typename TFunction>
+  bool loadFunction(TFunction &rFunction, char const * pName);
+
+  /// @brief Reads the version of the current OpenGL context.
+  /// @param rMajor Returns the major version number.
+  /// @param rMinor Returns the minor version number.
+  /// @return Returns false, when there is no current OpenGL context.
+  bool getVersion(int &rMajor, int &rMinor);
+
+  /// @}
+
+  /// @{
+  /// @name Index helpers
+
+  /// @param pCommandList Is a command list.
+  /// @return Returns true, when the indices of the command list are drawn as 32 bit indices.
+  bool isUsing32BitIndices(ImDrawList const * pCommandList);
+
+  /// @param pCommandList Is a command list.
+  /// @return Returns the number of bytes, that the indices of the command list need inside an index buffer object.
+  ///         It is a multiple of 4 bytes, thus the indices of the next command list are aligned for 32 bit indices.
+  size_t getStreamedIndexBytes(ImDrawList const * pCommandList);
+
+  /// @}
+
+  class CStateShadow;
+
+  /// @brief Streams the geometry of every frame into a vertex and an index buffer object (needs OpenGL 1.5 or ARB_vertex_buffer_object).
+  ///        The buffers are orphaned at the beginning of every frame, thus the driver can provide new memory for the upload,
+  ///        while the GPU still draws the frame before from the old memory.
+  class CBufferObjectStream
+  {
+    public:
+      /// @brief Creates the buffer objects for the current OpenGL context.
+      /// @param pDriver      Is a pointer to the Irrlicht video driver.
+      /// @param rStateShadow Is the shadow of the OpenGL state, that tracks the buffer bindings.
+      /// @return Returns a new stream object or nullptr, when the context does not support buffer objects.
+      static CBufferObjectStream * createStream(irr::video::IVideoDriver * pDriver, CStateShadow &rStateShadow);
+
+      /// @brief The Destructor deletes the buffer objects.
+      ~CBufferObjectStream(void);
+
+      /// @brief Binds the buffer objects and orphans their memory.
+      ///        The buffer objects, that have been bound before, are restored by CStateShadow::restore().
+      /// @param VertexBytes  Is the number of vertex bytes, that are uploaded in this frame.
+      /// @param IndexBytes   Is the number of index bytes, that are uploaded in this frame.
+      /// @param rStateShadow Is the shadow of the OpenGL state.
+      void beginFrame(size_t VertexBytes, size_t IndexBytes, CStateShadow &rStateShadow);
+
+      /// @brief Copies data into the vertex buffer object.
+      /// @param Offset Is the byte offset inside the buffer.
+      /// @param Bytes  Is the number of bytes to copy.
+      /// @param pData  Is a pointer to the data.
+      void uploadVertices(size_t Offset, size_t Bytes, void const * pData);
+
+      /// @brief Copies data into the index buffer object.
+      /// @param Offset Is the byte offset inside the buffer.
+      /// @param Bytes  Is the number of bytes to copy.
+      /// @param pData  Is a pointer to the data.
+      void uploadIndices(size_t Offset, size_t Bytes, void const * pData);
+
+    private:
+      /// @brief The Constructor is private, use createStream(...) instead.
+      CBufferObjectStream(void);
+
+      /// @brief Returns the size of a buffer, that is able to store a number of bytes.
+      /// @param Bytes       Is the number of bytes to store.
+      /// @param CurrentSize Is the current size of the buffer.
+      /// @return Returns the new size of the buffer. It only grows, thus the driver can reuse the memory of orphaned buffers.
+      static size_t getBufferSize(size_t Bytes, size_t CurrentSize);
+
+      TGenBuffersFunction    mpGenBuffers;
+      TDeleteBuffersFunction mpDeleteBuffers;
+      TBindBufferFunction    mpBindBuffer;
+      TBufferDataFunction    mpBufferData;
+      TBufferSubDataFunction mpBufferSubData;
+
+      GLuint mVertexBuffer;
+      GLuint mIndexBuffer;
+      size_t mVertexBufferSize;
+      size_t mIndexBufferSize;
+  };
+
+  /// @brief Shadows the OpenGL state, that is changed by the fixed function OpenGL driver.
+  ///        Every state value is read from OpenGL only before IrrIMGUI changes it for the first time, changes to the value that
+  ///        is already set are skipped and restore() sets only the changed states back to the values they had before begin().
+  class CStateShadow
+  {
+    public:
+      /// @brief The OpenGL states, that are shadowed.
+      enum EState
+      {
+        ES_BLEND = 0,
+        ES_CULL_FACE,
+        ES_DEPTH_TEST,
+        ES_LIGHTING,
+        ES_SCISSOR_TEST,
+        ES_TEXTURE_2D,
+        ES_VERTEX_ARRAY,
+        ES_TEXTURE_COORD_ARRAY,
+        ES_COLOR_ARRAY,
+        ES_BLEND_FUNCTION,
+        ES_COLOR_MASK,
+        ES_MATRIX_MODE,
+        ES_TEXTURE_BINDING,
+        ES_ARRAY_BUFFER_BINDING,
+        ES_ELEMENT_ARRAY_BUFFER_BINDING,
+        ES_UNPACK_ROW_LENGTH,
+        ES_UNPACK_ALIGNMENT,
+        ES_COUNT
+      };
+
+      /// @brief The Constructor does not call any OpenGL function, all state values are unknown.
+      CStateShadow(void);
+
+      /// @brief When this is true, the state values read from OpenGL are kept by begin(), otherwise they are read again after every begin().
+      /// @param IsPersistent Is true, when the application does not change the shadowed state between two begin() calls.
+      void setHostStatePersistent(bool IsPersistent);
+
+      /// @brief Starts to change the OpenGL state.
+      void begin(void);
+
+      /// @brief Enables or disables a capability or client array.
+      /// @param State     Is a state between ES_BLEND and ES_COLOR_ARRAY.
+      /// @param IsEnabled Is true to enable and false to disable it.
+      void setEnabled(EState State, bool IsEnabled);
+
+      /// @brief Sets the blend function (like glBlendFunc).
+      /// @param Source      Is the source factor.
+      /// @param Destination Is the destination factor.
+      void setBlendFunction(GLenum Source, GLenum Destination);
+
+      /// @brief Sets the color mask (like glColorMask).
+      void setColorMask(GLboolean Red, GLboolean Green, GLboolean Blue, GLboolean Alpha);
+
+      /// @brief Sets the matrix mode (like glMatrixMode).
+      /// @param Mode Is the new matrix mode.
+      void setMatrixMode(GLenum Mode);
+
+      /// @brief Binds a 2D texture (like glBindTexture).
+      /// @param Texture Is the texture to bind.
+      /// @return Returns false, when the texture has been bound already and no OpenGL function has been called.
+      bool bindTexture(GLuint Texture);
+
+      /// @brief Sets the function, that binds buffer objects. Without it the buffer bindings cannot be changed.
+      /// @param pBindBuffer Is the glBindBuffer function of the current context.
+      void setBindBufferFunction(TBindBufferFunction pBindBuffer);
+
+      /// @brief Binds a buffer object (like glBindBuffer).
+      /// @param State  Is ES_ARRAY_BUFFER_BINDING or ES_ELEMENT_ARRAY_BUFFER_BINDING.
+      /// @param Buffer Is the buffer object to bind.
+      /// @return Returns false, when the buffer object has been bound already and no OpenGL function has been called.
+      bool bindBuffer(EState State, GLuint Buffer);
+
+      /// @brief Sets a pixel unpack parameter (like glPixelStorei).
+      /// @param State Is ES_UNPACK_ROW_LENGTH or ES_UNPACK_ALIGNMENT.
+      /// @param Value Is the new value of the parameter.
+      void setUnpackParameter(EState State, GLint Value);
+
+      /// @brief Must be called when a texture is deleted, since OpenGL binds the texture 0 instead of a deleted texture.
+      /// @param Texture Is the deleted texture.
+      void onDeleteTexture(GLuint Texture);
+
+      /// @brief Forgets the current state values, thus the next change is always applied. The values before begin() are kept.
+      ///        This is used after user callbacks, which may change the OpenGL state without the shadow.
+      void invalidate(void);
+
+      /// @brief Forgets the state values, that have been read from OpenGL, thus they are read again after the next begin().
+      ///        This is used, when the application has changed the OpenGL state between two persistent frames.
+      void invalidateHostState(void);
+
+      /// @brief Restores all changed states to the values, they had before begin().
+      void restore(void);
+
+      /// @brief Compares all known state values with the real OpenGL state and takes over the real values (debug mode).
+      /// @return Returns the number of state values, which have been different from OpenGL.
+      irr::u32 validate(void);
+
+      /// @return Returns the number of state values, that have been read from OpenGL since begin() (without validate()).
+      irr::u32 getNumberOfQueries(void) const;
+
+    private:
+      /// @brief The number of values of a state (the color mask has 4 values).
+      static int const MaxNumberOfValues = 4;
+
+      /// @brief Contains the shadow of a single state.
+      struct SState
+      {
+        GLint mHostValue[MaxNumberOfValues];
+        GLint mValue[MaxNumberOfValues];
+        bool  mIsHostValueKnown;
+        bool  mIsValueKnown;
+        bool  mIsChanged;
+      };
+
+      /// @brief Sets a state value and reads the value before from OpenGL, when it is not known.
+      /// @param State   Is the state to set.
+      /// @param pValues Is an array with the new values.
+      /// @return Returns true, when an OpenGL function has been called to set the value.
+      bool set(EState State, GLint const * pValues);
+
+      /// @brief Reads a state from OpenGL.
+      static void read(EState State, GLint * pValues);
+
+      /// @brief Sets a state in OpenGL.
+      void apply(EState State, GLint const * pValues);
+
+      /// @return Returns true, when both value arrays are equal.
+      static bool isEqual(GLint const * pFirstValues, GLint const * pSecondValues);
+
+      /// @return Returns the name of a state for the log.
+      static char const * getName(EState State);
+
+      SState              mStates[ES_COUNT];
+      bool                mIsHostStatePersistent;
+      irr::u32            mNumberOfQueries;
+      TBindBufferFunction mpBindBuffer;
+  };
+
+  template <typename TFunction>
+  bool loadFunction(TFunction &rFunction, char const * const pName)
+  {
+    void * pFunction = getFunctionAddress(pName);
+
+    if (!pFunction)
+    {
+      std::string const ExtensionName = std::string(pName) + "ARB";
+      pFunction = getFunctionAddress(ExtensionName.c_str());
+    }
+
+    rFunction = reinterpret_cast<TFunction>(pFunction);
+
+    return (rFunction != nullptr);
+  }
+
+}
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIOPENGL_PRIV_H_ */
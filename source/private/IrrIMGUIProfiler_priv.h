@@ -0,0 +1,94 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IrrIMGUIProfiler_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains a helper to report the zones of IrrIMGUI to the profiler.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIPROFILER_PRIV_H_
+#define IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIPROFILER_PRIV_H_
+
+// module includes
+#include <IrrIMGUI/IProfiler.h>
+#include <IrrIMGUI/Inject/IrrIMGUIInject.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief Reports a zone to the profiler, from the construction until the destruction of this object.
+  /// @details Without profiler only the profiler pointer is read, thus the zones can stay in the code.
+  class CProfilerZone
+  {
+    public:
+      /// @brief Constructor. Begins the zone.
+      /// @param Zone Is the zone.
+      CProfilerZone(EProfilerZone const Zone):
+        mpProfiler(Inject::getProfiler()),
+        mZone(Zone)
+      {
+        if (mpProfiler != nullptr)
+        {
+          mpProfiler->beginZone(mZone);
+        }
+        return;
+      }
+
+      /// @brief Destructor. Ends the zone.
+      ~CProfilerZone(void)
+      {
+        if (mpProfiler != nullptr)
+        {
+          mpProfiler->endZone(mZone);
+        }
+        return;
+      }
+
+    private:
+      /// @brief This class can not be copied.
+      CProfilerZone(CProfilerZone const &) = delete;
+
+      /// @brief This class can not be copied.
+      CProfilerZone &operator=(CProfilerZone const &) = delete;
+
+      IProfiler     * const mpProfiler;
+      EProfilerZone   const mZone;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_IRRIMGUIPROFILER_PRIV_H_ */
@@ -0,0 +1,148 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andre Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file   IrrIMGUISIMD_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains vectorized conversion functions for the render drivers.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_PRIVATE_IRRIMGUISIMD_PRIV_H_
+#define IRRIMGUI_SOURCE_PRIVATE_IRRIMGUISIMD_PRIV_H_
+
+// module includes
+#include <IrrIMGUI/IrrIMGUIConfig.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+namespace Private
+{
+/// @brief Contains conversion functions, that use the vector instructions of the CPU.
+namespace SIMD
+{
+
+  /// @brief The instruction sets the conversion functions can use.
+  enum EInstructionSet
+  {
+    /// @brief Plain C++ code without vector instructions.
+    EIS_SCALAR,
+    /// @brief SSE2 instructions (x86 and x86-64).
+    EIS_SSE2,
+    /// @brief AVX2 instructions (x86 and x86-64).
+    EIS_AVX2,
+    /// @brief NEON instructions (ARM).
+    EIS_NEON,
+    /// @brief Number of instruction sets (not an instruction set itself).
+    EIS_COUNT
+  };
+
+  /// @{
+  /// @name Instruction set selection
+
+  /// @return Returns the fastest instruction set that is supported by the compiler and the CPU at runtime.
+  IRRIMGUI_DLL_API EInstructionSet detectInstructionSet(void);
+
+  /// @param InstructionSet Is the instruction set to check.
+  /// @return Returns true, if the instruction set can be used on this machine.
+  IRRIMGUI_DLL_API bool isInstructionSetSupported(EInstructionSet InstructionSet);
+
+  /// @return Returns the instruction set that is currently used by the conversion functions.
+  /// @note   At the first call the best supported instruction set is selected automatically.
+  IRRIMGUI_DLL_API EInstructionSet getInstructionSet(void);
+
+  /// @brief Selects the instruction set for all conversion functions (used for benchmarks and tests).
+  /// @param InstructionSet Is the instruction set to use. It must be supported by this machine.
+  /// @return Returns true, if the instruction set has been selected.
+  IRRIMGUI_DLL_API bool setInstructionSet(EInstructionSet InstructionSet);
+
+  /// @param InstructionSet Is the instruction set.
+  /// @return Returns a printable name of the instruction set.
+  IRRIMGUI_DLL_API char const * getInstructionSetName(EInstructionSet InstructionSet);
+
+  /// @}
+
+  /// @{
+  /// @name Conversion functions
+
+  /// @brief Translates an IMGUI color (Red at the LSB) to an Irrlicht color value (Blue at the LSB).
+  /// @param ImGuiColor Is the u32 color value from IMGUI.
+  /// @return Returns the u32 color value for Irrlicht.
+  inline irr::u32 convertColor(irr::u32 const ImGuiColor)
+  {
+    return (ImGuiColor & 0xFF00FF00) | ((ImGuiColor & 0x000000FF) << 16) | ((ImGuiColor >> 16) & 0x000000FF);
+  }
+
+  /// @brief Converts IMGUI vertices to Irrlicht vertices.
+  /// @param pSource        Is a pointer to the first IMGUI vertex.
+  /// @param pDestination   Is a pointer to the first Irrlicht vertex. The array must be big enough for all vertices.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  IRRIMGUI_DLL_API void convertVertices(ImDrawVert const * pSource, irr::video::S3DVertex * pDestination, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+  /// @brief Turns IMGUI vertices with the Irrlicht vertex layout into valid Irrlicht vertices without copying them.
+  /// @param pVertices      Is a pointer to the first IMGUI vertex. The vertices are changed by this function.
+  /// @param NumberOfVertex Is the number of vertices to convert.
+  /// @param rOffset        Is an offset that is applied to the position of every vertex.
+  /// @return Returns a pointer to the first Irrlicht vertex (the same memory like pVertices).
+  /// @attention Must be called only once for every vertex, since the color and the offset are applied in place.
+  IRRIMGUI_DLL_API irr::video::S3DVertex * convertVerticesInPlace(ImDrawVert * pVertices, irr::u32 NumberOfVertex, irr::core::vector3df const &rOffset);
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+  /// @}
+
+  /// @{
+  /// @name Pixel conversion functions
+
+  /// @brief Swaps the Red and Blue channel of many colors (like convertColor).
+  /// @details Translates R8G8B8A8 pixels (IMGUI and OpenGL byte order) to A8R8G8B8 pixels (Irrlicht) and vice versa.
+  /// @param pSource        Is a pointer to the first source pixel.
+  /// @param pDestination   Is a pointer to the first destination pixel. It can be the same like pSource for an in place conversion.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  IRRIMGUI_DLL_API void convertColors(irr::u32 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @brief Expands alpha values to white pixels with this alpha value.
+  /// @details The result is the same for A8R8G8B8 and R8G8B8A8 pixels.
+  /// @param pSource        Is a pointer to the first alpha value.
+  /// @param pDestination   Is a pointer to the first destination pixel. It must not overlap with the source data.
+  /// @param NumberOfPixels Is the number of pixels to convert.
+  IRRIMGUI_DLL_API void expandAlpha(irr::u8 const * pSource, irr::u32 * pDestination, irr::u32 NumberOfPixels);
+
+  /// @}
+
+}
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_PRIVATE_IRRIMGUISIMD_PRIV_H_ */
@@ -0,0 +1,240 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestCommandListCache.cpp
+ * @brief Unit Tests for checking the cache for converted command list vertices.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <CCommandListCache.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Fills a command list with a number of quads, which are drawn with a single command.
+  /// @param rCommandList    Is the command list to fill.
+  /// @param NumberOfQuads   Is the number of quads.
+  void fillCommandList(ImDrawList &rCommandList, int const NumberOfQuads)
+  {
+    rCommandList.VtxBuffer.resize(NumberOfQuads * 4);
+    rCommandList.IdxBuffer.resize(NumberOfQuads * 6);
+    rCommandList.CmdBuffer.resize(1);
+
+    for (int i = 0; i < rCommandList.VtxBuffer.size(); i++)
+    {
+      rCommandList.VtxBuffer[i].pos = ImVec2(static_cast<float>(i), static_cast<float>(i / 4));
+      rCommandList.VtxBuffer[i].uv  = ImVec2(0.0f, 0.0f);
+      rCommandList.VtxBuffer[i].col = 0xFFFFFFFF;
+    }
+
+    for (int Quad = 0; Quad < NumberOfQuads; Quad++)
+    {
+      ImDrawIdx const pIndices[] = {0, 1, 2, 0, 2, 3};
+      for (int i = 0; i < 6; i++)
+      {
+        rCommandList.IdxBuffer[Quad * 6 + i] = static_cast<ImDrawIdx>(Quad * 4 + pIndices[i]);
+      }
+    }
+
+    ImDrawCmd &rCommand = rCommandList.CmdBuffer[0];
+    rCommand.ElemCount        = NumberOfQuads * 6;
+    rCommand.ClipRect         = ImVec4(0.0f, 0.0f, 100.0f, 100.0f);
+    rCommand.TextureId        = nullptr;
+    rCommand.UserCallback     = nullptr;
+    rCommand.UserCallbackData = nullptr;
+
+    return;
+  }
+}
+
+TEST_GROUP(CommandListCache)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(CommandListCache, checkUnchangedListIsFound)
+{
+  Private::CCommandListCache Cache;
+  ImDrawList CommandList;
+  fillCommandList(CommandList, 10);
+
+  Cache.setMaxNumberOfVertices(1000);
+  Cache.startFrame();
+
+  CHECK(Cache.findVertices(&CommandList) == nullptr);
+
+  irr::video::S3DVertex * const pVertices = Cache.addCommandList(&CommandList);
+  CHECK(pVertices != nullptr);
+  CHECK_EQUAL(40, Cache.getNumberOfVertices());
+  CHECK_EQUAL(1,  Cache.getNumberOfCommandLists());
+
+  Cache.startFrame();
+  CHECK(Cache.findVertices(&CommandList) == pVertices);
+
+  return;
+}
+
+TEST(CommandListCache, checkChangedListIsNotFound)
+{
+  Private::CCommandListCache Cache;
+  ImDrawList CommandList;
+  fillCommandList(CommandList, 10);
+
+  Cache.setMaxNumberOfVertices(1000);
+  Cache.addCommandList(&CommandList);
+
+  // changed vertex
+  CommandList.VtxBuffer[5].col = 0xFF000000;
+  CHECK(Cache.findVertices(&CommandList) == nullptr);
+  Cache.addCommandList(&CommandList);
+  CHECK(Cache.findVertices(&CommandList) != nullptr);
+
+  // changed index
+  CommandList.IdxBuffer[3] = 1;
+  CHECK(Cache.findVertices(&CommandList) == nullptr);
+  Cache.addCommandList(&CommandList);
+  CHECK(Cache.findVertices(&CommandList) != nullptr);
+
+  // changed texture
+  int Texture = 0;
+  CommandList.CmdBuffer[0].TextureId = &Texture;
+  CHECK(Cache.findVertices(&CommandList) == nullptr);
+  Cache.addCommandList(&CommandList);
+  CHECK(Cache.findVertices(&CommandList) != nullptr);
+
+  // changed number of vertices
+  fillCommandList(CommandList, 11);
+  CHECK(Cache.findVertices(&CommandList) == nullptr);
+  Cache.addCommandList(&CommandList);
+  CHECK(Cache.findVertices(&CommandList) != nullptr);
+  CHECK_EQUAL(44, Cache.getNumberOfVertices());
+  CHECK_EQUAL(1,  Cache.getNumberOfCommandLists());
+
+  return;
+}
+
+TEST(CommandListCache, checkMemoryLimit)
+{
+  Private::CCommandListCache Cache;
+  ImDrawList CommandList1;
+  ImDrawList CommandList2;
+  ImDrawList HugeCommandList;
+  fillCommandList(CommandList1,    15);
+  fillCommandList(CommandList2,    15);
+  fillCommandList(HugeCommandList, 30);
+
+  Cache.setMaxNumberOfVertices(100);
+
+  CHECK(Cache.addCommandList(&CommandList1) != nullptr);
+  Cache.startFrame();
+
+  // the oldest command list is removed
+  CHECK(Cache.addCommandList(&CommandList2) != nullptr);
+  CHECK_EQUAL(60, Cache.getNumberOfVertices());
+  CHECK(Cache.findVertices(&CommandList1) == nullptr);
+  CHECK(Cache.findVertices(&CommandList2) != nullptr);
+
+  // command lists bigger than the cache are not stored
+  CHECK(Cache.addCommandList(&HugeCommandList) == nullptr);
+  CHECK(Cache.getNumberOfVertices() <= 100);
+
+  // a smaller limit removes command lists
+  Cache.setMaxNumberOfVertices(10);
+  CHECK_EQUAL(0, Cache.getNumberOfVertices());
+  CHECK_EQUAL(0, Cache.getNumberOfCommandLists());
+
+  return;
+}
+
+TEST(CommandListCache, checkUnusedListsAreRemoved)
+{
+  Private::CCommandListCache Cache;
+  ImDrawList CommandList;
+  fillCommandList(CommandList, 10);
+
+  Cache.setMaxNumberOfVertices(1000);
+  Cache.addCommandList(&CommandList);
+
+  for (int Frame = 0; Frame < 100; Frame++)
+  {
+    Cache.startFrame();
+  }
+
+  CHECK_EQUAL(0, Cache.getNumberOfVertices());
+  CHECK_EQUAL(0, Cache.getNumberOfCommandLists());
+
+  return;
+}
+
+TEST(CommandListCache, checkChangingListIsSkipped)
+{
+  Private::CCommandListCache Cache;
+  ImDrawList CommandList;
+  fillCommandList(CommandList, 10);
+
+  Cache.setMaxNumberOfVertices(1000);
+
+  // the command list changes in every frame
+  irr::u32 NumberOfCachedFrames = 0;
+  for (int Frame = 0; Frame < 32; Frame++)
+  {
+    Cache.startFrame();
+    CommandList.VtxBuffer[5].col = static_cast<ImU32>(Frame);
+    CHECK(Cache.findVertices(&CommandList) == nullptr);
+
+    if (Cache.addCommandList(&CommandList) != nullptr)
+    {
+      NumberOfCachedFrames++;
+    }
+  }
+
+  CHECK(NumberOfCachedFrames < 10);
+
+  // when the command list does not change anymore, it is cached again after some frames
+  bool IsFound = false;
+  for (int Frame = 0; (Frame < 64) && !IsFound; Frame++)
+  {
+    Cache.startFrame();
+    IsFound = Cache.findVertices(&CommandList) != nullptr;
+    if (!IsFound)
+    {
+      Cache.addCommandList(&CommandList);
+    }
+  }
+
+  CHECK(IsFound);
+
+  return;
+}
@@ -0,0 +1,182 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestDrawDataPipeline.cpp
+ * @brief Unit Tests for checking the double buffered render pipeline.
+ */
+
+// library includes
+#include <atomic>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CDrawDataPipeline.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Counts the prepared frames.
+  std::atomic<irr::u32> NumberOfPreparedFrames(0);
+
+  /// @brief Prepares a vertex array pointer for every command list of the frame.
+  void prepareFrame(Private::CDrawDataPipeline::SFrame &rFrame)
+  {
+    rFrame.mVertexArrays.assign(rFrame.mDrawData.CmdListsCount, nullptr);
+    NumberOfPreparedFrames++;
+    return;
+  }
+
+  /// @brief Fills a command list, that can be identified by its first vertex.
+  void fillCommandList(ImDrawList &rCommandList, irr::u32 const FrameNumber)
+  {
+    rCommandList.VtxBuffer.resize(3);
+    rCommandList.IdxBuffer.resize(3);
+    rCommandList.CmdBuffer.resize(1);
+
+    for (int i = 0; i < 3; i++)
+    {
+      rCommandList.VtxBuffer[i].pos = ImVec2(static_cast<float>(FrameNumber), static_cast<float>(i));
+      rCommandList.VtxBuffer[i].uv  = ImVec2(0.0f, 0.0f);
+      rCommandList.VtxBuffer[i].col = 0xFFFFFFFF;
+      rCommandList.IdxBuffer[i]     = static_cast<ImDrawIdx>(i);
+    }
+
+    rCommandList.CmdBuffer[0].ElemCount        = 3;
+    rCommandList.CmdBuffer[0].ClipRect         = ImVec4(0.0f, 0.0f, 100.0f, 100.0f);
+    rCommandList.CmdBuffer[0].TextureId        = nullptr;
+    rCommandList.CmdBuffer[0].UserCallback     = nullptr;
+    rCommandList.CmdBuffer[0].UserCallbackData = nullptr;
+
+    return;
+  }
+
+  /// @return Returns the number of the frame, which draw data has been copied into the pipeline frame.
+  irr::u32 getFrameNumber(Private::CDrawDataPipeline::SFrame const * const pFrame)
+  {
+    CHECK(pFrame != nullptr);
+    CHECK_EQUAL(1, pFrame->mDrawData.CmdListsCount);
+    return static_cast<irr::u32>(pFrame->mDrawData.CmdLists[0]->VtxBuffer[0].pos.x);
+  }
+}
+
+TEST_GROUP(DrawDataPipeline)
+{
+  TEST_SETUP()
+  {
+    NumberOfPreparedFrames = 0;
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(DrawDataPipeline, checkFramesAreDelayedByOneFrame)
+{
+  ImDrawList   CommandList;
+  ImDrawList * pCommandLists[] = {&CommandList};
+  ImDrawData   DrawData;
+  DrawData.CmdLists      = pCommandLists;
+  DrawData.CmdListsCount = 1;
+  DrawData.TotalVtxCount = 3;
+  DrawData.TotalIdxCount = 3;
+
+  {
+    Private::CDrawDataPipeline Pipeline(prepareFrame);
+
+    // the first frame is rendered immediately, since the pipeline is empty
+    fillCommandList(CommandList, 1);
+    Private::CDrawDataPipeline::SFrame * pFrame = Pipeline.push(&DrawData);
+    CHECK_EQUAL(1, getFrameNumber(pFrame));
+    CHECK_EQUAL(1, pFrame->mVertexArrays.size());
+    CHECK_EQUAL(1, NumberOfPreparedFrames.load());
+
+    for (irr::u32 FrameNumber = 2; FrameNumber < 10; FrameNumber++)
+    {
+      fillCommandList(CommandList, FrameNumber);
+      pFrame = Pipeline.push(&DrawData);
+
+      // the copy must not be affected by the changes of the original command list
+      fillCommandList(CommandList, 0);
+      CHECK_EQUAL(FrameNumber - 1, getFrameNumber(pFrame));
+      CHECK_EQUAL(1, pFrame->mVertexArrays.size());
+      CHECK(Pipeline.getLatency()  >= 0.0f);
+      CHECK(Pipeline.getWaitTime() >= 0.0f);
+    }
+  }
+
+  // the last frame is never rendered, thus the pipeline may stop before it has been prepared
+  CHECK(NumberOfPreparedFrames.load() >= 8);
+
+  return;
+}
+
+TEST(DrawDataPipeline, checkFlushRemovesWaitingFrame)
+{
+  ImDrawList   CommandList;
+  ImDrawList * pCommandLists[] = {&CommandList};
+  ImDrawData   DrawData;
+  DrawData.CmdLists      = pCommandLists;
+  DrawData.CmdListsCount = 1;
+  DrawData.TotalVtxCount = 3;
+  DrawData.TotalIdxCount = 3;
+
+  Private::CDrawDataPipeline Pipeline(prepareFrame);
+
+  fillCommandList(CommandList, 1);
+  Pipeline.push(&DrawData);
+
+  fillCommandList(CommandList, 2);
+  CHECK_EQUAL(1, getFrameNumber(Pipeline.push(&DrawData)));
+
+  // after the flush, the current frame is rendered immediately
+  Pipeline.flush();
+
+  fillCommandList(CommandList, 3);
+  CHECK_EQUAL(3, getFrameNumber(Pipeline.push(&DrawData)));
+
+  fillCommandList(CommandList, 4);
+  CHECK_EQUAL(3, getFrameNumber(Pipeline.push(&DrawData)));
+
+  return;
+}
+
+TEST(DrawDataPipeline, checkEmptyDrawData)
+{
+  ImDrawData DrawData;
+  DrawData.CmdLists      = nullptr;
+  DrawData.CmdListsCount = 0;
+  DrawData.TotalVtxCount = 0;
+  DrawData.TotalIdxCount = 0;
+
+  Private::CDrawDataPipeline Pipeline(nullptr);
+
+  Private::CDrawDataPipeline::SFrame * const pFrame = Pipeline.push(&DrawData);
+  CHECK(pFrame != nullptr);
+  CHECK_EQUAL(0, pFrame->mDrawData.CmdListsCount);
+
+  return;
+}
@@ -117,6 +117,84 @@ TEST(IIMGUIHandleMock, checkSetAndGetSettings)
   return;
 }
 
+TEST(IIMGUIHandleMock, checkGetRenderBackend)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::getRenderBackend").andReturnValue(static_cast<int>(ERB_OPENGL));
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  CHECK_EQUAL(ERB_OPENGL, pGUI->getRenderBackend());
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkGetStatistics)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  SIMGUIStatistics Statistics;
+  Statistics.mNumberOfDrawCommands = 42;
+
+  mock().expectOneCall("IIMGUIHandleMock::getStatistics").andReturnValue(static_cast<void const *>(&Statistics));
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  SIMGUIStatistics const &rReturnStatistics = pGUI->getStatistics();
+
+  POINTERS_EQUAL(&Statistics, &rReturnStatistics);
+  CHECK_EQUAL(42, rReturnStatistics.mNumberOfDrawCommands);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkGetStatisticsSummary)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  SIMGUIStatisticsSummary Summary;
+  Summary.mNumberOfFrames = 42;
+
+  mock().expectOneCall("IIMGUIHandleMock::getStatisticsSummary").andReturnValue(static_cast<void const *>(&Summary));
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  SIMGUIStatisticsSummary const &rReturnSummary = pGUI->getStatisticsSummary();
+
+  POINTERS_EQUAL(&Summary, &rReturnSummary);
+  CHECK_EQUAL(42, rReturnSummary.mNumberOfFrames);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkDrawPerformanceOverlay)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::drawPerformanceOverlay");
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  pGUI->drawPerformanceOverlay();
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
 TEST(IIMGUIHandleMock, checkFontFunctions)
 {
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
@@ -238,12 +316,14 @@ TEST(IIMGUIHandleMock, checkCreateTextures)
 
   mock().expectOneCall("IIMGUIHandleMock::createTexture").withParameter("pImage", pImage);
   mock().expectOneCall("IIMGUIHandleMock::createTexture").withParameter("pTexture", pTexture);
+  mock().expectOneCall("IIMGUIHandleMock::createTexture").withParameter("pImage", pImage).withParameter("IsStreaming", true);
   mock().ignoreOtherCalls();
 
   IIMGUIHandle * const pGUI = createIMGUI(pDevice);
 
   IGUITexture * const pGUITexture1 = pGUI->createTexture(pImage);
   IGUITexture * const pGUITexture2 = pGUI->createTexture(pTexture);
+  IGUITexture * const pGUITexture3 = pGUI->createTexture(pImage, true);
 
   pImage->drop();
 
@@ -282,6 +362,36 @@ TEST(IIMGUIHandleMock, checkUpdateTextures)
   return;
 }
 
+TEST(IIMGUIHandleMock, checkUpdateTextureRegion)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  SIMGUISettings Settings;
+  Settings.mIsGUIMouseCursorEnabled = false;
+
+  IGUITexture * const pGUITexture = nullptr;
+  irr::u32 Pixels[4 * 2] = {0};
+
+  mock().expectOneCall("IIMGUIHandleMock::updateTextureRegion")
+    .withParameter("pGUITexture", pGUITexture)
+    .withParameter("ColorFormat", irr::video::ECF_A8R8G8B8)
+    .withParameter("pPixelData", static_cast<void const *>(Pixels))
+    .withParameter("Pitch", 16u)
+    .withParameter("X", 1u)
+    .withParameter("Y", 2u)
+    .withParameter("Width", 4u)
+    .withParameter("Height", 2u);
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels, 16, 1, 2, 4, 2);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
 TEST(IIMGUIHandleMock, checkDeleteTexture)
 {
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
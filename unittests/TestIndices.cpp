@@ -0,0 +1,140 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestIndices.cpp
+ * @brief Unit Tests for checking the preparation of vertex indices for 16 bit draw calls.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUIIndices_priv.h>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(Indices)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(Indices, checkSmallRangeIsASingleBatch)
+{
+  irr::u16 const pIndices[] = {10, 11, 12, 12, 13, 10, 20, 21, 22};
+  irr::u32 MinIndex = 0;
+  irr::u32 MaxIndex = 0;
+
+  CHECK_EQUAL(9,  Private::Indices::getBatch(pIndices, 9, MinIndex, MaxIndex));
+  CHECK_EQUAL(10, MinIndex);
+  CHECK_EQUAL(22, MaxIndex);
+
+  return;
+}
+
+TEST(Indices, checkHugeRangeIsSplitAtTriangles)
+{
+  irr::u32 const pIndices[] = {0, 1, 2, 65000, 65001, 65002, 70000, 70001, 70002};
+  irr::u32 MinIndex = 0;
+  irr::u32 MaxIndex = 0;
+
+  CHECK_EQUAL(6,     Private::Indices::getBatch(&pIndices[0], 9, MinIndex, MaxIndex));
+  CHECK_EQUAL(0,     MinIndex);
+  CHECK_EQUAL(65002, MaxIndex);
+
+  CHECK_EQUAL(3,     Private::Indices::getBatch(&pIndices[6], 3, MinIndex, MaxIndex));
+  CHECK_EQUAL(70000, MinIndex);
+  CHECK_EQUAL(70002, MaxIndex);
+
+  return;
+}
+
+TEST(Indices, checkRebaseIndices)
+{
+  irr::u32 const pIndices[] = {70000, 70001, 70002, 70003};
+  irr::u16 pRebasedIndices[4];
+
+  Private::Indices::rebaseIndices(pIndices, pRebasedIndices, 4, 70000);
+
+  for (irr::u16 i = 0; i < 4; i++)
+  {
+    CHECK_EQUAL(i, pRebasedIndices[i]);
+  }
+
+  return;
+}
+
+TEST(Indices, checkUnwrapOverflownIndices)
+{
+  // quads like IMGUI creates them: 4 vertices and 6 indices per quad
+  irr::u32 const NumberOfQuads = 40000;
+  std::vector<irr::u32> RealIndices;
+  std::vector<irr::u16> OverflownIndices;
+
+  for (irr::u32 Quad = 0; Quad < NumberOfQuads; Quad++)
+  {
+    irr::u32 const Base = Quad * 4;
+    irr::u32 const pQuadIndices[] = {Base, Base + 1, Base + 2, Base, Base + 2, Base + 3};
+
+    for (irr::u32 const Index : pQuadIndices)
+    {
+      RealIndices.push_back(Index);
+      OverflownIndices.push_back(static_cast<irr::u16>(Index));
+    }
+  }
+
+  std::vector<irr::u32> UnwrappedIndices(OverflownIndices.size());
+  Private::Indices::unwrapIndices(OverflownIndices.data(), UnwrappedIndices.data(), static_cast<irr::u32>(OverflownIndices.size()));
+
+  for (size_t i = 0; i < RealIndices.size(); i++)
+  {
+    CHECK_EQUAL(RealIndices[i], UnwrappedIndices[i]);
+  }
+
+  return;
+}
+
+TEST(Indices, checkUnwrapIndicesBeforeOverflow)
+{
+  // the second triangle uses vertices before the overflow, while the first has already vertices after it
+  irr::u16 const pOverflownIndices[] = {65534, 65535, 0, 65533, 65534, 65535, 1, 2, 3};
+  irr::u32 const pRealIndices[]      = {65534, 65535, 65536, 65533, 65534, 65535, 65537, 65538, 65539};
+  irr::u32 pUnwrappedIndices[9];
+
+  Private::Indices::unwrapIndices(pOverflownIndices, pUnwrappedIndices, 9);
+
+  for (irr::u32 i = 0; i < 9; i++)
+  {
+    CHECK_EQUAL(pRealIndices[i], pUnwrappedIndices[i]);
+  }
+
+  return;
+}
@@ -39,7 +39,13 @@
 #include <IrrIMGUI/Inject/IrrIMGUIInject.h>
 #include <IrrIMGUI/IrrIMGUIConstants.h>
 #include <IrrIMGUIDebug_priv.h>
+#include <IrrIMGUISIMD_priv.h>
 #include <CGUITexture.h>
+#include <IIMGUIDriver.h>
+#include <CIrrlichtIMGUIDriver.h>
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+#include <COpenGL3IMGUIDriver.h>
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
 
 using namespace IrrIMGUI;
 
@@ -228,6 +234,1131 @@ TEST(TestIMGUIHandle, checkDrawCallback)
   return;
 }
 
+TEST(TestIMGUIHandle, checkRenderBackendSelection)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(ERB_DEFAULT, Settings.mRenderBackend);
+
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+  ERenderBackend const RenderBackends[] = {ERB_IRRLICHT, ERB_OPENGL};
+#else
+  ERenderBackend const RenderBackends[] = {ERB_IRRLICHT};
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
+
+  for (ERenderBackend const RenderBackend : RenderBackends)
+  {
+    Settings.mRenderBackend = RenderBackend;
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+    CHECK_EQUAL(RenderBackend, pGUI->getRenderBackend());
+
+    // the backend of an existing driver instance cannot be changed
+    IIMGUIHandle * const pSecondGUI = createIMGUI(pDevice);
+    CHECK_EQUAL(RenderBackend, pSecondGUI->getRenderBackend());
+    pSecondGUI->drop();
+
+    pGUI->startGUI();
+    ImGui::Text("Hello World");
+    pGUI->drawAll();
+
+    pGUI->drop();
+  }
+
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+  // the OpenGL 3.3 backend needs an OpenGL 3.3 context
+  Settings.mRenderBackend = ERB_OPENGL3;
+  IIMGUIHandle * const pOpenGL3GUI = createIMGUI(pDevice, nullptr, &Settings);
+  CHECK_EQUAL(ERB_OPENGL, pOpenGL3GUI->getRenderBackend());
+  pOpenGL3GUI->drop();
+#else
+  // without OpenGL in the library the Irrlicht backend is used instead of the OpenGL backends
+  ERenderBackend const OpenGLBackends[] = {ERB_OPENGL, ERB_OPENGL3};
+
+  for (ERenderBackend const RenderBackend : OpenGLBackends)
+  {
+    Settings.mRenderBackend = RenderBackend;
+    IIMGUIHandle * const pOpenGLGUI = createIMGUI(pDevice, nullptr, &Settings);
+    CHECK_EQUAL(ERB_IRRLICHT, pOpenGLGUI->getRenderBackend());
+    pOpenGLGUI->drop();
+  }
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
+
+  // without settings the backend from the compile time configuration is used
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+#if defined(_IRRIMGUI_NATIVE_OPENGL_) && defined(_IRRIMGUI_OPENGL_BACKENDS_)
+  CHECK_EQUAL(ERB_OPENGL, pGUI->getRenderBackend());
+#else
+  CHECK_EQUAL(ERB_IRRLICHT, pGUI->getRenderBackend());
+#endif // _IRRIMGUI_NATIVE_OPENGL_
+  pGUI->drop();
+
+  pDevice->drop();
+
+  return;
+}
+
+#ifdef _IRRIMGUI_OPENGL_BACKENDS_
+TEST(TestIMGUIHandle, checkOpenGLBufferObjectStreaming)
+{
+  // this test needs an OpenGL context, Mesa software rendering (LIBGL_ALWAYS_SOFTWARE=1) on a virtual X server is sufficient
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_OPENGL, irr::core::dimension2du(320, 240));
+  if (!pDevice)
+  {
+    std::cout << "No OpenGL context available, skip checkOpenGLBufferObjectStreaming." << std::endl;
+    return;
+  }
+
+  irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(true, Settings.mIsBufferObjectStreamingEnabled);
+
+  Settings.mRenderBackend = ERB_OPENGL;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  CHECK_EQUAL(ERB_OPENGL, pGUI->getRenderBackend());
+
+  irr::u32             NumberOfDrawCalls[2];
+  irr::u32             NumberOfStreamedBytes[2];
+  irr::video::IImage * pScreenShots[2];
+
+  for (int Mode = 0; Mode < 2; Mode++)
+  {
+    Settings.mIsBufferObjectStreamingEnabled = (Mode == 1);
+    pGUI->setSettings(Settings);
+
+    // render some frames to reuse the orphaned buffer objects from the frame before
+    for (int Frame = 0; Frame < 3; Frame++)
+    {
+      pDriver->beginScene(true, true, irr::video::SColor(255, 0, 0, 0));
+      pGUI->startGUI();
+
+      ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+      ImGui::Begin("StreamWindow");
+      ImGui::Text("First text");
+      ImGui::GetWindowDrawList()->AddDrawCmd();
+      ImGui::Text("Second text");
+      ImGui::End();
+
+      ImGui::SetNextWindowPos(ImVec2(150.0f, 120.0f));
+      ImGui::Begin("SecondStreamWindow");
+      ImGui::Text("Third text");
+      ImGui::End();
+
+      pGUI->drawAll();
+      pDriver->endScene();
+    }
+
+    NumberOfDrawCalls[Mode]     = pGUI->getStatistics().mNumberOfDrawCalls;
+    NumberOfStreamedBytes[Mode] = pGUI->getStatistics().mNumberOfStreamedBytes;
+    pScreenShots[Mode]          = pDriver->createScreenShot();
+  }
+
+  CHECK(NumberOfDrawCalls[0] > 0);
+  CHECK_EQUAL(NumberOfDrawCalls[0], NumberOfDrawCalls[1]);
+  CHECK_EQUAL(0, NumberOfStreamedBytes[0]);
+
+  // OpenGL 1.x contexts without buffer objects draw always from client memory
+  if (pDriver->queryFeature(irr::video::EVDF_VERTEX_BUFFER_OBJECT))
+  {
+    CHECK(NumberOfStreamedBytes[1] > 0);
+  }
+
+  // both paths draw the same pixels
+  CHECK(pScreenShots[0] != nullptr);
+  CHECK(pScreenShots[1] != nullptr);
+  CHECK(pScreenShots[0]->getDimension() == pScreenShots[1]->getDimension());
+
+  irr::u32 NumberOfDifferentPixels = 0;
+  for (irr::u32 Y = 0; Y < pScreenShots[0]->getDimension().Height; Y++)
+  {
+    for (irr::u32 X = 0; X < pScreenShots[0]->getDimension().Width; X++)
+    {
+      if (pScreenShots[0]->getPixel(X, Y).color != pScreenShots[1]->getPixel(X, Y).color)
+      {
+        NumberOfDifferentPixels++;
+      }
+    }
+  }
+  CHECK_EQUAL(0, NumberOfDifferentPixels);
+
+  pScreenShots[0]->drop();
+  pScreenShots[1]->drop();
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkOpenGL3RenderBackend)
+{
+  // this test needs an OpenGL 3.3 context, Mesa software rendering (LIBGL_ALWAYS_SOFTWARE=1) on a virtual X server is sufficient
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_OPENGL, irr::core::dimension2du(320, 240));
+  if (!pDevice)
+  {
+    std::cout << "No OpenGL context available, skip checkOpenGL3RenderBackend." << std::endl;
+    return;
+  }
+
+  irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  ERenderBackend const RenderBackends[] = {ERB_OPENGL, ERB_OPENGL3};
+  irr::u32             NumberOfDrawCalls[2];
+  irr::video::IImage * pScreenShots[2];
+
+  for (int Mode = 0; Mode < 2; Mode++)
+  {
+    Settings.mRenderBackend = RenderBackends[Mode];
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+    if (pGUI->getRenderBackend() != RenderBackends[Mode])
+    {
+      std::cout << "No OpenGL 3.3 context available, skip checkOpenGL3RenderBackend." << std::endl;
+      pGUI->drop();
+      pScreenShots[0]->drop();
+      pDevice->drop();
+      return;
+    }
+
+    for (int Frame = 0; Frame < 3; Frame++)
+    {
+      pDriver->beginScene(true, true, irr::video::SColor(255, 0, 0, 0));
+      pGUI->startGUI();
+
+      ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+      ImGui::Begin("ShaderWindow");
+      ImGui::Text("First text");
+      ImGui::GetWindowDrawList()->AddDrawCmd();
+      ImGui::Text("Second text");
+      ImGui::End();
+
+      ImGui::SetNextWindowPos(ImVec2(150.0f, 120.0f));
+      ImGui::Begin("SecondShaderWindow");
+      ImGui::Text("Third text");
+      ImGui::End();
+
+      pGUI->drawAll();
+      pDriver->endScene();
+    }
+
+    NumberOfDrawCalls[Mode] = pGUI->getStatistics().mNumberOfDrawCalls;
+    pScreenShots[Mode]      = pDriver->createScreenShot();
+
+    pGUI->drop();
+  }
+
+  CHECK(NumberOfDrawCalls[0] > 0);
+  CHECK_EQUAL(NumberOfDrawCalls[0], NumberOfDrawCalls[1]);
+
+  // the shader may round differently than the fixed function pipeline
+  CHECK(pScreenShots[0] != nullptr);
+  CHECK(pScreenShots[1] != nullptr);
+  CHECK(pScreenShots[0]->getDimension() == pScreenShots[1]->getDimension());
+
+  irr::s32 const Tolerance = 2;
+  irr::u32 NumberOfDifferentPixels = 0;
+  for (irr::u32 Y = 0; Y < pScreenShots[0]->getDimension().Height; Y++)
+  {
+    for (irr::u32 X = 0; X < pScreenShots[0]->getDimension().Width; X++)
+    {
+      irr::video::SColor const FixedFunctionColor = pScreenShots[0]->getPixel(X, Y);
+      irr::video::SColor const ShaderColor        = pScreenShots[1]->getPixel(X, Y);
+
+      if ((irr::core::abs_((irr::s32)FixedFunctionColor.getRed()   - (irr::s32)ShaderColor.getRed())   > Tolerance) ||
+          (irr::core::abs_((irr::s32)FixedFunctionColor.getGreen() - (irr::s32)ShaderColor.getGreen()) > Tolerance) ||
+          (irr::core::abs_((irr::s32)FixedFunctionColor.getBlue()  - (irr::s32)ShaderColor.getBlue())  > Tolerance))
+      {
+        NumberOfDifferentPixels++;
+      }
+    }
+  }
+  CHECK_EQUAL(0, NumberOfDifferentPixels);
+
+  pScreenShots[0]->drop();
+  pScreenShots[1]->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkOpenGL3ShaderFallback)
+{
+  // this test needs an OpenGL 3.3 context, Mesa software rendering (LIBGL_ALWAYS_SOFTWARE=1) on a virtual X server is sufficient
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_OPENGL, irr::core::dimension2du(320, 240));
+  if (!pDevice)
+  {
+    std::cout << "No OpenGL context available, skip checkOpenGL3ShaderFallback." << std::endl;
+    return;
+  }
+
+  if (!Private::Driver::COpenGL3IMGUIDriver::isSupported(pDevice))
+  {
+    std::cout << "No OpenGL 3.3 context available, skip checkOpenGL3ShaderFallback." << std::endl;
+    pDevice->drop();
+    return;
+  }
+
+  irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  // a shader, that cannot be compiled, selects the OpenGL backend instead of a backend, that does not draw anything
+  Private::Driver::COpenGL3IMGUIDriver::setFragmentShaderSource("#version 330\nThis is not a shader.\n");
+  Settings.mRenderBackend = ERB_OPENGL3;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  Private::Driver::COpenGL3IMGUIDriver::setFragmentShaderSource(nullptr);
+
+  CHECK_EQUAL(ERB_OPENGL, pGUI->getRenderBackend());
+
+  pDriver->beginScene(true, true, irr::video::SColor(255, 0, 0, 0));
+  pGUI->startGUI();
+  ImGui::Text("Hello World");
+  pGUI->drawAll();
+  pDriver->endScene();
+
+  CHECK(pGUI->getStatistics().mNumberOfDrawCalls > 0);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkOpenGLStateShadow)
+{
+  // this test needs an OpenGL context, Mesa software rendering (LIBGL_ALWAYS_SOFTWARE=1) on a virtual X server is sufficient
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_OPENGL, irr::core::dimension2du(320, 240));
+  if (!pDevice)
+  {
+    std::cout << "No OpenGL context available, skip checkOpenGLStateShadow." << std::endl;
+    return;
+  }
+
+  irr::video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(true,  Settings.mIsOpenGLHostStatePersistent);
+  CHECK_EQUAL(false, Settings.mIsOpenGLStateValidationEnabled);
+
+  Settings.mRenderBackend                  = ERB_OPENGL;
+  Settings.mIsOpenGLStateValidationEnabled = true;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  CHECK_EQUAL(ERB_OPENGL, pGUI->getRenderBackend());
+
+  for (int Mode = 0; Mode < 2; Mode++)
+  {
+    Settings.mIsOpenGLHostStatePersistent = (Mode == 1);
+    pGUI->setSettings(Settings);
+
+    for (int Frame = 0; Frame < 4; Frame++)
+    {
+      if ((Mode == 1) && (Frame == 2))
+      {
+        // the application tells the GUI, that it has changed the OpenGL state
+        pGUI->invalidateOpenGLState();
+      }
+
+      pDriver->beginScene(true, true, irr::video::SColor(255, 0, 0, 0));
+      pGUI->startGUI();
+
+      ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+      ImGui::Begin("ShadowWindow");
+      ImGui::Text("First text");
+      ImGui::GetWindowDrawList()->AddDrawCmd();
+      ImGui::Text("Second text");
+      ImGui::End();
+
+      pGUI->drawAll();
+      pDriver->endScene();
+
+      SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+      CHECK_EQUAL(0, rStatistics.mNumberOfStateMismatches);
+
+      // commands with the same texture do not bind it again
+      CHECK(rStatistics.mNumberOfSavedMaterialSwitches > 0);
+
+      if ((Mode == 0) || (Frame == 2))
+      {
+        CHECK(rStatistics.mNumberOfStateQueries > 0);
+      }
+      else if (Frame > 0)
+      {
+        // the persistent host state is not read again, until it has been invalidated
+        CHECK_EQUAL(0, rStatistics.mNumberOfStateQueries);
+      }
+    }
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+#endif // _IRRIMGUI_OPENGL_BACKENDS_
+
+#ifndef _IRRIMGUI_NATIVE_OPENGL_
+TEST(TestIMGUIHandle, checkMaterialSwitchStatistics)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  mock().ignoreOtherCalls();
+
+  pGUI->startGUI();
+
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("Some text");
+  ImGui::End();
+
+  ImGui::Begin("SecondWindow");
+  ImGui::Text("Some other text");
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  // all commands use the font texture, thus the material is applied only once
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfDrawCommands >= 2);
+  CHECK_EQUAL(1, rStatistics.mNumberOfMaterialSwitches);
+  CHECK_EQUAL(rStatistics.mNumberOfDrawCalls - 1, rStatistics.mNumberOfSavedMaterialSwitches);
+
+  // a callback invalidates the material
+  pGUI->startGUI();
+
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("Some text");
+  ImGui::GetWindowDrawList()->AddCallback(checkDrawCommand, static_cast<void *>(&ArgumentTest));
+  ImGui::Text("Some text after the callback");
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  CHECK_EQUAL(2, rStatistics.mNumberOfMaterialSwitches);
+  CHECK_EQUAL(rStatistics.mNumberOfDrawCalls - 2, rStatistics.mNumberOfSavedMaterialSwitches);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkCallbackInvalidatesClipping)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  mock().ignoreOtherCalls();
+
+  pGUI->startGUI();
+
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("Some text");
+  ImGui::Text("Some text after the callback");
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  irr::u32 const NumberOfClipChanges = rStatistics.mNumberOfClipChanges;
+  CHECK(NumberOfClipChanges > 0);
+
+  // the callback could change the viewport or the clipping planes, thus the same clipping rectangle is applied again
+  pGUI->startGUI();
+
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("Some text");
+  ImGui::GetWindowDrawList()->AddCallback(checkDrawCommand, static_cast<void *>(&ArgumentTest));
+  ImGui::Text("Some text after the callback");
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  CHECK_EQUAL(NumberOfClipChanges + 1, rStatistics.mNumberOfClipChanges);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+void storeClippingState(ImDrawList const * const pParentList, ImDrawCmd const * const pCmd)
+{
+  // the value is set to 0 or 1, thus it is still 2 when the callback has not been called
+  int * const pIsClippingEnabled = static_cast<int *>(pCmd->UserCallbackData);
+  *pIsClippingEnabled = Private::Driver::CIrrlichtIMGUIDriver::isClippingEnabled() ? 1 : 0;
+  return;
+}
+
+TEST(TestIMGUIHandle, checkCallbackIsNotClipped)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  mock().ignoreOtherCalls();
+
+  EClippingMode const ClippingModes[] = {ECM_CLIP_PLANES, ECM_VIEWPORT};
+
+  for (int ModeIndex = 0; ModeIndex < 2; ModeIndex++)
+  {
+    SIMGUISettings Settings;
+    Settings.mClippingMode = ClippingModes[ModeIndex];
+    pGUI->setSettings(Settings);
+
+    int IsClippingEnabled = 2;
+
+    pGUI->startGUI();
+
+    ImGui::Begin("FirstWindow");
+    ImGui::Text("Some text");
+    ImGui::GetWindowDrawList()->AddCallback(storeClippingState, static_cast<void *>(&IsClippingEnabled));
+    ImGui::Text("Some text after the callback");
+    ImGui::End();
+
+    pGUI->drawAll();
+
+    // the text before the callback has been drawn with clipping, but the callback is called without it
+    CHECK_EQUAL(0, IsClippingEnabled);
+    CHECK_EQUAL(false, Private::Driver::CIrrlichtIMGUIDriver::isClippingEnabled());
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkStatisticsSummary)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(120, Settings.mNumberOfStatisticFrames);
+
+  Settings.mNumberOfStatisticFrames = 4;
+  pGUI->setSettings(Settings);
+
+  for (int Frame = 0; Frame < 6; Frame++)
+  {
+    pGUI->startGUI();
+
+    ImGui::Begin("FirstWindow");
+    ImGui::Text("Some text");
+    ImGui::End();
+
+    ImGui::Begin("SecondWindow");
+    ImGui::Text("Some other text");
+    ImGui::End();
+
+    pGUI->drawAll();
+  }
+
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfCommandLists >= 2);
+  CHECK(rStatistics.mNumberOfVertices > 0);
+  CHECK(rStatistics.mNumberOfIndices  > 0);
+  CHECK(rStatistics.mNumberOfClipChanges > 0);
+  CHECK(rStatistics.mNumberOfConvertedBytes > 0);
+  CHECK(rStatistics.mRenderTime     >= 0.0f);
+  CHECK(rStatistics.mSubmissionTime >= 0.0f);
+
+  // every frame draws the same GUI, thus all frames have the same number of command lists
+  SIMGUIStatisticsSummary const &rSummary = pGUI->getStatisticsSummary();
+  CHECK_EQUAL(4, rSummary.mNumberOfFrames);
+  CHECK_EQUAL(static_cast<irr::f32>(rStatistics.mNumberOfCommandLists), rSummary.mNumberOfCommandLists.mAverage);
+  CHECK_EQUAL(static_cast<irr::f32>(rStatistics.mNumberOfCommandLists), rSummary.mNumberOfCommandLists.mPercentile99);
+  CHECK(rSummary.mTotalTime.mMaximum >= rSummary.mTotalTime.mMedian);
+
+  // the summary can be switched off
+  Settings.mNumberOfStatisticFrames = 0;
+  pGUI->setSettings(Settings);
+
+  pGUI->startGUI();
+  ImGui::Text("Hello World");
+  pGUI->drawAll();
+
+  CHECK_EQUAL(0, pGUI->getStatisticsSummary().mNumberOfFrames);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkPerformanceOverlay)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(false, Settings.mIsPerformanceOverlayEnabled);
+
+  pGUI->startGUI();
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("Some text");
+  ImGui::End();
+  pGUI->drawAll();
+
+  SIMGUIStatistics const Statistics = pGUI->getStatistics();
+  CHECK(Statistics.mTextureMemory > 0);
+
+  // the overlay is not counted by the statistics, regardless if it is enabled by the settings or drawn by a call
+  Settings.mIsPerformanceOverlayEnabled = true;
+  pGUI->setSettings(Settings);
+
+  for (int Frame = 0; Frame < 2; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Begin("FirstWindow");
+    ImGui::Text("Some text");
+    ImGui::End();
+    pGUI->drawPerformanceOverlay();
+    pGUI->drawAll();
+
+    SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+    CHECK_EQUAL(Statistics.mNumberOfCommandLists, rStatistics.mNumberOfCommandLists);
+    CHECK_EQUAL(Statistics.mNumberOfVertices,     rStatistics.mNumberOfVertices);
+    CHECK_EQUAL(Statistics.mNumberOfDrawCommands, rStatistics.mNumberOfDrawCommands);
+    CHECK_EQUAL(Statistics.mNumberOfDrawCalls,    rStatistics.mNumberOfDrawCalls);
+  }
+
+  // the texture memory contains all GUI textures
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(16, 16));
+  IGUITexture * const pTexture = pGUI->createTexture(pImage);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(Statistics.mTextureMemory + 16 * 16 * 4, pGUI->getStatistics().mTextureMemory);
+
+  pGUI->deleteTexture(pTexture);
+  pImage->drop();
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(Statistics.mTextureMemory, pGUI->getStatistics().mTextureMemory);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkDrawCommandMerging)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(true, Settings.mIsDrawCommandMergingEnabled);
+
+  irr::u32 NumberOfDrawCalls[2];
+  irr::u32 NumberOfDrawCommands[2];
+
+  for (int i = 0; i < 2; i++)
+  {
+    Settings.mIsDrawCommandMergingEnabled = (i == 1);
+    pGUI->setSettings(Settings);
+
+    pGUI->startGUI();
+
+    // every AddDrawCmd creates a command with the same texture and clipping rectangle like the command before
+    ImGui::Begin("MergeWindow");
+    ImGui::Text("First text");
+    ImGui::GetWindowDrawList()->AddDrawCmd();
+    ImGui::Text("Second text");
+    ImGui::GetWindowDrawList()->AddDrawCmd();
+    ImGui::Text("Third text");
+    ImGui::End();
+
+    pGUI->drawAll();
+
+    NumberOfDrawCalls[i]    = pGUI->getStatistics().mNumberOfDrawCalls;
+    NumberOfDrawCommands[i] = pGUI->getStatistics().mNumberOfDrawCommands;
+
+    if (i == 0)
+    {
+      CHECK_EQUAL(0, pGUI->getStatistics().mNumberOfMergedDrawCommands);
+    }
+  }
+
+  CHECK_EQUAL(NumberOfDrawCommands[0], NumberOfDrawCommands[1]);
+  CHECK(NumberOfDrawCalls[0] <= NumberOfDrawCommands[0]);
+  CHECK(NumberOfDrawCalls[1] + 2 <= NumberOfDrawCalls[0]);
+  CHECK(pGUI->getStatistics().mNumberOfMergedDrawCommands >= 2);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkVertexSubRangeSubmission)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  Settings.mIsDrawCommandMergingEnabled = false;
+  pGUI->setSettings(Settings);
+
+  pGUI->startGUI();
+
+  ImGui::Begin("SubRangeWindow");
+  ImGui::Text("First text");
+  ImGui::GetWindowDrawList()->AddDrawCmd();
+  ImGui::Text("Second text");
+  ImGui::GetWindowDrawList()->AddDrawCmd();
+  ImGui::Text("Third text");
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  // every command uses own vertices, thus every vertex is submitted only once
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfDrawCalls > rStatistics.mNumberOfCommandLists);
+  CHECK(rStatistics.mNumberOfSubmittedVertices > 0);
+  CHECK(rStatistics.mNumberOfSubmittedVertices <= rStatistics.mNumberOfVertices);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkMeshBufferStreaming)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(false, Settings.mIsMeshBufferStreamingEnabled);
+
+  irr::u32 NumberOfDrawCalls[2];
+  irr::u32 NumberOfSubmittedVertices[2];
+
+  for (int i = 0; i < 2; i++)
+  {
+    Settings.mIsMeshBufferStreamingEnabled = (i == 1);
+    pGUI->setSettings(Settings);
+
+    // render some frames to reuse the mesh buffers from the frame before
+    for (int Frame = 0; Frame < 3; Frame++)
+    {
+      pGUI->startGUI();
+
+      ImGui::Begin("StreamWindow");
+      ImGui::Text("First text");
+      ImGui::GetWindowDrawList()->AddDrawCmd();
+      ImGui::Text("Second text");
+      ImGui::End();
+
+      pGUI->drawAll();
+    }
+
+    NumberOfDrawCalls[i]         = pGUI->getStatistics().mNumberOfDrawCalls;
+    NumberOfSubmittedVertices[i] = pGUI->getStatistics().mNumberOfSubmittedVertices;
+  }
+
+  // both render modes draw the same geometry
+  CHECK(NumberOfDrawCalls[0] > 0);
+  CHECK_EQUAL(NumberOfDrawCalls[0],         NumberOfDrawCalls[1]);
+  CHECK_EQUAL(NumberOfSubmittedVertices[0], NumberOfSubmittedVertices[1]);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkCommandListCache)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(true, Settings.mIsCommandListCacheEnabled);
+
+  for (int i = 0; i < 2; i++)
+  {
+    Settings.mIsCommandListCacheEnabled = (i == 1);
+    pGUI->setSettings(Settings);
+
+    // the window needs some frames to find its final size
+    for (int Frame = 0; Frame < 5; Frame++)
+    {
+      pGUI->startGUI();
+
+      ImGui::Begin("StaticWindow");
+      ImGui::Text("This text does not change.");
+      ImGui::End();
+
+      pGUI->drawAll();
+    }
+
+    SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+
+#ifndef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    if (Settings.mIsCommandListCacheEnabled)
+    {
+      CHECK(rStatistics.mNumberOfCacheHits > 0);
+      CHECK_EQUAL(0, rStatistics.mNumberOfCacheMisses);
+      CHECK(rStatistics.mNumberOfCachedVertices > 0);
+      CHECK(rStatistics.mNumberOfCachedVertices <= Settings.mMaxCachedVertices);
+    }
+    else
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    {
+      CHECK_EQUAL(0, rStatistics.mNumberOfCacheHits);
+      CHECK_EQUAL(0, rStatistics.mNumberOfCacheMisses);
+      CHECK_EQUAL(0, rStatistics.mNumberOfCachedVertices);
+    }
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkGUILayer)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(false, Settings.mIsGUILayerEnabled);
+
+  Settings.mIsGUILayerEnabled = true;
+  pGUI->setSettings(Settings);
+
+  for (int Frame = 0; Frame < 5; Frame++)
+  {
+    pGUI->startGUI();
+
+    ImGui::Begin("StaticWindow");
+    ImGui::Text("This text does not change.");
+    ImGui::End();
+
+    pGUI->drawAll();
+  }
+
+  // the null driver does not support render targets, thus the GUI is rendered directly in every frame
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfDrawCalls > 0);
+  CHECK_EQUAL(0, rStatistics.mNumberOfCachedLayerFrames);
+  CHECK_EQUAL(5, rStatistics.mNumberOfRenderedLayerFrames);
+
+  pGUI->invalidateGUILayer();
+
+  Settings.mIsGUILayerEnabled = false;
+  pGUI->setSettings(Settings);
+
+  pGUI->startGUI();
+  ImGui::Text("Hello World");
+  pGUI->drawAll();
+
+  CHECK(rStatistics.mNumberOfDrawCalls > 0);
+  CHECK_EQUAL(0, rStatistics.mNumberOfCachedLayerFrames);
+  CHECK_EQUAL(0, rStatistics.mNumberOfRenderedLayerFrames);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkGUILayerConvertsVerticesOnce)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  mock().ignoreOtherCalls();
+
+  // a single triangle with known vertices
+  ImVec2 const Positions[3] = {ImVec2(10.0f, 20.0f), ImVec2(30.0f, 20.0f), ImVec2(10.0f, 40.0f)};
+  ImU32  const Colors[3]    = {0xFF0000FF, 0xFF00FF00, 0x80FF0000};
+
+  ImDrawList Triangle;
+  Triangle.VtxBuffer.resize(3);
+  Triangle.IdxBuffer.resize(3);
+  Triangle.CmdBuffer.resize(1);
+
+  for (int i = 0; i < 3; i++)
+  {
+    Triangle.VtxBuffer[i].pos = Positions[i];
+    Triangle.VtxBuffer[i].uv  = ImVec2(0.0f, 0.0f);
+    Triangle.VtxBuffer[i].col = Colors[i];
+    Triangle.IdxBuffer[i]     = static_cast<ImDrawIdx>(i);
+  }
+
+  ImDrawCmd &rCommand = Triangle.CmdBuffer[0];
+  rCommand.ElemCount        = 3;
+  rCommand.ClipRect         = ImVec4(0.0f, 0.0f, 100.0f, 100.0f);
+  rCommand.TextureId        = ImGui::GetIO().Fonts->TexID;
+  rCommand.UserCallback     = nullptr;
+  rCommand.UserCallbackData = nullptr;
+
+  ImDrawList * pTriangle = &Triangle;
+  ImDrawData   DrawData;
+  DrawData.CmdLists      = &pTriangle;
+  DrawData.CmdListsCount = 1;
+  DrawData.TotalVtxCount = 3;
+  DrawData.TotalIdxCount = 3;
+
+  // the GUI layer draws the same draw data twice: once for the colors and once for the alpha coverage
+  void (* const pRenderFunction)(ImDrawData *) = ImGui::GetIO().RenderDrawListsFn;
+  irr::u32 const NumberOfDrawCallsBefore = pGUI->getStatistics().mNumberOfDrawCalls;
+  Private::IIMGUIDriver::setBlendMode(Private::EBM_COLOR_ONLY);
+  pRenderFunction(&DrawData);
+  irr::u32 const NumberOfFirstPassDrawCalls = pGUI->getStatistics().mNumberOfDrawCalls - NumberOfDrawCallsBefore;
+  Private::IIMGUIDriver::setBlendMode(Private::EBM_ACCUMULATE_ALPHA);
+  Private::IIMGUIDriver::setDrawDataRepeated(true);
+  pRenderFunction(&DrawData);
+  Private::IIMGUIDriver::setDrawDataRepeated(false);
+  Private::IIMGUIDriver::setBlendMode(Private::EBM_STANDARD);
+
+  // the statistics are accumulated over both passes
+  CHECK(NumberOfFirstPassDrawCalls > 0);
+  CHECK_EQUAL(NumberOfDrawCallsBefore + 2 * NumberOfFirstPassDrawCalls, pGUI->getStatistics().mNumberOfDrawCalls);
+
+  for (int i = 0; i < 3; i++)
+  {
+    // the null driver uses no pixel offset
+    CHECK_EQUAL(Positions[i].x, Triangle.VtxBuffer[i].pos.x);
+    CHECK_EQUAL(Positions[i].y, Triangle.VtxBuffer[i].pos.y);
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    // the vertices are converted in place exactly once, a second conversion would swap the colors back
+    CHECK_EQUAL(Private::SIMD::convertColor(Colors[i]), Triangle.VtxBuffer[i].col);
+#else
+    CHECK_EQUAL(Colors[i], Triangle.VtxBuffer[i].col);
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkClippingModes)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(ECM_CLIP_PLANES, Settings.mClippingMode);
+
+  EClippingMode const ClippingModes[] = {ECM_CLIP_PLANES, ECM_VIEWPORT, ECM_SCISSOR, ECM_CPU};
+
+  for (EClippingMode const ClippingMode : ClippingModes)
+  {
+    Settings.mClippingMode = ClippingMode;
+    pGUI->setSettings(Settings);
+
+    pGUI->startGUI();
+
+    ImGui::Begin("ClippedWindow");
+    ImGui::Text("This text is clipped by the window.");
+    ImGui::End();
+
+    pGUI->drawAll();
+
+    // the viewport of the render target must be restored after the GUI has been drawn
+    irr::core::dimension2d<irr::u32> const &rScreenSize = pDevice->getVideoDriver()->getScreenSize();
+    irr::core::rect<irr::s32> const &rViewPort = pDevice->getVideoDriver()->getViewPort();
+    CHECK_EQUAL(static_cast<irr::s32>(rScreenSize.Width),  rViewPort.getWidth());
+    CHECK_EQUAL(static_cast<irr::s32>(rScreenSize.Height), rViewPort.getHeight());
+    CHECK(pGUI->getStatistics().mNumberOfDrawCalls > 0);
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkFrameMerging)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(false, Settings.mIsFrameMergingEnabled);
+
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  irr::u32 DrawCalls[2] = {0, 0};
+
+  for (int Mode = 0; Mode < 2; Mode++)
+  {
+    Settings.mIsFrameMergingEnabled = (Mode == 1);
+    pGUI->setSettings(Settings);
+
+    pGUI->startGUI();
+
+    ImGui::Begin("FirstWindow");
+    ImGui::Text("First");
+    ImGui::End();
+
+    ImGui::Begin("SecondWindow");
+    ImGui::Text("Second");
+    ImGui::End();
+
+    pGUI->drawAll();
+
+    DrawCalls[Mode] = rStatistics.mNumberOfDrawCalls;
+    CHECK(DrawCalls[Mode] > 0);
+  }
+
+  // the commands of different windows are merged, when they have the same texture and clipping rectangle
+  CHECK(rStatistics.mNumberOfMergedCommandLists > 1);
+  CHECK(DrawCalls[1] <= DrawCalls[0]);
+
+  // with CPU clipping all commands with the font texture are drawn together
+  Settings.mClippingMode = ECM_CPU;
+  pGUI->setSettings(Settings);
+
+  pGUI->startGUI();
+  ImGui::Begin("FirstWindow");
+  ImGui::Text("First");
+  ImGui::End();
+  ImGui::Begin("SecondWindow");
+  ImGui::Text("Second");
+  ImGui::End();
+  pGUI->drawAll();
+
+  CHECK_EQUAL(1, rStatistics.mNumberOfDrawCalls);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkPipelinedRendering)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  SIMGUISettings Settings;
+
+  mock().ignoreOtherCalls();
+
+  CHECK_EQUAL(false, Settings.mIsPipelinedRenderingEnabled);
+
+  Settings.mIsPipelinedRenderingEnabled = true;
+  pGUI->setSettings(Settings);
+
+  for (int Frame = 0; Frame < 5; Frame++)
+  {
+    pGUI->startGUI();
+
+    ImGui::Begin("ChangingWindow");
+    ImGui::Text("Frame %d", Frame);
+    ImGui::End();
+
+    pGUI->drawAll();
+  }
+
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfDrawCalls > 0);
+  CHECK(rStatistics.mPipelineLatency  >= 0.0f);
+  CHECK(rStatistics.mPipelineWaitTime >= 0.0f);
+
+  // a texture can be deleted while a frame waits inside the pipeline
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(4, 4));
+  IGUITexture * const pTexture = pGUI->createTexture(pImage);
+
+  pGUI->startGUI();
+  ImGui::Image(*pTexture, ImVec2(4.0f, 4.0f));
+  pGUI->drawAll();
+
+  pGUI->deleteTexture(pTexture);
+  pImage->drop();
+
+  pGUI->startGUI();
+  ImGui::Text("Hello World");
+  pGUI->drawAll();
+
+  // the pipeline can be switched off at any time
+  Settings.mIsPipelinedRenderingEnabled = false;
+  pGUI->setSettings(Settings);
+
+  pGUI->startGUI();
+  ImGui::Text("Hello World");
+  pGUI->drawAll();
+
+  CHECK(rStatistics.mNumberOfDrawCalls > 0);
+  CHECK_EQUAL(0.0f, rStatistics.mPipelineLatency);
+  CHECK_EQUAL(0.0f, rStatistics.mPipelineWaitTime);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkHugeCommandList)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  mock().ignoreOtherCalls();
+
+  pGUI->startGUI();
+
+  // a single window with more vertices than 16 bit indices can address
+  ImGui::Begin("HugeWindow");
+  ImDrawList * const pDrawList = ImGui::GetWindowDrawList();
+  for (int i = 0; i < 20000; i++)
+  {
+    float const X = static_cast<float>(i % 200);
+    float const Y = static_cast<float>(i / 200);
+    pDrawList->AddRectFilled(ImVec2(X, Y), ImVec2(X + 1.0f, Y + 1.0f), 0xFFFFFFFF);
+  }
+  ImGui::End();
+
+  pGUI->drawAll();
+
+  // the vertices are drawn in several draw calls that are addressable with 16 bit indices
+  SIMGUIStatistics const &rStatistics = pGUI->getStatistics();
+  CHECK(rStatistics.mNumberOfVertices > 65536);
+  CHECK(rStatistics.mNumberOfDrawCalls >= 2);
+  CHECK(rStatistics.mNumberOfSubmittedVertices >= rStatistics.mNumberOfVertices);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+#endif // _IRRIMGUI_NATIVE_OPENGL_
 
 /**
  * The following three functions for Base85 encoding are mostly copied from:
@@ -461,3 +1592,133 @@ TEST(TestIMGUIHandle, checkTextureTextureCreation)
   pGUI->drop();
   pDevice->drop();
 }
+
+TEST(TestIMGUIHandle, checkTextureRegionUpdate)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(64, 32));
+  IGUITexture * const pGUITexture = pGUI->createTexture(pImage);
+  Private::CGUITexture * const pRealGUITexture = dynamic_cast<IrrIMGUI::Private::CGUITexture*>(pGUITexture);
+
+  CHECK_EQUAL(64, pRealGUITexture->mWidth);
+  CHECK_EQUAL(32, pRealGUITexture->mHeight);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  irr::u32 const TextureMemory = pGUI->getStatistics().mTextureMemory;
+
+  ImTextureID const GPUTextureID = pRealGUITexture->mGPUTextureID;
+  irr::u32 Pixels[8 * 4];
+  irr::u16 SmallPixels[8 * 4];
+
+  for (irr::u32 i = 0; i < 8 * 4; i++)
+  {
+    Pixels[i]      = 0xFF000000 | (i * 2654435761u >> 8);
+    SmallPixels[i] = static_cast<irr::u16>(i * 2654435761u);
+  }
+
+  // the texture is updated in place
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels,      8 * 4, 56, 28, 8, 4);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels,      4 * 4,  0,  0, 4, 8);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_R5G6B5,   SmallPixels, 8 * 2, 10, 10, 8, 4);
+
+  CHECK_EQUAL(true,                pRealGUITexture->mIsValid);
+  CHECK_EQUAL(Private::ETST_IMAGE, pRealGUITexture->mSourceType);
+  CHECK_EQUAL(pImage,              pRealGUITexture->mSource.ImageID);
+  CHECK_EQUAL(GPUTextureID,        pRealGUITexture->mGPUTextureID);
+
+  // regions outside of the texture are ignored
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels, 8 * 4, 57, 0, 8, 4);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels, 8 * 4, 0, 29, 8, 4);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels, 8 * 4, 0, 0,  0, 0);
+
+  // regions, where X + Width or Y + Height overflows, are ignored as well
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels,      8 * 4, 56,          0,           0xFFFFFFF0u, 4);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels,      8 * 4, 0,           28,          8,           0xFFFFFFF0u);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_A8R8G8B8, Pixels,      8 * 4, 0xFFFFFFF0u, 0,           8,           4);
+  pGUI->updateTextureRegion(pGUITexture, irr::video::ECF_R5G6B5,   SmallPixels, 8 * 2, 0,           0xFFFFFFF0u, 8,           4);
+
+  CHECK_EQUAL(GPUTextureID, pRealGUITexture->mGPUTextureID);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(TextureMemory, pGUI->getStatistics().mTextureMemory);
+
+  pGUI->deleteTexture(pGUITexture);
+
+  pImage->drop();
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkStreamingTexture)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  irr::video::IImage * const pImage1 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(64, 64));
+  irr::video::IImage * const pImage2 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(64, 64));
+  irr::video::IImage * const pImage3 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(32, 32));
+
+  IGUITexture * const pStreamingTexture = pGUI->createTexture(pImage1, true);
+  IGUITexture * const pStaticTexture    = pGUI->createTexture(pImage1);
+
+  Private::CGUITexture * const pRealStreamingTexture = dynamic_cast<IrrIMGUI::Private::CGUITexture*>(pStreamingTexture);
+  Private::CGUITexture * const pRealStaticTexture    = dynamic_cast<IrrIMGUI::Private::CGUITexture*>(pStaticTexture);
+
+  CHECK_EQUAL(true,  pRealStreamingTexture->mIsStreaming);
+  CHECK_EQUAL(false, pRealStaticTexture->mIsStreaming);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK(pGUI->getStatistics().mNumberOfTextureAllocations >= 2);
+  CHECK_EQUAL(0, pGUI->getStatistics().mNumberOfTextureUploads);
+
+  ImTextureID const GPUTextureID = pRealStreamingTexture->mGPUTextureID;
+
+  // in steady state the streaming texture is updated in place
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->updateTexture(pStreamingTexture, (Frame % 2) ? pImage1 : pImage2);
+
+    pGUI->startGUI();
+    pGUI->drawAll();
+    CHECK_EQUAL(0, pGUI->getStatistics().mNumberOfTextureAllocations);
+    CHECK_EQUAL(1, pGUI->getStatistics().mNumberOfTextureUploads);
+  }
+
+  CHECK_EQUAL(GPUTextureID, pRealStreamingTexture->mGPUTextureID);
+  CHECK_EQUAL(pImage2,      pRealStreamingTexture->mSource.ImageID);
+
+  // other textures are recreated with every update
+  pGUI->updateTexture(pStaticTexture, pImage2);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(1, pGUI->getStatistics().mNumberOfTextureAllocations);
+  CHECK_EQUAL(0, pGUI->getStatistics().mNumberOfTextureUploads);
+
+  // a new image size needs a new texture
+  pGUI->updateTexture(pStreamingTexture, pImage3);
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(1,  pGUI->getStatistics().mNumberOfTextureAllocations);
+  CHECK_EQUAL(32, pRealStreamingTexture->mWidth);
+  CHECK_EQUAL(true, pRealStreamingTexture->mIsStreaming);
+
+  pGUI->deleteTexture(pStreamingTexture);
+  pGUI->deleteTexture(pStaticTexture);
+
+  pImage1->drop();
+  pImage2->drop();
+  pImage3->drop();
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
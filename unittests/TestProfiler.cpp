@@ -0,0 +1,207 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestProfiler.cpp
+ * @brief Contains unit tests for the profiler zones and the Chrome trace profiler.
+ */
+
+// library includes
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/Inject/IrrIMGUIInject.h>
+#include <IrrIMGUI/Tools/CChromeTraceProfiler.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief A profiler, that counts the begin and end of every zone.
+  class CCountingProfiler : public IProfiler
+  {
+    public:
+      CCountingProfiler(void)
+      {
+        for (int i = 0; i < EPZ_COUNT; i++)
+        {
+          mBegin[i] = 0;
+          mEnd[i]   = 0;
+        }
+        return;
+      }
+
+      virtual void beginZone(EProfilerZone Zone)
+      {
+        mBegin[Zone]++;
+        return;
+      }
+
+      virtual void endZone(EProfilerZone Zone)
+      {
+        mEnd[Zone]++;
+        return;
+      }
+
+      int mBegin[EPZ_COUNT];
+      int mEnd[EPZ_COUNT];
+  };
+}
+
+TEST_GROUP(TestProfiler)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+    Inject::setProfiler(nullptr);
+  }
+};
+
+TEST(TestProfiler, checkDefaultProfiler)
+{
+  POINTERS_EQUAL(nullptr, Inject::getProfiler());
+
+  CCountingProfiler Profiler;
+  Inject::setProfiler(&Profiler);
+  POINTERS_EQUAL(&Profiler, Inject::getProfiler());
+
+  Inject::setProfiler();
+  POINTERS_EQUAL(nullptr, Inject::getProfiler());
+
+  return;
+}
+
+TEST(TestProfiler, checkZoneNames)
+{
+  STRCMP_EQUAL("StartGUI",      getProfilerZoneName(EPZ_START_GUI));
+  STRCMP_EQUAL("NewFrame",      getProfilerZoneName(EPZ_NEW_FRAME));
+  STRCMP_EQUAL("Render",        getProfilerZoneName(EPZ_RENDER));
+  STRCMP_EQUAL("DeleteTexture", getProfilerZoneName(EPZ_DELETE_TEXTURE));
+  STRCMP_EQUAL("Unknown",       getProfilerZoneName(EPZ_COUNT));
+
+  return;
+}
+
+TEST(TestProfiler, checkHandleZones)
+{
+  CCountingProfiler Profiler;
+  Inject::setProfiler(&Profiler);
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(16, 16));
+  IGUITexture * const pTexture = pGUI->createTexture(pImage);
+  pGUI->updateTexture(pTexture, pImage);
+
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Begin("Profiler Test");
+    ImGui::Text("Frame %d", Frame);
+    ImGui::End();
+    pGUI->drawAll();
+  }
+
+  pGUI->deleteTexture(pTexture);
+  pImage->drop();
+
+  CHECK_EQUAL(3, Profiler.mBegin[EPZ_START_GUI]);
+  CHECK_EQUAL(3, Profiler.mBegin[EPZ_UPDATE_FRAME_VALUES]);
+  CHECK_EQUAL(3, Profiler.mBegin[EPZ_NEW_FRAME]);
+  CHECK_EQUAL(3, Profiler.mBegin[EPZ_DRAW_ALL]);
+  CHECK_EQUAL(3, Profiler.mBegin[EPZ_RENDER]);
+  CHECK(Profiler.mBegin[EPZ_CREATE_TEXTURE] >= 1);
+  CHECK(Profiler.mBegin[EPZ_UPDATE_TEXTURE] >= 1);
+  CHECK_EQUAL(1, Profiler.mBegin[EPZ_DELETE_TEXTURE]);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  for (int i = 0; i < EPZ_COUNT; i++)
+  {
+    CHECK_EQUAL(Profiler.mBegin[i], Profiler.mEnd[i]);
+  }
+
+  return;
+}
+
+TEST(TestProfiler, checkChromeTraceEvents)
+{
+  Tools::CChromeTraceProfiler Profiler(4);
+
+  CHECK_EQUAL(0, Profiler.getNumberOfEvents());
+  CHECK_EQUAL(0, Profiler.getNumberOfDroppedEvents());
+
+  Profiler.beginZone(EPZ_NEW_FRAME);
+  Profiler.endZone(EPZ_NEW_FRAME);
+  Profiler.beginZone(EPZ_RENDER);
+  Profiler.endZone(EPZ_RENDER);
+  Profiler.beginZone(EPZ_SUBMISSION);
+  Profiler.endZone(EPZ_SUBMISSION);
+
+  CHECK_EQUAL(4, Profiler.getNumberOfEvents());
+  CHECK_EQUAL(2, Profiler.getNumberOfDroppedEvents());
+
+  Profiler.clear();
+
+  CHECK_EQUAL(0, Profiler.getNumberOfEvents());
+  CHECK_EQUAL(0, Profiler.getNumberOfDroppedEvents());
+
+  return;
+}
+
+TEST(TestProfiler, checkChromeTraceFile)
+{
+  char const * const pFileName = "TestProfiler.json";
+  Tools::CChromeTraceProfiler Profiler;
+
+  Profiler.beginZone(EPZ_NEW_FRAME);
+  Profiler.endZone(EPZ_NEW_FRAME);
+
+  CHECK_TRUE(Profiler.writeToFile(pFileName));
+
+  std::ifstream File(pFileName);
+  std::stringstream Content;
+  Content << File.rdbuf();
+  File.close();
+  std::remove(pFileName);
+
+  std::string const Text = Content.str();
+  CHECK(Text.find("\"traceEvents\"") != std::string::npos);
+  CHECK(Text.find("\"name\":\"NewFrame\"") != std::string::npos);
+  CHECK(Text.find("\"ph\":\"B\"") != std::string::npos);
+  CHECK(Text.find("\"ph\":\"E\"") != std::string::npos);
+
+  CHECK_FALSE(Profiler.writeToFile("not/existing/directory/TestProfiler.json"));
+
+  return;
+}
@@ -0,0 +1,238 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestSIMD.cpp
+ * @brief Unit Tests for checking the vectorized conversion functions.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUISIMD_priv.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Number of vertices for the tests, it is no multiple of 4 or 8 to test the remaining vertices as well.
+  irr::u32 const NumberOfTestVertices = 37;
+
+  /// @brief Number of pixels for the tests, it is no multiple of 4, 8 or 16 to test the remaining pixels as well.
+  irr::u32 const NumberOfTestPixels = 77;
+
+  /// @brief Fills an array of IMGUI vertices with test data.
+  void fillTestVertices(ImDrawVert * const pVertices, irr::u32 const NumberOfVertex)
+  {
+    for (irr::u32 i = 0; i < NumberOfVertex; i++)
+    {
+      pVertices[i].pos.x = 1.5f * i;
+      pVertices[i].pos.y = 100.0f - 0.25f * i;
+      pVertices[i].uv.x  = 0.01f * i;
+      pVertices[i].uv.y  = 1.0f - 0.01f * i;
+      pVertices[i].col   = 0x80000000 | (i << 16) | ((2*i) << 8) | (3*i);
+    }
+  }
+}
+
+TEST_GROUP(SIMD)
+{
+  TEST_SETUP()
+  {
+    OriginalInstructionSet = Private::SIMD::getInstructionSet();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Private::SIMD::setInstructionSet(OriginalInstructionSet);
+  }
+
+  Private::SIMD::EInstructionSet OriginalInstructionSet;
+};
+
+TEST(SIMD, checkColorConversion)
+{
+  CHECK_EQUAL(0xFF00FF00, Private::SIMD::convertColor(0xFF00FF00));
+  CHECK_EQUAL(0x00FF0000, Private::SIMD::convertColor(0x000000FF));
+  CHECK_EQUAL(0x000000FF, Private::SIMD::convertColor(0x00FF0000));
+  CHECK_EQUAL(0x80332211, Private::SIMD::convertColor(0x80112233));
+
+  // must be the same like an Irrlicht color with the values of an IMGUI color
+  ImColor const GUIColor(0x11, 0x22, 0x33, 0x80);
+  irr::video::SColor const IrrColor(0x80, 0x11, 0x22, 0x33);
+  CHECK_EQUAL(IrrColor.color, Private::SIMD::convertColor(static_cast<ImU32>(GUIColor)));
+
+  return;
+}
+
+TEST(SIMD, checkScalarIsAlwaysSupported)
+{
+  CHECK_EQUAL(true, Private::SIMD::isInstructionSetSupported(Private::SIMD::EIS_SCALAR));
+  CHECK_EQUAL(true, Private::SIMD::isInstructionSetSupported(Private::SIMD::detectInstructionSet()));
+  CHECK_EQUAL(false, Private::SIMD::isInstructionSetSupported(Private::SIMD::EIS_COUNT));
+  CHECK_EQUAL(false, Private::SIMD::setInstructionSet(Private::SIMD::EIS_COUNT));
+
+  return;
+}
+
+TEST(SIMD, checkVertexConversionForAllInstructionSets)
+{
+  ImDrawVert GUIVertices[NumberOfTestVertices];
+  fillTestVertices(GUIVertices, NumberOfTestVertices);
+
+  irr::core::vector3df const Offset(-0.375f, -0.375f, 0.0f);
+
+  for (int Set = Private::SIMD::EIS_SCALAR; Set < Private::SIMD::EIS_COUNT; Set++)
+  {
+    Private::SIMD::EInstructionSet const InstructionSet = static_cast<Private::SIMD::EInstructionSet>(Set);
+    if (!Private::SIMD::setInstructionSet(InstructionSet))
+    {
+      continue;
+    }
+
+    irr::video::S3DVertex IrrVertices[NumberOfTestVertices];
+    Private::SIMD::convertVertices(GUIVertices, IrrVertices, NumberOfTestVertices, Offset);
+
+    for (irr::u32 i = 0; i < NumberOfTestVertices; i++)
+    {
+      CHECK_EQUAL(GUIVertices[i].pos.x + Offset.X, IrrVertices[i].Pos.X);
+      CHECK_EQUAL(GUIVertices[i].pos.y + Offset.Y, IrrVertices[i].Pos.Y);
+      CHECK_EQUAL(0.0f,                            IrrVertices[i].Pos.Z);
+      CHECK_EQUAL(0.0f,                            IrrVertices[i].Normal.X);
+      CHECK_EQUAL(0.0f,                            IrrVertices[i].Normal.Y);
+      CHECK_EQUAL(1.0f,                            IrrVertices[i].Normal.Z);
+      CHECK_EQUAL(GUIVertices[i].uv.x,             IrrVertices[i].TCoords.X);
+      CHECK_EQUAL(GUIVertices[i].uv.y,             IrrVertices[i].TCoords.Y);
+      CHECK_EQUAL(Private::SIMD::convertColor(GUIVertices[i].col), IrrVertices[i].Color.color);
+    }
+  }
+
+  return;
+}
+
+TEST(SIMD, checkPixelConversionForAllInstructionSets)
+{
+  irr::u32 GUIPixels[NumberOfTestPixels];
+  for (irr::u32 i = 0; i < NumberOfTestPixels; i++)
+  {
+    GUIPixels[i] = i * 2654435761u;
+  }
+
+  for (int Set = Private::SIMD::EIS_SCALAR; Set < Private::SIMD::EIS_COUNT; Set++)
+  {
+    Private::SIMD::EInstructionSet const InstructionSet = static_cast<Private::SIMD::EInstructionSet>(Set);
+    if (!Private::SIMD::setInstructionSet(InstructionSet))
+    {
+      continue;
+    }
+
+    irr::u32 IrrPixels[NumberOfTestPixels];
+    Private::SIMD::convertColors(GUIPixels, IrrPixels, NumberOfTestPixels);
+
+    for (irr::u32 i = 0; i < NumberOfTestPixels; i++)
+    {
+      CHECK_EQUAL(Private::SIMD::convertColor(GUIPixels[i]), IrrPixels[i]);
+    }
+
+    // the conversion in place must swap the channels back
+    Private::SIMD::convertColors(IrrPixels, IrrPixels, NumberOfTestPixels);
+
+    for (irr::u32 i = 0; i < NumberOfTestPixels; i++)
+    {
+      CHECK_EQUAL(GUIPixels[i], IrrPixels[i]);
+    }
+  }
+
+  return;
+}
+
+TEST(SIMD, checkAlphaExpansionForAllInstructionSets)
+{
+  irr::u8 AlphaValues[NumberOfTestPixels];
+  for (irr::u32 i = 0; i < NumberOfTestPixels; i++)
+  {
+    AlphaValues[i] = static_cast<irr::u8>(i * 37);
+  }
+
+  for (int Set = Private::SIMD::EIS_SCALAR; Set < Private::SIMD::EIS_COUNT; Set++)
+  {
+    Private::SIMD::EInstructionSet const InstructionSet = static_cast<Private::SIMD::EInstructionSet>(Set);
+    if (!Private::SIMD::setInstructionSet(InstructionSet))
+    {
+      continue;
+    }
+
+    irr::u32 Pixels[NumberOfTestPixels];
+    Private::SIMD::expandAlpha(AlphaValues, Pixels, NumberOfTestPixels);
+
+    for (irr::u32 i = 0; i < NumberOfTestPixels; i++)
+    {
+      irr::video::SColor const IrrColor(AlphaValues[i], 255, 255, 255);
+      CHECK_EQUAL(IrrColor.color, Pixels[i]);
+    }
+  }
+
+  return;
+}
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+TEST(SIMD, checkInPlaceVertexConversion)
+{
+  ImDrawVert GUIVertices[NumberOfTestVertices];
+  ImDrawVert ReferenceVertices[NumberOfTestVertices];
+  fillTestVertices(GUIVertices,       NumberOfTestVertices);
+  fillTestVertices(ReferenceVertices, NumberOfTestVertices);
+
+  // IMGUI does not initialize the additional fields
+  for (irr::u32 i = 0; i < NumberOfTestVertices; i++)
+  {
+    GUIVertices[i].z         = 123.0f;
+    GUIVertices[i].normal[0] = 456.0f;
+    GUIVertices[i].normal[1] = 789.0f;
+    GUIVertices[i].normal[2] = 0.0f;
+  }
+
+  irr::core::vector3df const Offset(-0.375f, -0.375f, 0.0f);
+
+  irr::video::S3DVertex const * const pIrrVertices = Private::SIMD::convertVerticesInPlace(GUIVertices, NumberOfTestVertices, Offset);
+
+  POINTERS_EQUAL(static_cast<void *>(GUIVertices), static_cast<void const *>(pIrrVertices));
+
+  for (irr::u32 i = 0; i < NumberOfTestVertices; i++)
+  {
+    CHECK_EQUAL(ReferenceVertices[i].pos.x + Offset.X, pIrrVertices[i].Pos.X);
+    CHECK_EQUAL(ReferenceVertices[i].pos.y + Offset.Y, pIrrVertices[i].Pos.Y);
+    CHECK_EQUAL(0.0f,                                  pIrrVertices[i].Pos.Z);
+    CHECK_EQUAL(0.0f,                                  pIrrVertices[i].Normal.X);
+    CHECK_EQUAL(0.0f,                                  pIrrVertices[i].Normal.Y);
+    CHECK_EQUAL(1.0f,                                  pIrrVertices[i].Normal.Z);
+    CHECK_EQUAL(ReferenceVertices[i].uv.x,             pIrrVertices[i].TCoords.X);
+    CHECK_EQUAL(ReferenceVertices[i].uv.y,             pIrrVertices[i].TCoords.Y);
+    CHECK_EQUAL(Private::SIMD::convertColor(ReferenceVertices[i].col), pIrrVertices[i].Color.color);
+  }
+
+  return;
+}
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
@@ -0,0 +1,151 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestStagingBuffer.cpp
+ * @brief Unit Tests for checking the reusable staging buffer.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CStagingBuffer.h>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(StagingBuffer)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(StagingBuffer, checkEmptyBufferAtCreation)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  CHECK_EQUAL(0, Buffer.getCapacity());
+  CHECK_EQUAL(0, Buffer.getHighWaterMark());
+
+  return;
+}
+
+TEST(StagingBuffer, checkBufferIsReused)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  irr::u32 * const pFirstBuffer = Buffer.getBuffer(100);
+  CHECK(pFirstBuffer != nullptr);
+  CHECK_EQUAL(100, Buffer.getCapacity());
+  CHECK_EQUAL(100, Buffer.getHighWaterMark());
+
+  // smaller and equal requests must not allocate new memory
+  POINTERS_EQUAL(pFirstBuffer, Buffer.getBuffer(10));
+  POINTERS_EQUAL(pFirstBuffer, Buffer.getBuffer(100));
+  CHECK_EQUAL(100, Buffer.getCapacity());
+  CHECK_EQUAL(100, Buffer.getHighWaterMark());
+
+  return;
+}
+
+TEST(StagingBuffer, checkBufferGrows)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  Buffer.getBuffer(100);
+  irr::u32 * const pBuffer = Buffer.getBuffer(1000);
+
+  CHECK_EQUAL(1000, Buffer.getCapacity());
+  CHECK_EQUAL(1000, Buffer.getHighWaterMark());
+
+  // the whole buffer must be writable
+  for (irr::u32 i = 0; i < 1000; i++)
+  {
+    pBuffer[i] = i;
+  }
+  CHECK_EQUAL(999, pBuffer[999]);
+
+  return;
+}
+
+TEST(StagingBuffer, checkTrim)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  Buffer.getBuffer(1000);
+
+  // trimming to a bigger size does not change anything
+  Buffer.trim(2000);
+  CHECK_EQUAL(1000, Buffer.getCapacity());
+
+  Buffer.trim(50);
+  CHECK_EQUAL(50, Buffer.getCapacity());
+  CHECK_EQUAL(50, Buffer.getHighWaterMark());
+
+  Buffer.trim(0);
+  CHECK_EQUAL(0, Buffer.getCapacity());
+
+  return;
+}
+
+TEST(StagingBuffer, checkShrinkAfterSpike)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  // spike
+  Buffer.getBuffer(10000);
+  Buffer.shrink();
+  CHECK_EQUAL(10000, Buffer.getCapacity());
+  CHECK_EQUAL(0,     Buffer.getHighWaterMark());
+
+  // normal usage after the spike
+  Buffer.getBuffer(200);
+  Buffer.getBuffer(100);
+  Buffer.shrink();
+  CHECK_EQUAL(200, Buffer.getCapacity());
+  CHECK_EQUAL(0,   Buffer.getHighWaterMark());
+
+  return;
+}
+
+TEST(StagingBuffer, checkClear)
+{
+  Private::CStagingBuffer<irr::u32> Buffer;
+
+  Buffer.getBuffer(1000);
+  Buffer.clear();
+
+  CHECK_EQUAL(0, Buffer.getCapacity());
+  CHECK_EQUAL(0, Buffer.getHighWaterMark());
+
+  CHECK(Buffer.getBuffer(10) != nullptr);
+  CHECK_EQUAL(10, Buffer.getCapacity());
+
+  return;
+}
@@ -0,0 +1,150 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestStatisticsHistory.cpp
+ * @brief Unit Tests for checking the averages and percentiles of the render statistics.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <CStatisticsHistory.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Returns the statistics of a frame with a number of draw calls and a render time.
+  SIMGUIStatistics createFrame(irr::u32 const NumberOfDrawCalls, irr::f32 const RenderTime)
+  {
+    SIMGUIStatistics Statistics;
+    Statistics.mNumberOfDrawCalls = NumberOfDrawCalls;
+    Statistics.mRenderTime        = RenderTime;
+    return Statistics;
+  }
+}
+
+TEST_GROUP(StatisticsHistory)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(StatisticsHistory, checkEmptyHistory)
+{
+  Private::CStatisticsHistory History;
+
+  CHECK_EQUAL(0, History.getNumberOfFrames());
+  CHECK_EQUAL(0, History.getSummary().mNumberOfFrames);
+
+  // without frames the history is disabled
+  History.addFrame(createFrame(10, 1.0f));
+  CHECK_EQUAL(0, History.getSummary().mNumberOfFrames);
+  CHECK_EQUAL(0.0f, History.getSummary().mNumberOfDrawCalls.mAverage);
+
+  return;
+}
+
+TEST(StatisticsHistory, checkAverageAndPercentiles)
+{
+  Private::CStatisticsHistory History;
+  History.setNumberOfFrames(100);
+
+  // the draw calls are 1 ... 100 in random order
+  for (irr::u32 i = 0; i < 100; i++)
+  {
+    History.addFrame(createFrame(((i * 37) % 100) + 1, 2.0f));
+  }
+
+  SIMGUIStatisticsSummary const &rSummary = History.getSummary();
+  CHECK_EQUAL(100, rSummary.mNumberOfFrames);
+  DOUBLES_EQUAL(50.5f, rSummary.mNumberOfDrawCalls.mAverage, 0.001f);
+  CHECK_EQUAL(50.0f,  rSummary.mNumberOfDrawCalls.mMedian);
+  CHECK_EQUAL(95.0f,  rSummary.mNumberOfDrawCalls.mPercentile95);
+  CHECK_EQUAL(99.0f,  rSummary.mNumberOfDrawCalls.mPercentile99);
+  CHECK_EQUAL(100.0f, rSummary.mNumberOfDrawCalls.mMaximum);
+
+  DOUBLES_EQUAL(2.0f, rSummary.mRenderTime.mAverage, 0.001f);
+  DOUBLES_EQUAL(2.0f, rSummary.mTotalTime.mMaximum,  0.001f);
+
+  return;
+}
+
+TEST(StatisticsHistory, checkOldFramesAreReplaced)
+{
+  Private::CStatisticsHistory History;
+  History.setNumberOfFrames(4);
+
+  for (irr::u32 i = 0; i < 4; i++)
+  {
+    History.addFrame(createFrame(100, 0.0f));
+  }
+  CHECK_EQUAL(100.0f, History.getSummary().mNumberOfDrawCalls.mMaximum);
+
+  for (irr::u32 i = 0; i < 4; i++)
+  {
+    History.addFrame(createFrame(10, 0.0f));
+  }
+
+  SIMGUIStatisticsSummary const &rSummary = History.getSummary();
+  CHECK_EQUAL(4, rSummary.mNumberOfFrames);
+  CHECK_EQUAL(10.0f, rSummary.mNumberOfDrawCalls.mAverage);
+  CHECK_EQUAL(10.0f, rSummary.mNumberOfDrawCalls.mMaximum);
+
+  return;
+}
+
+TEST(StatisticsHistory, checkChangedNumberOfFrames)
+{
+  Private::CStatisticsHistory History;
+  History.setNumberOfFrames(4);
+
+  History.addFrame(createFrame(10, 0.0f));
+  History.addFrame(createFrame(20, 0.0f));
+  CHECK_EQUAL(2, History.getSummary().mNumberOfFrames);
+
+  // setting the same number keeps the frames
+  History.setNumberOfFrames(4);
+  CHECK_EQUAL(2, History.getSummary().mNumberOfFrames);
+
+  History.setNumberOfFrames(8);
+  CHECK_EQUAL(0, History.getSummary().mNumberOfFrames);
+
+  History.addFrame(createFrame(30, 0.0f));
+  CHECK_EQUAL(1, History.getSummary().mNumberOfFrames);
+  CHECK_EQUAL(30.0f, History.getSummary().mNumberOfDrawCalls.mMedian);
+
+  History.setNumberOfFrames(0);
+  History.addFrame(createFrame(30, 0.0f));
+  CHECK_EQUAL(0, History.getSummary().mNumberOfFrames);
+
+  return;
+}
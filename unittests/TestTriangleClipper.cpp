@@ -0,0 +1,231 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestTriangleClipper.cpp
+ * @brief Unit Tests for checking the clipping of triangles on the CPU.
+ */
+
+// library includes
+#include <vector>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CTriangleClipper.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Creates a vertex with a texture coordinate, that is equal to its position divided by 100.
+  irr::video::S3DVertex createVertex(irr::f32 const X, irr::f32 const Y)
+  {
+    irr::video::S3DVertex Vertex;
+    Vertex.Pos     = irr::core::vector3df(X, Y, 0.0f);
+    Vertex.Color   = irr::video::SColor(255, 255, 255, 255);
+    Vertex.TCoords = irr::core::vector2df(X / 100.0f, Y / 100.0f);
+    return Vertex;
+  }
+
+  /// @brief Checks, that all vertices of the batch are inside the clipping rectangle and keep the texture coordinates of their position.
+  void checkBatchInsideRect(Private::CTriangleClipper const &rClipper, ImVec4 const &rRect)
+  {
+    for (irr::u32 i = 0; i < rClipper.getNumberOfVertices(); i++)
+    {
+      irr::video::S3DVertex const &rVertex = rClipper.getVertices()[i];
+      CHECK(rVertex.Pos.X >= rRect.x - 0.001f);
+      CHECK(rVertex.Pos.X <= rRect.z + 0.001f);
+      CHECK(rVertex.Pos.Y >= rRect.y - 0.001f);
+      CHECK(rVertex.Pos.Y <= rRect.w + 0.001f);
+      DOUBLES_EQUAL(rVertex.Pos.X / 100.0f, rVertex.TCoords.X, 0.0001f);
+      DOUBLES_EQUAL(rVertex.Pos.Y / 100.0f, rVertex.TCoords.Y, 0.0001f);
+    }
+
+    for (irr::u32 i = 0; i < rClipper.getNumberOfIndices(); i++)
+    {
+      CHECK(rClipper.getIndices()[i] < rClipper.getNumberOfVertices());
+    }
+
+    return;
+  }
+}
+
+TEST_GROUP(TriangleClipper)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(TriangleClipper, checkTrianglesInsideAreKept)
+{
+  std::vector<irr::video::S3DVertex> Vertices;
+  Vertices.push_back(createVertex(10.0f, 10.0f));
+  Vertices.push_back(createVertex(20.0f, 10.0f));
+  Vertices.push_back(createVertex(20.0f, 20.0f));
+  Vertices.push_back(createVertex(10.0f, 20.0f));
+  irr::u16 const Indices[] = {0, 1, 2, 0, 2, 3};
+
+  Private::CTriangleClipper Clipper;
+  Clipper.begin(Vertices.data(), Vertices.size(), irr::core::vector3df(0.0f, 0.0f, 0.0f));
+
+  CHECK_EQUAL(6, Clipper.addTriangles(Indices, 6, ImVec4(0.0f, 0.0f, 100.0f, 100.0f)));
+
+  // shared vertices are copied only once into the batch
+  CHECK_EQUAL(4, Clipper.getNumberOfVertices());
+  CHECK_EQUAL(6, Clipper.getNumberOfIndices());
+  CHECK_EQUAL(0, Clipper.getNumberOfCutTriangles());
+  CHECK_EQUAL(0, Clipper.getNumberOfRemovedTriangles());
+
+  for (irr::u32 i = 0; i < 6; i++)
+  {
+    CHECK(Clipper.getVertices()[Clipper.getIndices()[i]].Pos == Vertices[Indices[i]].Pos);
+  }
+
+  return;
+}
+
+TEST(TriangleClipper, checkTrianglesOutsideAreRemoved)
+{
+  std::vector<irr::video::S3DVertex> Vertices;
+  Vertices.push_back(createVertex(10.0f, 10.0f));
+  Vertices.push_back(createVertex(20.0f, 10.0f));
+  Vertices.push_back(createVertex(20.0f, 20.0f));
+  irr::u16 const Indices[] = {0, 1, 2};
+
+  Private::CTriangleClipper Clipper;
+  Clipper.begin(Vertices.data(), Vertices.size(), irr::core::vector3df(0.0f, 0.0f, 0.0f));
+
+  CHECK_EQUAL(3, Clipper.addTriangles(Indices, 3, ImVec4(30.0f, 0.0f, 100.0f, 100.0f)));
+  CHECK_EQUAL(3, Clipper.addTriangles(Indices, 3, ImVec4(0.0f, 25.0f, 100.0f, 100.0f)));
+
+  CHECK_EQUAL(0, Clipper.getNumberOfVertices());
+  CHECK_EQUAL(0, Clipper.getNumberOfIndices());
+  CHECK_EQUAL(2, Clipper.getNumberOfRemovedTriangles());
+
+  return;
+}
+
+TEST(TriangleClipper, checkCrossingTrianglesAreCut)
+{
+  std::vector<irr::video::S3DVertex> Vertices;
+  Vertices.push_back(createVertex(0.0f,  0.0f));
+  Vertices.push_back(createVertex(40.0f, 0.0f));
+  Vertices.push_back(createVertex(0.0f,  40.0f));
+  irr::u16 const Indices[] = {0, 1, 2};
+
+  Private::CTriangleClipper Clipper;
+  Clipper.begin(Vertices.data(), Vertices.size(), irr::core::vector3df(0.0f, 0.0f, 0.0f));
+
+  // a corner is cut off: the rest is a quad with two triangles
+  ImVec4 const Rect(0.0f, 0.0f, 30.0f, 100.0f);
+  CHECK_EQUAL(3, Clipper.addTriangles(Indices, 3, Rect));
+  CHECK_EQUAL(1, Clipper.getNumberOfCutTriangles());
+  CHECK_EQUAL(4, Clipper.getNumberOfVertices());
+  CHECK_EQUAL(6, Clipper.getNumberOfIndices());
+  checkBatchInsideRect(Clipper, Rect);
+
+  // a rectangle inside of the triangle cuts it at all four borders
+  Clipper.startNextBatch();
+  ImVec4 const InnerRect(5.0f, 5.0f, 25.0f, 25.0f);
+  CHECK_EQUAL(3, Clipper.addTriangles(Indices, 3, InnerRect));
+  CHECK_EQUAL(2, Clipper.getNumberOfCutTriangles());
+  CHECK(Clipper.getNumberOfVertices() >= 5);
+  CHECK(Clipper.getNumberOfVertices() <= 7);
+  CHECK_EQUAL((Clipper.getNumberOfVertices() - 2) * 3, Clipper.getNumberOfIndices());
+  checkBatchInsideRect(Clipper, InnerRect);
+
+  return;
+}
+
+TEST(TriangleClipper, checkOffsetIsAppliedToClippingRect)
+{
+  irr::core::vector3df const Offset(-0.375f, -0.375f, 0.0f);
+
+  std::vector<irr::video::S3DVertex> Vertices;
+  Vertices.push_back(createVertex(10.0f - 0.375f, 10.0f - 0.375f));
+  Vertices.push_back(createVertex(20.0f - 0.375f, 10.0f - 0.375f));
+  Vertices.push_back(createVertex(20.0f - 0.375f, 20.0f - 0.375f));
+  irr::u16 const Indices[] = {0, 1, 2};
+
+  Private::CTriangleClipper Clipper;
+  Clipper.begin(Vertices.data(), Vertices.size(), Offset);
+
+  // the triangle touches the borders of the clipping rectangle, but must not be cut
+  CHECK_EQUAL(3, Clipper.addTriangles(Indices, 3, ImVec4(10.0f, 10.0f, 20.0f, 20.0f)));
+  CHECK_EQUAL(0, Clipper.getNumberOfCutTriangles());
+  CHECK_EQUAL(3, Clipper.getNumberOfIndices());
+
+  return;
+}
+
+TEST(TriangleClipper, checkBatchIsLimitedTo16BitIndices)
+{
+  // every triangle has its own vertices, thus a batch cannot contain all of them
+  irr::u32 const NumberOfTriangles = 30000;
+  std::vector<irr::video::S3DVertex> Vertices;
+  std::vector<irr::u32> Indices;
+
+  for (irr::u32 i = 0; i < NumberOfTriangles; i++)
+  {
+    irr::f32 const X = static_cast<irr::f32>(i % 100);
+    irr::f32 const Y = static_cast<irr::f32>(i / 100);
+    Vertices.push_back(createVertex(X,        Y));
+    Vertices.push_back(createVertex(X + 1.0f, Y));
+    Vertices.push_back(createVertex(X,        Y + 1.0f));
+    Indices.push_back(i * 3 + 0);
+    Indices.push_back(i * 3 + 1);
+    Indices.push_back(i * 3 + 2);
+  }
+
+  Private::CTriangleClipper Clipper;
+  Clipper.begin(Vertices.data(), Vertices.size(), irr::core::vector3df(0.0f, 0.0f, 0.0f));
+
+  ImVec4 const Rect(0.0f, 0.0f, 1000.0f, 1000.0f);
+  irr::u32 NumberOfBatches  = 0;
+  irr::u32 NumberOfDrawnIndices = 0;
+  irr::u32 FirstIndex = 0;
+
+  while (FirstIndex < Indices.size())
+  {
+    FirstIndex += Clipper.addTriangles(&Indices[FirstIndex], Indices.size() - FirstIndex, Rect);
+
+    CHECK(Clipper.getNumberOfVertices() <= 0x10000);
+    checkBatchInsideRect(Clipper, Rect);
+    NumberOfDrawnIndices += Clipper.getNumberOfIndices();
+    NumberOfBatches++;
+
+    Clipper.startNextBatch();
+  }
+
+  CHECK_EQUAL(2, NumberOfBatches);
+  CHECK_EQUAL(Indices.size(), NumberOfDrawnIndices);
+  CHECK_EQUAL(0, Clipper.getNumberOfCutTriangles());
+
+  return;
+}
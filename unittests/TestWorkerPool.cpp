@@ -0,0 +1,230 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestWorkerPool.cpp
+ * @brief Unit Tests for checking the worker pool and the parallel vertex conversion.
+ */
+
+// library includes
+#include <atomic>
+#include <vector>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CWorkerPool.h>
+#include <CVertexConverter.h>
+#include <IrrIMGUISIMD_priv.h>
+
+using namespace IrrIMGUI;
+
+namespace
+{
+  /// @brief Runs a job and checks, that every task has been executed exactly once.
+  void checkAllTasksExecuted(Private::CWorkerPool &rPool, irr::u32 const NumberOfTasks)
+  {
+    std::vector<std::atomic<irr::u32>> Executions(NumberOfTasks);
+    for (std::atomic<irr::u32> &rExecution : Executions)
+    {
+      rExecution = 0;
+    }
+
+    rPool.run(NumberOfTasks, [&](irr::u32 const TaskIndex)
+    {
+      Executions[TaskIndex]++;
+    });
+
+    for (irr::u32 i = 0; i < NumberOfTasks; i++)
+    {
+      CHECK_EQUAL(1, Executions[i].load());
+    }
+
+    return;
+  }
+
+  /// @brief Fills IMGUI vertices with test data.
+  void fillVertices(std::vector<ImDrawVert> &rVertices)
+  {
+    for (irr::u32 i = 0; i < rVertices.size(); i++)
+    {
+      rVertices[i].pos.x = static_cast<float>(i % 1920);
+      rVertices[i].pos.y = static_cast<float>(i / 1920);
+      rVertices[i].uv.x  = static_cast<float>(i % 512) / 512.0f;
+      rVertices[i].uv.y  = static_cast<float>(i % 256) / 256.0f;
+      rVertices[i].col   = 0xFF000000 | (i * 2654435761u >> 8);
+    }
+
+    return;
+  }
+}
+
+TEST_GROUP(WorkerPool)
+{
+  TEST_SETUP()
+  {
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(WorkerPool, checkSingleThreadAtCreation)
+{
+  Private::CWorkerPool Pool;
+
+  CHECK_EQUAL(1, Pool.getNumberOfThreads());
+  checkAllTasksExecuted(Pool, 10);
+
+  return;
+}
+
+TEST(WorkerPool, checkAllTasksAreExecutedOnce)
+{
+  Private::CWorkerPool Pool;
+
+  Pool.setNumberOfThreads(4);
+  CHECK_EQUAL(4, Pool.getNumberOfThreads());
+
+  checkAllTasksExecuted(Pool, 0);
+  checkAllTasksExecuted(Pool, 1);
+  checkAllTasksExecuted(Pool, 3);
+  checkAllTasksExecuted(Pool, 1000);
+
+  // a job after the other must not mix up the tasks
+  for (irr::u32 Job = 0; Job < 50; Job++)
+  {
+    checkAllTasksExecuted(Pool, Job);
+  }
+
+  return;
+}
+
+TEST(WorkerPool, checkManyJobsOfDifferentSize)
+{
+  Private::CWorkerPool Pool;
+  Pool.setNumberOfThreads(4);
+
+  // the worker threads wake up at different times, but they must never take tasks of the next job
+  for (irr::u32 Job = 0; Job < 2000; Job++)
+  {
+    checkAllTasksExecuted(Pool, (Job * 7919) % 37);
+  }
+
+  return;
+}
+
+TEST(WorkerPool, checkChangeNumberOfThreads)
+{
+  Private::CWorkerPool Pool;
+
+  Pool.setNumberOfThreads(3);
+  CHECK_EQUAL(3, Pool.getNumberOfThreads());
+  checkAllTasksExecuted(Pool, 100);
+
+  Pool.setNumberOfThreads(2);
+  CHECK_EQUAL(2, Pool.getNumberOfThreads());
+  checkAllTasksExecuted(Pool, 100);
+
+  Pool.setNumberOfThreads(1);
+  CHECK_EQUAL(1, Pool.getNumberOfThreads());
+  checkAllTasksExecuted(Pool, 100);
+
+  // 0 means one thread per core
+  Pool.setNumberOfThreads(0);
+  CHECK(Pool.getNumberOfThreads() >= 1);
+  checkAllTasksExecuted(Pool, 100);
+
+  return;
+}
+
+TEST(WorkerPool, checkParallelConversionIsEqualToSerialConversion)
+{
+  irr::u32 const             ListSizes[] = {1, 100, 4096, 4097, 20000, 3};
+  irr::core::vector3df const Offset(-0.375f, -0.375f, 0.0f);
+
+  std::vector<std::vector<ImDrawVert>> Lists;
+  irr::u32 TotalNumberOfVertices = 0;
+  for (irr::u32 const Size : ListSizes)
+  {
+    Lists.push_back(std::vector<ImDrawVert>(Size));
+    fillVertices(Lists.back());
+    TotalNumberOfVertices += Size;
+  }
+
+  std::vector<ImDrawVert> SerialSource;
+  for (std::vector<ImDrawVert> const &rList : Lists)
+  {
+    SerialSource.insert(SerialSource.end(), rList.begin(), rList.end());
+  }
+
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+  Private::SIMD::convertVerticesInPlace(SerialSource.data(), TotalNumberOfVertices, Offset);
+  irr::video::S3DVertex const * const pExpected = reinterpret_cast<irr::video::S3DVertex const *>(SerialSource.data());
+#else
+  std::vector<irr::video::S3DVertex> Expected(TotalNumberOfVertices);
+  Private::SIMD::convertVertices(SerialSource.data(), Expected.data(), TotalNumberOfVertices, Offset);
+  irr::video::S3DVertex const * const pExpected = Expected.data();
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+  Private::CVertexConverter Converter;
+  Converter.setNumberOfThreads(4);
+  CHECK_EQUAL(4, Converter.getNumberOfThreads());
+
+  std::vector<irr::video::S3DVertex> Converted(TotalNumberOfVertices);
+  irr::u32 FirstVertex = 0;
+  for (std::vector<ImDrawVert> &rList : Lists)
+  {
+    Converter.addVertices(rList.data(), &Converted[FirstVertex], rList.size());
+    FirstVertex += rList.size();
+  }
+  CHECK_EQUAL(TotalNumberOfVertices, Converter.getNumberOfVertices());
+
+  Converter.convert(Offset);
+  CHECK_EQUAL(0, Converter.getNumberOfVertices());
+
+  FirstVertex = 0;
+  for (std::vector<ImDrawVert> &rList : Lists)
+  {
+#ifdef _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+    irr::video::S3DVertex const * const pConverted = reinterpret_cast<irr::video::S3DVertex const *>(rList.data());
+#else
+    irr::video::S3DVertex const * const pConverted = &Converted[FirstVertex];
+#endif // _IRRIMGUI_IRRLICHT_VERTEX_LAYOUT_
+
+    for (irr::u32 i = 0; i < rList.size(); i++)
+    {
+      irr::video::S3DVertex const &rActual   = pConverted[i];
+      irr::video::S3DVertex const &rExpected = pExpected[FirstVertex + i];
+      CHECK(rActual.Pos     == rExpected.Pos);
+      CHECK(rActual.Color   == rExpected.Color);
+      CHECK(rActual.TCoords == rExpected.TCoords);
+    }
+
+    FirstVertex += rList.size();
+  }
+
+  return;
+}
+